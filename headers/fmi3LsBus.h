@@ -51,6 +51,23 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assert.h>
 #endif
 
+/*
+ * All numbers of bus operations are transferred in little-endian byte order. The byte order of the host
+ * is detected using the predefined macros of GCC and Clang. On other big-endian hosts, define
+ * FMI3_LS_BUS_BIG_ENDIAN_HOST to 1 before including this header.
+ */
+#if !defined(FMI3_LS_BUS_BIG_ENDIAN_HOST)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FMI3_LS_BUS_BIG_ENDIAN_HOST 1
+#else
+#define FMI3_LS_BUS_BIG_ENDIAN_HOST 0
+#endif
+#endif
+
+#if (FMI3_LS_BUS_BIG_ENDIAN_HOST == 1) && defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
 #include "fmi3PlatformTypes.h"
 
 #ifdef _MSC_VER
@@ -87,6 +104,61 @@ typedef fmi3UInt8 fmi3LsBusBoolean;
  */
 #define FMI3_LS_BUS_FALSE ((fmi3UInt8)0x00)
 
+/**
+ * \defgroup BYTE_ORDER Byte order conversion
+ * \brief Macros converting fields of bus operations between host and little-endian byte order.
+ *
+ * The conversion is selected at compile time by `FMI3_LS_BUS_BIG_ENDIAN_HOST` and does not generate any code
+ * on little-endian hosts. The number of bytes to swap is given by the type of the field.
+ * \{
+ */
+#if FMI3_LS_BUS_BIG_ENDIAN_HOST == 1
+#if defined(_MSC_VER)
+#define FMI3_LS_BUS_BSWAP16_INTERNAL(Value) _byteswap_ushort(Value)
+#define FMI3_LS_BUS_BSWAP32_INTERNAL(Value) _byteswap_ulong(Value)
+#define FMI3_LS_BUS_BSWAP64_INTERNAL(Value) _byteswap_uint64(Value)
+#else
+#define FMI3_LS_BUS_BSWAP16_INTERNAL(Value) __builtin_bswap16(Value)
+#define FMI3_LS_BUS_BSWAP32_INTERNAL(Value) __builtin_bswap32(Value)
+#define FMI3_LS_BUS_BSWAP64_INTERNAL(Value) __builtin_bswap64(Value)
+#endif
+
+/**
+ * \brief Returns the value of a field of a received bus operation in host byte order.
+ *
+ * \param[in] Field  Field of a bus operation, e.g. `operation->id`.
+ */
+#define FMI3_LS_BUS_GET_LE(Field)                                                          \
+    (sizeof(Field) == 2 ? (fmi3UInt64)FMI3_LS_BUS_BSWAP16_INTERNAL((fmi3UInt16)(Field)) : \
+     sizeof(Field) == 4 ? (fmi3UInt64)FMI3_LS_BUS_BSWAP32_INTERNAL((fmi3UInt32)(Field)) : \
+     sizeof(Field) == 8 ? (fmi3UInt64)FMI3_LS_BUS_BSWAP64_INTERNAL((fmi3UInt64)(Field)) : \
+                          (fmi3UInt64)(Field))
+#else
+#define FMI3_LS_BUS_GET_LE(Field) (Field)
+#endif
+
+/**
+ * \brief Sets a field of a bus operation to the specified value in little-endian byte order.
+ *
+ * \param[in] Field  Field of a bus operation, e.g. `_op.id`.
+ * \param[in] Value  Value in host byte order.
+ */
+#if FMI3_LS_BUS_BIG_ENDIAN_HOST == 1
+#define FMI3_LS_BUS_SET_LE(Field, Value) ((Field) = (Value), (Field) = FMI3_LS_BUS_GET_LE(Field))
+#else
+#define FMI3_LS_BUS_SET_LE(Field, Value) ((Field) = (Value))
+#endif
+
+/**
+ * \brief Reads a 32 bit unsigned integer in little-endian byte order from an address without alignment requirements.
+ *
+ * \param[in] Address  Pointer to the first byte of the integer.
+ */
+#define FMI3_LS_BUS_LOAD_LE32(Address)                                                                 \
+    ((fmi3UInt32)((const fmi3UInt8*)(Address))[0] | ((fmi3UInt32)((const fmi3UInt8*)(Address))[1] << 8) | \
+     ((fmi3UInt32)((const fmi3UInt8*)(Address))[2] << 16) | ((fmi3UInt32)((const fmi3UInt8*)(Address))[3] << 24))
+/** \} */
+
 /**
  * \brief FMI virtual bus operation of type 'Format Error'.
  */
@@ -43,12 +43,48 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "fmi3LsBus.h"
 
+/*
+ * Statistics of buffer variables are collected if FMI3_LS_BUS_BUFFER_STATISTICS is defined to 1 before
+ * including this header. Otherwise the counters are not compiled into the macros.
+ */
+#if !defined(FMI3_LS_BUS_BUFFER_STATISTICS)
+#define FMI3_LS_BUS_BUFFER_STATISTICS 0
+#endif
+
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+#include <stdio.h>
+#endif
+
 
 #ifdef __cplusplus
 extern "C"
 {
 #endif
 
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+
+/**
+ * \brief Number of operation codes counted individually. Operations with greater codes are counted
+ *        in the last element of the per-operation counters.
+ */
+#define FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES 0x51
+
+/**
+ * \brief This data type holds the statistics of a buffer variable.
+ *
+ * Variables of this type are attached to a buffer variable using \ref FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS.
+ */
+typedef struct
+{
+    fmi3UInt32 opsWritten[FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES + 1]; /**< Operations written per operation code. */
+    fmi3UInt32 opsRead[FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES + 1];    /**< Operations read per operation code. */
+    fmi3UInt64 bytesWritten;                                            /**< Bytes written. */
+    fmi3UInt64 bytesRead;                                               /**< Bytes of operations read. */
+    fmi3UInt32 overflows;                                               /**< Writes failed due to missing buffer space. */
+    size_t highWaterMark;                                               /**< Maximum length of the buffer variable. */
+} fmi3LsBusUtilBufferStatistics;
+#endif
+
 /**
  * \brief This data type holds information to read and write bus operations to/from
  *  a buffer variable via utility macros such as \ref FMI3_LS_BUS_BUFFER_WRITE and
@@ -65,9 +101,132 @@ typedef struct
     fmi3UInt8* writePos;  /**< The current write position. */
     fmi3UInt8* readPos;   /**< The current read position. */
     fmi3Boolean status;   /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+    fmi3LsBusUtilBufferStatistics* statistics; /**< Statistics of the buffer variable, may be `NULL`. */
+#endif
 } fmi3LsBusUtilBufferInfo;
 
 
+/**
+ * \brief Updates the statistics of a buffer variable. The write hook is called after an operation of
+ *        `Length` bytes was appended.
+ *
+ * \note These macros are reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+#define FMI3_LS_BUS_STATISTICS_INDEX_INTERNAL(OpCode)                                                                       \
+    ((OpCode) < FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES ? (size_t)(OpCode) : (size_t)FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES)
+#define FMI3_LS_BUS_STATISTICS_INIT_INTERNAL(BufferInfo) ((BufferInfo)->statistics = NULL)
+#define FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL(BufferInfo, Length)                                    \
+    do                                                                                               \
+    {                                                                                                \
+        fmi3LsBusUtilBufferStatistics* _statistics = (BufferInfo)->statistics;                       \
+        if (_statistics != NULL)                                                                     \
+        {                                                                                            \
+            _statistics->opsWritten[FMI3_LS_BUS_STATISTICS_INDEX_INTERNAL(                           \
+                FMI3_LS_BUS_LOAD_LE32((BufferInfo)->writePos - (Length)))]++;                        \
+            _statistics->bytesWritten += (Length);                                                   \
+            if ((size_t)((BufferInfo)->writePos - (BufferInfo)->start) > _statistics->highWaterMark) \
+            {                                                                                        \
+                _statistics->highWaterMark = (size_t)((BufferInfo)->writePos - (BufferInfo)->start); \
+            }                                                                                        \
+        }                                                                                            \
+    }                                                                                                \
+    while (0)
+#define FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo)                                   \
+    ((BufferInfo)->statistics != NULL ? (void)(BufferInfo)->statistics->overflows++ : (void)0)
+#define FMI3_LS_BUS_STATISTICS_READ_INTERNAL(BufferInfo, Address)                                                             \
+    ((BufferInfo)->statistics != NULL                                                                                         \
+         ? (void)((BufferInfo)->statistics->opsRead[FMI3_LS_BUS_STATISTICS_INDEX_INTERNAL(FMI3_LS_BUS_LOAD_LE32(Address))]++, \
+                  (BufferInfo)->statistics->bytesRead += FMI3_LS_BUS_LOAD_LE32((Address) + sizeof(fmi3LsBusOperationCode)))   \
+         : (void)0)
+#else
+#define FMI3_LS_BUS_STATISTICS_INIT_INTERNAL(BufferInfo) ((void)0)
+#define FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL(BufferInfo, Length) ((void)0)
+#define FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo) ((void)0)
+#define FMI3_LS_BUS_STATISTICS_READ_INTERNAL(BufferInfo, Address) ((void)0)
+#endif
+
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+/**
+ * \brief Attaches a statistics variable to a buffer variable and clears its counters.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilBufferStatistics txStatistics;
+ * FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+ * FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS(&txBufferInfo, &txStatistics);
+ * \endcode
+ *
+ * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] Statistics  Pointer to variable of type \ref fmi3LsBusUtilBufferStatistics, or `NULL` to detach.
+ */
+#define FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS(BufferInfo, Statistics)                  \
+    do                                                                                  \
+    {                                                                                   \
+        (BufferInfo)->statistics = (Statistics);                                        \
+        if ((BufferInfo)->statistics != NULL)                                           \
+        {                                                                               \
+            memset((BufferInfo)->statistics, 0, sizeof(fmi3LsBusUtilBufferStatistics)); \
+        }                                                                               \
+    }                                                                                   \
+    while (0)
+
+/**
+ * \brief Copies the statistics of a buffer variable, e.g. to report them while the counters keep running.
+ *
+ * \param[in]  BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo with attached statistics.
+ * \param[out] Snapshot    Variable of type \ref fmi3LsBusUtilBufferStatistics.
+ */
+#define FMI3_LS_BUS_BUFFER_STATISTICS_SNAPSHOT(BufferInfo, Snapshot)                          \
+    do                                                                                        \
+    {                                                                                         \
+        memcpy(&(Snapshot), (BufferInfo)->statistics, sizeof(fmi3LsBusUtilBufferStatistics)); \
+    }                                                                                         \
+    while (0)
+
+/**
+ * \brief Formats statistics as a single line of text, e.g. to be passed to the logger callback of an FMU.
+ *
+ * Example:
+ * \code
+ * char text[512];
+ * FMI3_LS_BUS_BUFFER_STATISTICS_FORMAT(&txStatistics, text, sizeof(text));
+ * logMessage(instanceEnvironment, fmi3OK, "logBusStatistics", text);
+ * \endcode
+ *
+ * \param[in]  Statistics  Pointer to variable of type \ref fmi3LsBusUtilBufferStatistics.
+ * \param[out] Text        Character buffer receiving the zero-terminated text, truncated if too small.
+ * \param[in]  TextSize    Size of the character buffer.
+ */
+#define FMI3_LS_BUS_BUFFER_STATISTICS_FORMAT(Statistics, Text, TextSize)                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        size_t _textPos = 0;                                                                                           \
+        size_t _opCode;                                                                                                \
+        int _written = snprintf((Text), (TextSize), "bytesWritten=%llu bytesRead=%llu overflows=%u highWaterMark=%zu", \
+                                (unsigned long long)(Statistics)->bytesWritten,                                        \
+                                (unsigned long long)(Statistics)->bytesRead,                                           \
+                                (unsigned)(Statistics)->overflows, (Statistics)->highWaterMark);                       \
+        for (_opCode = 0; _opCode <= FMI3_LS_BUS_BUFFER_STATISTICS_OP_CODES; _opCode++)                                \
+        {                                                                                                              \
+            if (_written < 0 || (_textPos += (size_t)_written) >= (size_t)(TextSize))                                  \
+            {                                                                                                          \
+                break;                                                                                                 \
+            }                                                                                                          \
+            _written = 0;                                                                                              \
+            if ((Statistics)->opsWritten[_opCode] != 0 || (Statistics)->opsRead[_opCode] != 0)                         \
+            {                                                                                                          \
+                _written = snprintf((Text) + _textPos, (size_t)(TextSize) - _textPos, " op[0x%02X]=%u/%u",             \
+                                    (unsigned)_opCode, (unsigned)(Statistics)->opsWritten[_opCode],                    \
+                                    (unsigned)(Statistics)->opsRead[_opCode]);                                         \
+            }                                                                                                          \
+        }                                                                                                              \
+    }                                                                                                                  \
+    while (0)
+#endif
+
 /**
  * \brief Creates a Format Error operation.
  *
@@ -89,19 +248,8 @@ typedef struct
                             sizeof(fmi3LsBusDataLength) +                                               \
                             (DataLength);                                                               \
                                                                                                         \
-        _op.dataLength = (DataLength);                                                                  \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))              \
-        {                                                                                               \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length - (DataLength));                     \
-            (BufferInfo)->writePos += _op.header.length - (DataLength);                                 \
-            memcpy((BufferInfo)->writePos, (Data), (DataLength));                                       \
-            (BufferInfo)->writePos += (DataLength);                                                     \
-            (BufferInfo)->status = fmi3True;                                                            \
-        }                                                                                               \
-        else                                                                                            \
-        {                                                                                               \
-            (BufferInfo)->status = fmi3False;                                                           \
-        }                                                                                               \
+        FMI3_LS_BUS_SET_LE(_op.dataLength, (DataLength));                                               \
+        FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL((BufferInfo), _op, (DataLength), (Data));                  \
     }                                                                                                   \
     while (0)
 
@@ -130,6 +278,7 @@ typedef struct
         (BufferInfo)->writePos = (BufferInfo)->start;          \
         (BufferInfo)->readPos = (BufferInfo)->start;           \
         (BufferInfo)->status = fmi3True;                       \
+        FMI3_LS_BUS_STATISTICS_INIT_INTERNAL(BufferInfo);      \
     }                                                          \
     while (0)
 
@@ -178,6 +327,8 @@ typedef struct
 /**
  * \brief Writes data to a buffer variable. Existing data will be overwritten.
  *
+ * See \ref FMI3_LS_BUS_BUFFER_INFO_BORROW to read operations from data without copying it.
+ *
  * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
  * \param[in] Data        Pointer to data to be written.
  * \param[in] DataLength  Size of the data to be written.
@@ -195,10 +346,89 @@ typedef struct
         else                                                             \
         {                                                                \
             (BufferInfo)->status = fmi3False;                            \
+            FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo);        \
         }                                                                \
     }                                                                    \
     while (0)
 
+/**
+ * \brief Lets a buffer variable refer to data owned by the caller instead of copying it.
+ *
+ * This macro can be used instead of \ref FMI3_LS_BUS_BUFFER_WRITE to read the operations of a binary
+ * variable in place, e.g. in `fmi3SetBinary`. The data must stay valid as long as operations are read
+ * from the buffer variable. Operations which must outlive the data can be preserved using
+ * \ref FMI3_LS_BUS_BUFFER_INFO_RETAIN. No operations can be written to a borrowed buffer variable,
+ * it must not be reset before \ref FMI3_LS_BUS_BUFFER_INFO_RETAIN or \ref FMI3_LS_BUS_BUFFER_INFO_INIT
+ * was called. The variable must have been initialized using \ref FMI3_LS_BUS_BUFFER_INFO_INIT before.
+ *
+ * Example:
+ * \code
+ * fmi3SetBinary(..., const size_t valueSizes[], const fmi3Binary values[], ...)
+ * {
+ *     fmi3LsBusOperationHeader* operation;
+ *     FMI3_LS_BUS_BUFFER_INFO_BORROW(&rxBufferInfo, values[0], valueSizes[0]);
+ *     while (FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation))
+ *     {
+ *         ...
+ *     }
+ *     FMI3_LS_BUS_BUFFER_INFO_RETAIN(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+ * }
+ * \endcode
+ *
+ * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] Data        Pointer to the data containing the operations.
+ * \param[in] DataLength  Length of the data.
+ */
+#define FMI3_LS_BUS_BUFFER_INFO_BORROW(BufferInfo, Data, DataLength) \
+    do                                                               \
+    {                                                                \
+        (BufferInfo)->start = (fmi3UInt8*)(Data);                    \
+        (BufferInfo)->size = (DataLength);                           \
+        (BufferInfo)->end = (BufferInfo)->start + (DataLength);      \
+        (BufferInfo)->writePos = (BufferInfo)->end;                  \
+        (BufferInfo)->readPos = (BufferInfo)->start;                 \
+        (BufferInfo)->status = fmi3True;                             \
+    }                                                                \
+    while (0)
+
+/**
+ * \brief Copies the operations not read yet from a borrowed buffer variable into an owned buffer.
+ *
+ * After this macro the buffer variable refers to `Buffer`, holding only the operations not read yet.
+ * Nothing is copied if the buffer variable already refers to `Buffer`. If the remaining operations do
+ * not fit into `Buffer`, they are discarded and `BufferInfo->status` is set to `fmi3False`.
+ *
+ * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] Buffer      Pointer to the buffer variable owned by the caller.
+ * \param[in] Size        Size of the buffer variable.
+ */
+#define FMI3_LS_BUS_BUFFER_INFO_RETAIN(BufferInfo, Buffer, Size)                                \
+    do                                                                                          \
+    {                                                                                           \
+        if ((BufferInfo)->start != (fmi3UInt8*)(Buffer))                                        \
+        {                                                                                       \
+            const size_t _remaining = (size_t)((BufferInfo)->writePos - (BufferInfo)->readPos); \
+            const fmi3UInt8* _remainingData = (BufferInfo)->readPos;                            \
+            (BufferInfo)->start = (fmi3UInt8*)(Buffer);                                         \
+            (BufferInfo)->size = (Size);                                                        \
+            (BufferInfo)->end = (BufferInfo)->start + (Size);                                   \
+            (BufferInfo)->readPos = (BufferInfo)->start;                                        \
+            (BufferInfo)->writePos = (BufferInfo)->start;                                       \
+            (BufferInfo)->status = fmi3True;                                                    \
+            if (_remaining <= (BufferInfo)->size)                                               \
+            {                                                                                   \
+                memcpy((BufferInfo)->start, _remainingData, _remaining);                        \
+                (BufferInfo)->writePos += _remaining;                                           \
+            }                                                                                   \
+            else                                                                                \
+            {                                                                                   \
+                (BufferInfo)->status = fmi3False;                                               \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo);                           \
+            }                                                                                   \
+        }                                                                                       \
+    }                                                                                           \
+    while (0)
+
 /**
  * \brief Reads the next bus operation from a buffer.
  *
@@ -218,8 +448,11 @@ typedef struct
  */
 #define FMI3_LS_BUS_READ_NEXT_OPERATION(BufferInfo, Operation)                                                                    \
     ((fmi3UInt32)((BufferInfo)->writePos - (BufferInfo)->readPos) >= sizeof(fmi3LsBusOperationHeader) &&                          \
-     (fmi3UInt32)((BufferInfo)->writePos - (BufferInfo)->readPos) >= ((fmi3LsBusOperationHeader*)(BufferInfo)->readPos)->length)  \
-        ? ((Operation) = (fmi3LsBusOperationHeader*)(BufferInfo)->readPos, (BufferInfo)->readPos += (Operation)->length),         \
+     (fmi3UInt32)((BufferInfo)->writePos - (BufferInfo)->readPos) >=                                                              \
+         FMI3_LS_BUS_LOAD_LE32((BufferInfo)->readPos + sizeof(fmi3LsBusOperationCode)))                                           \
+        ? ((Operation) = (fmi3LsBusOperationHeader*)(BufferInfo)->readPos,                                                        \
+           FMI3_LS_BUS_STATISTICS_READ_INTERNAL((BufferInfo), (BufferInfo)->readPos),                                             \
+           (BufferInfo)->readPos += FMI3_LS_BUS_LOAD_LE32((BufferInfo)->readPos + sizeof(fmi3LsBusOperationCode))),               \
         fmi3True : fmi3False\
 
  /**
@@ -248,8 +481,9 @@ typedef struct
   */
 #define FMI3_LS_BUS_READ_NEXT_OPERATION_DIRECT(Buffer, BufferLength, ReadPos, Operation)                       \
      (((BufferLength) - (ReadPos)) >= sizeof(fmi3LsBusOperationHeader) &&                                      \
-      ((BufferLength) - (ReadPos)) >= ((fmi3LsBusOperationHeader*)((Buffer) + (ReadPos)))->length)             \
-        ? ((Operation) = (fmi3LsBusOperationHeader*)((Buffer) + (ReadPos)), (ReadPos) += (Operation)->length), \
+      ((BufferLength) - (ReadPos)) >= FMI3_LS_BUS_LOAD_LE32((Buffer) + (ReadPos) + sizeof(fmi3LsBusOperationCode))) \
+        ? ((Operation) = (fmi3LsBusOperationHeader*)((Buffer) + (ReadPos)),                                     \
+           (ReadPos) += FMI3_LS_BUS_LOAD_LE32((Buffer) + (ReadPos) + sizeof(fmi3LsBusOperationCode))),          \
         fmi3True : fmi3False\
 
 
@@ -272,20 +506,25 @@ typedef struct
 #define FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL(BufferInfo, Operation, DataLength, Data)                       \
     do                                                                                                      \
     {                                                                                                       \
-            if ((Operation).header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))      \
+            const fmi3LsBusOperationLength _length = (Operation).header.length;                             \
+            if (_length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                        \
             {                                                                                               \
-                memcpy((BufferInfo)->writePos, &(Operation), (Operation).header.length - (DataLength));     \
-                (BufferInfo)->writePos += (Operation).header.length - (DataLength);                         \
+                FMI3_LS_BUS_SET_LE((Operation).header.opCode, (Operation).header.opCode);                   \
+                FMI3_LS_BUS_SET_LE((Operation).header.length, _length);                                     \
+                memcpy((BufferInfo)->writePos, &(Operation), _length - (DataLength));                       \
+                (BufferInfo)->writePos += _length - (DataLength);                                           \
                 if (((DataLength) > 0) && (NULL != (Data)))                                                 \
                 {                                                                                           \
                     memcpy((BufferInfo)->writePos, (Data), (DataLength));                                   \
                     (BufferInfo)->writePos += (DataLength);                                                 \
                 }                                                                                           \
                     (BufferInfo)->status = fmi3True;                                                        \
+                FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL((BufferInfo), _length);                               \
             }                                                                                               \
             else                                                                                            \
             {                                                                                               \
                 (BufferInfo)->status = fmi3False;                                                           \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo);                                       \
             }                                                                                               \
     } while (0)
 
@@ -307,15 +546,20 @@ typedef struct
 #define FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL(BufferInfo, Operation)                                 \
     do                                                                                                      \
     {                                                                                                       \
-            if ((Operation).header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))      \
+            const fmi3LsBusOperationLength _length = (Operation).header.length;                             \
+            if (_length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                        \
             {                                                                                               \
-                memcpy((BufferInfo)->writePos, &(Operation), (Operation).header.length);                    \
-                (BufferInfo)->writePos += (Operation).header.length;                                        \
+                FMI3_LS_BUS_SET_LE((Operation).header.opCode, (Operation).header.opCode);                   \
+                FMI3_LS_BUS_SET_LE((Operation).header.length, _length);                                     \
+                memcpy((BufferInfo)->writePos, &(Operation), _length);                                      \
+                (BufferInfo)->writePos += _length;                                                          \
                 (BufferInfo)->status = fmi3True;                                                            \
+                FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL((BufferInfo), _length);                               \
             }                                                                                               \
             else                                                                                            \
             {                                                                                               \
                 (BufferInfo)->status = fmi3False;                                                           \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo);                                       \
             }                                                                                               \
     } while (0)
 
@@ -0,0 +1,283 @@
+#ifndef fmi3LsBusUtilBridge_h
+#define fmi3LsBusUtilBridge_h
+
+/*
+This header file contains utility macros to exchange FMI-LS-BUS operations
+between hosts using datagrams. The operations of a communication point are
+coalesced into as few datagrams as possible, each holding whole operations only.
+
+This header can be used when creating importers that distribute a co-simulation over several hosts.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtil.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Magic number identifying a datagram holding bus operations.
+ */
+#define FMI3_LS_BUS_BRIDGE_FRAME_MAGIC 0x4642534CU
+
+/**
+ * \brief Maximum size of a UDP datagram over IPv4 that is not fragmented on a standard Ethernet link.
+ */
+#define FMI3_LS_BUS_BRIDGE_UDP_PAYLOAD_SIZE 1472
+
+#pragma pack(1)
+
+/**
+ * \brief Header of a datagram, followed by `length` bytes of bus operations.
+ *
+ * All fields are stored in little-endian byte order.
+ */
+typedef struct
+{
+    fmi3UInt32 magic;       /**< \ref FMI3_LS_BUS_BRIDGE_FRAME_MAGIC */
+    fmi3UInt32 sequence;    /**< Sequence number of the datagram, incremented by 1 for each datagram sent. */
+    fmi3UInt32 length;      /**< Number of bytes of bus operations following the header. */
+} fmi3LsBusUtilBridgeFrameHeader;
+
+#pragma pack()
+
+#if FMI3_LS_BUS_CHECK_OPERATION_SIZE == 1
+static_assert(sizeof(fmi3LsBusUtilBridgeFrameHeader) == 12, "'fmi3LsBusUtilBridgeFrameHeader' does not match the expected data size");
+#endif
+
+/**
+ * \brief State of one direction of a bridge connection.
+ */
+typedef struct
+{
+    fmi3UInt32 txSequence;      /**< Sequence number of the next datagram sent. */
+    fmi3UInt32 rxSequence;      /**< Sequence number of the next datagram expected. */
+    fmi3UInt32 lostFrames;      /**< Number of datagrams missing in the received sequence. */
+    fmi3UInt32 invalidFrames;   /**< Number of received datagrams discarded as malformed. */
+    fmi3UInt32 staleFrames;     /**< Number of received datagrams discarded as duplicate or out of order. */
+} fmi3LsBusUtilBridge;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilBridge.
+ *
+ * \param[in] Bridge  Pointer to \ref fmi3LsBusUtilBridge.
+ */
+#define FMI3_LS_BUS_BRIDGE_INIT(Bridge)                   \
+    do                                                    \
+    {                                                     \
+        memset((Bridge), 0, sizeof(fmi3LsBusUtilBridge)); \
+    }                                                     \
+    while (0)
+
+/**
+ * \brief Creates the next datagram from the unread operations of a buffer.
+ *
+ * The datagram holds as many whole operations as fit into `MaxSize` bytes, starting at the read position of
+ * `BufferInfo`, which is advanced accordingly. Calling this macro until `Length` is 0 yields the burst of datagrams
+ * of a communication point, which can be passed to the operating system in a single batched submission
+ * (e.g. `sendmmsg` or io_uring). If an operation does not fit into an empty datagram, e.g. because `MaxSize`
+ * is smaller than \ref fmi3LsBusUtilBridgeFrameHeader, the 'status' variable of the argument 'BufferInfo' is set
+ * to fmi3False. An operation length shorter than the operation header or exceeding the unread data makes the
+ * framing of the remaining data unreliable: the operations before it are still put into the datagram, the
+ * remaining data is discarded and the 'status' variable of the argument 'BufferInfo' is set to fmi3False.
+ *
+ * Example:
+ * \code
+ * fmi3UInt8 datagrams[16][FMI3_LS_BUS_BRIDGE_UDP_PAYLOAD_SIZE];
+ * size_t lengths[16];
+ * size_t count = 0;
+ * do
+ * {
+ *     FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&bridge, &txBufferInfo, datagrams[count], FMI3_LS_BUS_BRIDGE_UDP_PAYLOAD_SIZE,
+ *                                   lengths[count]);
+ * } while (lengths[count] != 0 && ++count < 16);
+ * \endcode
+ *
+ * \param[in]  Bridge      Pointer to \ref fmi3LsBusUtilBridge.
+ * \param[in]  BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo holding the operations to send.
+ * \param[out] Datagram    Pointer to a buffer of at least `MaxSize` bytes receiving the datagram.
+ * \param[in]  MaxSize     Maximum size of the datagram.
+ * \param[out] Length      Variable of type size_t receiving the size of the datagram, 0 if no datagram was created.
+ */
+#define FMI3_LS_BUS_BRIDGE_FRAME_NEXT(Bridge, BufferInfo, Datagram, MaxSize, Length)                                      \
+    do                                                                                                                    \
+    {                                                                                                                     \
+        fmi3LsBusUtilBridgeFrameHeader _frame;                                                                            \
+        fmi3UInt8* _frameEnd = (BufferInfo)->readPos;                                                                     \
+        fmi3Boolean _frameInvalid = fmi3False;                                                                            \
+        const size_t _frameCapacity = (size_t)(MaxSize) >= sizeof(fmi3LsBusUtilBridgeFrameHeader)                         \
+                                          ? (size_t)(MaxSize) - sizeof(fmi3LsBusUtilBridgeFrameHeader)                    \
+                                          : 0;                                                                            \
+        (Length) = 0;                                                                                                     \
+        while ((size_t)((BufferInfo)->writePos - _frameEnd) >= sizeof(fmi3LsBusOperationHeader))                          \
+        {                                                                                                                 \
+            const fmi3UInt32 _opLength = FMI3_LS_BUS_LOAD_LE32(_frameEnd + sizeof(fmi3LsBusOperationCode));               \
+            if (_opLength < sizeof(fmi3LsBusOperationHeader) || _opLength > (size_t)((BufferInfo)->writePos - _frameEnd)) \
+            {                                                                                                             \
+                _frameInvalid = fmi3True;                                                                                 \
+                break;                                                                                                    \
+            }                                                                                                             \
+            if ((size_t)(_frameEnd - (BufferInfo)->readPos) + _opLength > _frameCapacity)                                 \
+            {                                                                                                             \
+                break;                                                                                                    \
+            }                                                                                                             \
+            _frameEnd += _opLength;                                                                                       \
+        }                                                                                                                 \
+        if (_frameEnd > (BufferInfo)->readPos)                                                                            \
+        {                                                                                                                 \
+            FMI3_LS_BUS_SET_LE(_frame.magic, FMI3_LS_BUS_BRIDGE_FRAME_MAGIC);                                             \
+            FMI3_LS_BUS_SET_LE(_frame.sequence, (Bridge)->txSequence);                                                    \
+            FMI3_LS_BUS_SET_LE(_frame.length, (fmi3UInt32)(_frameEnd - (BufferInfo)->readPos));                           \
+            memcpy((Datagram), &_frame, sizeof(_frame));                                                                  \
+            memcpy((fmi3UInt8*)(Datagram) + sizeof(_frame), (BufferInfo)->readPos,                                        \
+                   (size_t)(_frameEnd - (BufferInfo)->readPos));                                                          \
+            (Length) = sizeof(_frame) + (size_t)(_frameEnd - (BufferInfo)->readPos);                                      \
+            (BufferInfo)->readPos = _frameEnd;                                                                            \
+            (Bridge)->txSequence++;                                                                                       \
+        }                                                                                                                 \
+        else if ((BufferInfo)->readPos < (BufferInfo)->writePos)                                                          \
+        {                                                                                                                 \
+            (BufferInfo)->status = fmi3False;                                                                             \
+        }                                                                                                                 \
+        if (_frameInvalid)                                                                                                \
+        {                                                                                                                 \
+            (BufferInfo)->readPos = (BufferInfo)->writePos;                                                               \
+            (BufferInfo)->status = fmi3False;                                                                             \
+        }                                                                                                                 \
+    }                                                                                                                     \
+    while (0)
+
+/**
+ * \brief Updates the buffer statistics for the operations of a datagram appended to a buffer.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+#define FMI3_LS_BUS_BRIDGE_STATISTICS_WRITE_INTERNAL(BufferInfo, Length)                                                         \
+    do                                                                                                                           \
+    {                                                                                                                            \
+        fmi3UInt8* _statisticsEnd = (BufferInfo)->writePos;                                                                      \
+        (BufferInfo)->writePos -= (Length);                                                                                      \
+        while ((BufferInfo)->writePos < _statisticsEnd)                                                                          \
+        {                                                                                                                        \
+            const fmi3UInt32 _statisticsLength = FMI3_LS_BUS_LOAD_LE32((BufferInfo)->writePos + sizeof(fmi3LsBusOperationCode)); \
+            (BufferInfo)->writePos += _statisticsLength;                                                                         \
+            FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL((BufferInfo), _statisticsLength);                                              \
+        }                                                                                                                        \
+    }                                                                                                                            \
+    while (0)
+#else
+#define FMI3_LS_BUS_BRIDGE_STATISTICS_WRITE_INTERNAL(BufferInfo, Length) ((void)0)
+#endif
+
+/**
+ * \brief Appends the operations of a received datagram to a buffer.
+ *
+ * Malformed datagrams and datagrams not fitting into the free space of `BufferInfo` are discarded,
+ * counted in `invalidFrames` and the 'status' variable of the argument 'BufferInfo' is set to fmi3False,
+ * otherwise it is set to fmi3True.
+ * Gaps in the sequence numbers are counted in `lostFrames`. Datagrams with a sequence number older than the
+ * expected one, i.e. duplicates and datagrams overtaken by a later one, are discarded and counted in `staleFrames`
+ * without changing the expected sequence number.
+ *
+ * \param[in] Bridge      Pointer to \ref fmi3LsBusUtilBridge.
+ * \param[in] Datagram    Pointer to the received datagram.
+ * \param[in] Length      Size of the received datagram.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the operations.
+ */
+#define FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(Bridge, Datagram, Length, BufferInfo)                                    \
+    do                                                                                                            \
+    {                                                                                                             \
+        const fmi3UInt8* _frameData = (const fmi3UInt8*)(Datagram) + sizeof(fmi3LsBusUtilBridgeFrameHeader);      \
+        size_t _frameLength = 0;                                                                                  \
+        size_t _framePos = 0;                                                                                     \
+        fmi3UInt32 _frameSequence = 0;                                                                            \
+        fmi3Boolean _frameOverflow = fmi3False;                                                                   \
+        fmi3Boolean _frameValid =                                                                                 \
+            (size_t)(Length) >= sizeof(fmi3LsBusUtilBridgeFrameHeader) &&                                         \
+            FMI3_LS_BUS_LOAD_LE32(Datagram) == FMI3_LS_BUS_BRIDGE_FRAME_MAGIC;                                    \
+        if (_frameValid)                                                                                          \
+        {                                                                                                         \
+            _frameSequence = FMI3_LS_BUS_LOAD_LE32((const fmi3UInt8*)(Datagram) + 4);                             \
+            _frameLength = FMI3_LS_BUS_LOAD_LE32((const fmi3UInt8*)(Datagram) + 8);                               \
+            _frameValid = _frameLength == (size_t)(Length) - sizeof(fmi3LsBusUtilBridgeFrameHeader);              \
+            _frameOverflow = _frameValid && _frameLength > (size_t)((BufferInfo)->end - (BufferInfo)->writePos);  \
+            _frameValid = _frameValid && !_frameOverflow;                                                         \
+        }                                                                                                         \
+        while (_frameValid && _framePos < _frameLength)                                                           \
+        {                                                                                                         \
+            fmi3UInt32 _opLength = 0;                                                                             \
+            if (_frameLength - _framePos >= sizeof(fmi3LsBusOperationHeader))                                     \
+            {                                                                                                     \
+                _opLength = FMI3_LS_BUS_LOAD_LE32(_frameData + _framePos + sizeof(fmi3LsBusOperationCode));       \
+            }                                                                                                     \
+            _frameValid = _opLength >= sizeof(fmi3LsBusOperationHeader) && _opLength <= _frameLength - _framePos; \
+            _framePos += _opLength;                                                                               \
+        }                                                                                                         \
+        if (_frameValid && (fmi3Int32)(_frameSequence - (Bridge)->rxSequence) < 0)                                \
+        {                                                                                                         \
+            (Bridge)->staleFrames++;                                                                              \
+            (BufferInfo)->status = fmi3True;                                                                      \
+        }                                                                                                         \
+        else if (_frameValid)                                                                                     \
+        {                                                                                                         \
+            memcpy((BufferInfo)->writePos, _frameData, _frameLength);                                             \
+            (BufferInfo)->writePos += _frameLength;                                                               \
+            FMI3_LS_BUS_BRIDGE_STATISTICS_WRITE_INTERNAL((BufferInfo), _frameLength);                             \
+            (Bridge)->lostFrames += _frameSequence - (Bridge)->rxSequence;                                        \
+            (Bridge)->rxSequence = _frameSequence + 1;                                                            \
+            (BufferInfo)->status = fmi3True;                                                                      \
+        }                                                                                                         \
+        else                                                                                                      \
+        {                                                                                                         \
+            (Bridge)->invalidFrames++;                                                                            \
+            (BufferInfo)->status = fmi3False;                                                                     \
+            if (_frameOverflow)                                                                                   \
+            {                                                                                                     \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(BufferInfo);                                             \
+            }                                                                                                     \
+        }                                                                                                         \
+    }                                                                                                             \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilBridge_h */
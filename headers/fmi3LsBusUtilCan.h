@@ -65,30 +65,19 @@ extern "C"
     do                                                                                                  \
     {                                                                                                   \
         fmi3LsBusCanOperationCanTransmit _op;                                                           \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT;                                              \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT;                                            \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) +                                          \
                             sizeof(fmi3LsBusCanId) +                                                    \
                             sizeof(fmi3LsBusCanIde) +                                                   \
                             sizeof(fmi3LsBusCanRtr) +                                                   \
                             sizeof(fmi3LsBusCanDataLength) +                                            \
                             (DataLength);                                                               \
-        _op.id = (ID);                                                                                  \
-        _op.ide = (Ide);                                                                                \
-        _op.rtr = (Rtr);                                                                                \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                               \
+        FMI3_LS_BUS_SET_LE(_op.ide, (Ide));                                                             \
+        FMI3_LS_BUS_SET_LE(_op.rtr, (Rtr));                                                             \
                                                                                                         \
-        _op.dataLength = (DataLength);                                                                  \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))              \
-        {                                                                                               \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length - (DataLength));                     \
-            (BufferInfo)->writePos += _op.header.length - (DataLength);                                 \
-            memcpy((BufferInfo)->writePos, (Data), (DataLength));                                       \
-            (BufferInfo)->writePos += (DataLength);                                                     \
-            (BufferInfo)->status = fmi3True;                                                            \
-        }                                                                                               \
-        else                                                                                            \
-        {                                                                                               \
-            (BufferInfo)->status = fmi3False;                                                           \
-        }                                                                                               \
+        FMI3_LS_BUS_SET_LE(_op.dataLength, (DataLength));                                               \
+        FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL((BufferInfo), _op, (DataLength), (Data));                  \
     }                                                                                                   \
     while (0)
 
@@ -112,28 +101,17 @@ extern "C"
     do                                                                                                            \
     {                                                                                                             \
         fmi3LsBusCanOperationCanFdTransmit _op;                                                                   \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT;                                                      \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT;                                                    \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId) + sizeof(fmi3LsBusCanIde) + \
                             sizeof(fmi3LsBusCanBrs) + sizeof(fmi3LsBusCanEsi) + sizeof(fmi3LsBusCanDataLength) +  \
                             (DataLength);                                                                         \
-        _op.id = (ID);                                                                                            \
-        _op.ide = (Ide);                                                                                          \
-        _op.brs = (Brs);                                                                                          \
-        _op.esi = (Esi);                                                                                          \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                                         \
+        FMI3_LS_BUS_SET_LE(_op.ide, (Ide));                                                                       \
+        FMI3_LS_BUS_SET_LE(_op.brs, (Brs));                                                                       \
+        FMI3_LS_BUS_SET_LE(_op.esi, (Esi));                                                                       \
                                                                                                                   \
-        _op.dataLength = (DataLength);                                                                            \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                        \
-        {                                                                                                         \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length - (DataLength));                               \
-            (BufferInfo)->writePos += _op.header.length - (DataLength);                                           \
-            memcpy((BufferInfo)->writePos, (Data), (DataLength));                                                 \
-            (BufferInfo)->writePos += (DataLength);                                                               \
-            (BufferInfo)->status = fmi3True;                                                                      \
-        }                                                                                                         \
-        else                                                                                                      \
-        {                                                                                                         \
-            (BufferInfo)->status = fmi3False;                                                                     \
-        }                                                                                                         \
+        FMI3_LS_BUS_SET_LE(_op.dataLength, (DataLength));                                                         \
+        FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL((BufferInfo), _op, (DataLength), (Data));                            \
     }                                                                                                             \
     while (0)
 
@@ -159,30 +137,19 @@ extern "C"
     do                                                                                                            \
     {                                                                                                             \
         fmi3LsBusCanOperationCanXlTransmit _op;                                                                   \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CANXL_TRANSMIT;                                                      \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CANXL_TRANSMIT;                                                    \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId) + sizeof(fmi3LsBusCanIde) + \
                             sizeof(fmi3LsBusCanSec) + sizeof(fmi3LsBusCanSdt) + sizeof(fmi3LsBusCanVcId) +        \
-                            sizeof(fmi3LsBusCanAf) + sizeof(fmi3LsBusCanDataLength) + (DataLength);             \
-        _op.id = (ID);                                                                                            \
-        _op.ide = (Ide);                                                                                          \
-        _op.sec = (Sec);                                                                                          \
-        _op.sdt = (Sdt);                                                                                          \
-        _op.vcid = (VcId);                                                                                        \
-        _op.af = (Af);                                                                                            \
+                            sizeof(fmi3LsBusCanAf) + sizeof(fmi3LsBusCanDataLength) + (DataLength);               \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                                         \
+        FMI3_LS_BUS_SET_LE(_op.ide, (Ide));                                                                       \
+        FMI3_LS_BUS_SET_LE(_op.sec, (Sec));                                                                       \
+        FMI3_LS_BUS_SET_LE(_op.sdt, (Sdt));                                                                       \
+        FMI3_LS_BUS_SET_LE(_op.vcid, (VcId));                                                                     \
+        FMI3_LS_BUS_SET_LE(_op.af, (Af));                                                                         \
                                                                                                                   \
-        _op.dataLength = (DataLength);                                                                            \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                        \
-        {                                                                                                         \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length - (DataLength));                               \
-            (BufferInfo)->writePos += _op.header.length - (DataLength);                                           \
-            memcpy((BufferInfo)->writePos, (Data), (DataLength));                                                 \
-            (BufferInfo)->writePos += (DataLength);                                                               \
-            (BufferInfo)->status = fmi3True;                                                                      \
-        }                                                                                                         \
-        else                                                                                                      \
-        {                                                                                                         \
-            (BufferInfo)->status = fmi3False;                                                                     \
-        }                                                                                                         \
+        FMI3_LS_BUS_SET_LE(_op.dataLength, (DataLength));                                                         \
+        FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL((BufferInfo), _op, (DataLength), (Data));                            \
     }                                                                                                             \
     while (0)
 
@@ -201,21 +168,12 @@ extern "C"
     do                                                                                     \
     {                                                                                      \
         fmi3LsBusCanOperationConfirm _op;                                                  \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIRM;                                      \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIRM;                                    \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) +                             \
                             sizeof(fmi3LsBusCanId);                                        \
-        _op.id = (ID);                                                                     \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                  \
                                                                                            \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos)) \
-        {                                                                                  \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                       \
-            (BufferInfo)->writePos += _op.header.length;                                   \
-            (BufferInfo)->status = fmi3True;                                               \
-        }                                                                                  \
-        else                                                                               \
-        {                                                                                  \
-            (BufferInfo)->status = fmi3False;                                              \
-        }                                                                                  \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                   \
     }                                                                                      \
     while (0)
 
@@ -234,23 +192,14 @@ extern "C"
     do                                                                                                  \
     {                                                                                                   \
         fmi3LsBusCanOperationConfiguration _op;                                                         \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                             \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                           \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) +                                          \
                             sizeof(fmi3LsBusCanConfigParameterType) +                                   \
                             sizeof(fmi3LsBusCanBaudrate);                                               \
-        _op.parameterType = FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CAN_BAUDRATE;                             \
-        _op.baudrate = (BaudRate);                                                                      \
+        FMI3_LS_BUS_SET_LE(_op.parameterType, FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CAN_BAUDRATE);          \
+        FMI3_LS_BUS_SET_LE(_op.baudrate, (BaudRate));                                                   \
                                                                                                         \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))              \
-        {                                                                                               \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                                    \
-            (BufferInfo)->writePos += _op.header.length;                                                \
-            (BufferInfo)->status = fmi3True;                                                            \
-        }                                                                                               \
-        else                                                                                            \
-        {                                                                                               \
-            (BufferInfo)->status = fmi3False;                                                           \
-        }                                                                                               \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                                \
     }                                                                                                   \
     while (0)
 
@@ -269,22 +218,13 @@ extern "C"
     do                                                                                                                 \
     {                                                                                                                  \
         fmi3LsBusCanOperationConfiguration _op;                                                                        \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                            \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                          \
         _op.header.length =                                                                                            \
             sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanConfigParameterType) + sizeof(fmi3LsBusCanBaudrate); \
-        _op.parameterType = FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CANFD_BAUDRATE;                                          \
-        _op.baudrate = (BaudRate);                                                                                     \
+        FMI3_LS_BUS_SET_LE(_op.parameterType, FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CANFD_BAUDRATE);                       \
+        FMI3_LS_BUS_SET_LE(_op.baudrate, (BaudRate));                                                                  \
                                                                                                                        \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                             \
-        {                                                                                                              \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                                                   \
-            (BufferInfo)->writePos += _op.header.length;                                                               \
-            (BufferInfo)->status = fmi3True;                                                                           \
-        }                                                                                                              \
-        else                                                                                                           \
-        {                                                                                                              \
-            (BufferInfo)->status = fmi3False;                                                                          \
-        }                                                                                                              \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                                               \
     }                                                                                                                  \
     while (0)
 
@@ -303,22 +243,13 @@ extern "C"
     do                                                                                                                 \
     {                                                                                                                  \
         fmi3LsBusCanOperationConfiguration _op;                                                                        \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                            \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                          \
         _op.header.length =                                                                                            \
             sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanConfigParameterType) + sizeof(fmi3LsBusCanBaudrate); \
-        _op.parameterType = FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CANXL_BAUDRATE;                                          \
-        _op.baudrate = (BaudRate);                                                                                     \
+        FMI3_LS_BUS_SET_LE(_op.parameterType, FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CANXL_BAUDRATE);                       \
+        FMI3_LS_BUS_SET_LE(_op.baudrate, (BaudRate));                                                                  \
                                                                                                                        \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                             \
-        {                                                                                                              \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                                                   \
-            (BufferInfo)->writePos += _op.header.length;                                                               \
-            (BufferInfo)->status = fmi3True;                                                                           \
-        }                                                                                                              \
-        else                                                                                                           \
-        {                                                                                                              \
-            (BufferInfo)->status = fmi3False;                                                                          \
-        }                                                                                                              \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                                               \
     }                                                                                                                  \
     while (0)
 
@@ -337,22 +268,13 @@ extern "C"
     do                                                                                                                                \
     {                                                                                                                                 \
         fmi3LsBusCanOperationConfiguration _op;                                                                                       \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                                           \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIGURATION;                                                                         \
         _op.header.length =                                                                                                           \
             sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanConfigParameterType) + sizeof(fmi3LsBusCanArbitrationLostBehavior); \
-        _op.parameterType = FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_ARBITRATION_LOST_BEHAVIOR;                                              \
-        _op.arbitrationLostBehavior = (ArbitrationLostBehavior);                                                                      \
+        FMI3_LS_BUS_SET_LE(_op.parameterType, FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_ARBITRATION_LOST_BEHAVIOR);                           \
+        FMI3_LS_BUS_SET_LE(_op.arbitrationLostBehavior, (ArbitrationLostBehavior));                                                   \
                                                                                                                                       \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))                                            \
-        {                                                                                                                             \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                                                                  \
-            (BufferInfo)->writePos += _op.header.length;                                                                              \
-            (BufferInfo)->status = fmi3True;                                                                                          \
-        }                                                                                                                             \
-        else                                                                                                                          \
-        {                                                                                                                             \
-            (BufferInfo)->status = fmi3False;                                                                                         \
-        }                                                                                                                             \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                                                              \
     }                                                                                                                                 \
     while (0)
 
@@ -371,20 +293,11 @@ extern "C"
     do                                                                                     \
     {                                                                                      \
         fmi3LsBusCanOperationArbitrationLost _op;                                          \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_ARBITRATION_LOST;                             \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_ARBITRATION_LOST;                           \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId);     \
-        _op.id = (ID);                                                                     \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                  \
                                                                                            \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos)) \
-        {                                                                                  \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                       \
-            (BufferInfo)->writePos += _op.header.length;                                   \
-            (BufferInfo)->status = fmi3True;                                               \
-        }                                                                                  \
-        else                                                                               \
-        {                                                                                  \
-            (BufferInfo)->status = fmi3False;                                              \
-        }                                                                                  \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                   \
     }                                                                                      \
     while (0)
 
@@ -406,25 +319,16 @@ extern "C"
     do                                                                                             \
     {                                                                                              \
         fmi3LsBusCanOperationBusError _op;                                                         \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_BUS_ERROR;                                        \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_BUS_ERROR;                                          \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId) +            \
            sizeof(fmi3LsBusCanErrorCode) + sizeof(fmi3LsBusCanErrorFlag) +                         \
            sizeof(fmi3LsBusCanIsSender);                                                           \
-        _op.id = (ID);                                                                             \
-        _op.errorCode = (ErrorCode);                                                               \
-        _op.errorFlag = (ErrorFlag);                                                               \
-        _op.isSender = (IsSender);                                                                 \
+        FMI3_LS_BUS_SET_LE(_op.id, (ID));                                                          \
+        FMI3_LS_BUS_SET_LE(_op.errorCode, (ErrorCode));                                            \
+        FMI3_LS_BUS_SET_LE(_op.errorFlag, (ErrorFlag));                                            \
+        FMI3_LS_BUS_SET_LE(_op.isSender, (IsSender));                                              \
                                                                                                    \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))         \
-        {                                                                                          \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                               \
-            (BufferInfo)->writePos += _op.header.length;                                           \
-            (BufferInfo)->status = fmi3True;                                                       \
-        }                                                                                          \
-        else                                                                                       \
-        {                                                                                          \
-            (BufferInfo)->status = fmi3False;                                                      \
-        }                                                                                          \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                           \
     }                                                                                              \
     while (0)
 
@@ -443,20 +347,11 @@ extern "C"
     do                                                                                         \
     {                                                                                          \
         fmi3LsBusCanOperationStatus _op;                                                       \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_STATUS;                                           \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_STATUS;                                         \
         _op.header.length = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanStatusKind); \
-        _op.status = (Status);                                                                 \
+        FMI3_LS_BUS_SET_LE(_op.status, (Status));                                              \
                                                                                                \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos))     \
-        {                                                                                      \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                           \
-            (BufferInfo)->writePos += _op.header.length;                                       \
-            (BufferInfo)->status = fmi3True;                                                   \
-        }                                                                                      \
-        else                                                                                   \
-        {                                                                                      \
-            (BufferInfo)->status = fmi3False;                                                  \
-        }                                                                                      \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                       \
     }                                                                                          \
     while (0)
 
@@ -474,19 +369,10 @@ extern "C"
     do                                                                                     \
     {                                                                                      \
         fmi3LsBusCanOperationWakeup _op;                                                   \
-        _op.header.opCode = FMI3_LS_BUS_CAN_OP_WAKEUP;                                       \
+        _op.header.opCode = FMI3_LS_BUS_CAN_OP_WAKEUP;                                     \
         _op.header.length = sizeof(fmi3LsBusOperationHeader);                              \
                                                                                            \
-        if (_op.header.length <= (fmi3UInt32)((BufferInfo)->end - (BufferInfo)->writePos)) \
-        {                                                                                  \
-            memcpy((BufferInfo)->writePos, &_op, _op.header.length);                       \
-            (BufferInfo)->writePos += _op.header.length;                                   \
-            (BufferInfo)->status = fmi3True;                                               \
-        }                                                                                  \
-        else                                                                               \
-        {                                                                                  \
-            (BufferInfo)->status = fmi3False;                                              \
-        }                                                                                  \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                   \
     }                                                                                      \
     while (0)
 
@@ -0,0 +1,204 @@
+#ifndef fmi3LsBusUtilCan_hpp
+#define fmi3LsBusUtilCan_hpp
+
+/*
+This header file contains C++ function templates creating FMI-LS-BUS CAN
+specific bus operations with a message data length known at compile time.
+The created operations are identical to the ones created by the macros of
+fmi3LsBusUtilCan.h.
+
+This header file can be used when creating Network FMI-LS-BUS FMUs with CAN busses in C++.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+
+namespace fmi3LsBusUtil
+{
+
+/**
+ * \brief Writes an operation with a compile-time length to the buffer described by `bufferInfo`.
+ *
+ * The fixed part of the operation is given by `op`, followed by `DataLength` bytes of `data`.
+ * Since all sizes are constants, the bounds check and both copies are resolved at compile time.
+ *
+ * \note This function is reserved for internal use in the definition of other functions and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+template <size_t FixedLength, fmi3LsBusCanDataLength DataLength, typename Operation>
+inline void SubmitOperationInternal(fmi3LsBusUtilBufferInfo* bufferInfo, const Operation& op, const fmi3LsBusCanData* data)
+{
+    if (FixedLength + DataLength <= (size_t)(bufferInfo->end - bufferInfo->writePos))
+    {
+        memcpy(bufferInfo->writePos, &op, FixedLength);
+        memcpy(bufferInfo->writePos + FixedLength, data, DataLength);
+        bufferInfo->writePos += FixedLength + DataLength;
+        bufferInfo->status = fmi3True;
+        FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL(bufferInfo, FixedLength + DataLength);
+    }
+    else
+    {
+        bufferInfo->status = fmi3False;
+        FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(bufferInfo);
+    }
+}
+
+/**
+ * \brief Creates a CAN transmit operation.
+ *
+ *  This function is equivalent to \ref FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT with the message data length
+ *  given as template argument. If there is not enough buffer space available, the 'status'
+ *  variable of the argument 'bufferInfo' is set to fmi3False.
+ *
+ *  Example:
+ *  \code
+ *  fmi3LsBusUtil::CanCreateOpCanTransmit<8>(&txBufferInfo, 0x123, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, data);
+ *  \endcode
+ *
+ * \tparam    DataLength  Message data length (\ref fmi3LsBusCanDataLength), at most 8.
+ * \param[in] bufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] id          CAN message ID (\ref fmi3LsBusCanId).
+ * \param[in] ide         CAN message ID type (standard/extended) (\ref fmi3LsBusCanIde).
+ * \param[in] rtr         Remote Transmission Request (\ref fmi3LsBusCanRtr).
+ * \param[in] data        Message data with `DataLength` bytes.
+ */
+template <fmi3LsBusCanDataLength DataLength>
+inline void CanCreateOpCanTransmit(fmi3LsBusUtilBufferInfo* bufferInfo,
+                                   fmi3LsBusCanId id,
+                                   fmi3LsBusCanIde ide,
+                                   fmi3LsBusCanRtr rtr,
+                                   const fmi3LsBusCanData* data)
+{
+    static_assert(DataLength <= 8, "CAN messages contain at most 8 bytes of data");
+    constexpr size_t FixedLength = sizeof(fmi3LsBusOperationHeader) +
+                                   sizeof(fmi3LsBusCanId) +
+                                   sizeof(fmi3LsBusCanIde) +
+                                   sizeof(fmi3LsBusCanRtr) +
+                                   sizeof(fmi3LsBusCanDataLength);
+    fmi3LsBusCanOperationCanTransmit op;
+    FMI3_LS_BUS_SET_LE(op.header.opCode, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT);
+    FMI3_LS_BUS_SET_LE(op.header.length, (fmi3LsBusOperationLength)(FixedLength + DataLength));
+    FMI3_LS_BUS_SET_LE(op.id, id);
+    FMI3_LS_BUS_SET_LE(op.ide, ide);
+    FMI3_LS_BUS_SET_LE(op.rtr, rtr);
+    FMI3_LS_BUS_SET_LE(op.dataLength, DataLength);
+    SubmitOperationInternal<FixedLength, DataLength>(bufferInfo, op, data);
+}
+
+/**
+ * \brief Creates a CAN FD transmit operation.
+ *
+ *  This function is equivalent to \ref FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT with the message data length
+ *  given as template argument. If there is not enough buffer space available, the 'status'
+ *  variable of the argument 'bufferInfo' is set to fmi3False.
+ *
+ * \tparam    DataLength  Message data length (\ref fmi3LsBusCanDataLength), at most 64.
+ * \param[in] bufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] id          CAN message ID (\ref fmi3LsBusCanId).
+ * \param[in] ide         CAN message ID type (standard\extended) (\ref fmi3LsBusCanIde).
+ * \param[in] brs         Bit Rate Switch (\ref fmi3LsBusCanBrs).
+ * \param[in] esi         Error State Indicator (\ref fmi3LsBusCanEsi).
+ * \param[in] data        Message data with `DataLength` bytes.
+ */
+template <fmi3LsBusCanDataLength DataLength>
+inline void CanCreateOpCanFdTransmit(fmi3LsBusUtilBufferInfo* bufferInfo,
+                                     fmi3LsBusCanId id,
+                                     fmi3LsBusCanIde ide,
+                                     fmi3LsBusCanBrs brs,
+                                     fmi3LsBusCanEsi esi,
+                                     const fmi3LsBusCanData* data)
+{
+    static_assert(DataLength <= 64, "CAN FD messages contain at most 64 bytes of data");
+    constexpr size_t FixedLength = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId) + sizeof(fmi3LsBusCanIde) +
+                                   sizeof(fmi3LsBusCanBrs) + sizeof(fmi3LsBusCanEsi) + sizeof(fmi3LsBusCanDataLength);
+    fmi3LsBusCanOperationCanFdTransmit op;
+    FMI3_LS_BUS_SET_LE(op.header.opCode, FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT);
+    FMI3_LS_BUS_SET_LE(op.header.length, (fmi3LsBusOperationLength)(FixedLength + DataLength));
+    FMI3_LS_BUS_SET_LE(op.id, id);
+    FMI3_LS_BUS_SET_LE(op.ide, ide);
+    FMI3_LS_BUS_SET_LE(op.brs, brs);
+    FMI3_LS_BUS_SET_LE(op.esi, esi);
+    FMI3_LS_BUS_SET_LE(op.dataLength, DataLength);
+    SubmitOperationInternal<FixedLength, DataLength>(bufferInfo, op, data);
+}
+
+/**
+ * \brief Creates a CAN XL transmit operation.
+ *
+ *  This function is equivalent to \ref FMI3_LS_BUS_CAN_CREATE_OP_CAN_XL_TRANSMIT with the message data length
+ *  given as template argument. If there is not enough buffer space available, the 'status'
+ *  variable of the argument 'bufferInfo' is set to fmi3False.
+ *
+ * \tparam    DataLength  Message data length (\ref fmi3LsBusCanDataLength), at most 2048.
+ * \param[in] bufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo.
+ * \param[in] id          CAN message ID (\ref fmi3LsBusCanId).
+ * \param[in] ide         CAN message ID type (standard/extended) (\ref fmi3LsBusCanIde).
+ * \param[in] sec         Simple Extended Content (\ref fmi3LsBusCanSec).
+ * \param[in] sdt         Service Data Unit Type (\ref fmi3LsBusCanSdt).
+ * \param[in] vcId        Virtual CAN Network ID (\ref fmi3LsBusCanVcId).
+ * \param[in] af          Acceptance Field (\ref fmi3LsBusCanAf).
+ * \param[in] data        Message data with `DataLength` bytes.
+ */
+template <fmi3LsBusCanDataLength DataLength>
+inline void CanCreateOpCanXlTransmit(fmi3LsBusUtilBufferInfo* bufferInfo,
+                                     fmi3LsBusCanId id,
+                                     fmi3LsBusCanIde ide,
+                                     fmi3LsBusCanSec sec,
+                                     fmi3LsBusCanSdt sdt,
+                                     fmi3LsBusCanVcId vcId,
+                                     fmi3LsBusCanAf af,
+                                     const fmi3LsBusCanData* data)
+{
+    static_assert(DataLength <= 2048, "CAN XL messages contain at most 2048 bytes of data");
+    constexpr size_t FixedLength = sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId) + sizeof(fmi3LsBusCanIde) +
+                                   sizeof(fmi3LsBusCanSec) + sizeof(fmi3LsBusCanSdt) + sizeof(fmi3LsBusCanVcId) +
+                                   sizeof(fmi3LsBusCanAf) + sizeof(fmi3LsBusCanDataLength);
+    fmi3LsBusCanOperationCanXlTransmit op;
+    FMI3_LS_BUS_SET_LE(op.header.opCode, FMI3_LS_BUS_CAN_OP_CANXL_TRANSMIT);
+    FMI3_LS_BUS_SET_LE(op.header.length, (fmi3LsBusOperationLength)(FixedLength + DataLength));
+    FMI3_LS_BUS_SET_LE(op.id, id);
+    FMI3_LS_BUS_SET_LE(op.ide, ide);
+    FMI3_LS_BUS_SET_LE(op.sec, sec);
+    FMI3_LS_BUS_SET_LE(op.sdt, sdt);
+    FMI3_LS_BUS_SET_LE(op.vcid, vcId);
+    FMI3_LS_BUS_SET_LE(op.af, af);
+    FMI3_LS_BUS_SET_LE(op.dataLength, DataLength);
+    SubmitOperationInternal<FixedLength, DataLength>(bufferInfo, op, data);
+}
+
+} /* end of namespace fmi3LsBusUtil */
+
+#endif /* fmi3LsBusUtilCan_hpp */
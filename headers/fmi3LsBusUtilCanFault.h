@@ -0,0 +1,306 @@
+#ifndef fmi3LsBusUtilCanFault_h
+#define fmi3LsBusUtilCanFault_h
+
+/*
+This header file contains utility macros implementing the fault confinement of CAN nodes as described
+in the error handling section of this layered standard. Transmit and receive error counters (TEC, REC)
+are maintained from Bus Error operations and successful transmissions and receptions, and Status
+operations are created whenever the CAN node state changes.
+
+The counters of all nodes are kept in separate arrays, so that a single bus simulation or test bench
+can track thousands of nodes.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \defgroup CAN_FAULT_LIMITS CAN fault confinement limits
+ * \brief Error counter limits of the CAN node states.
+ * \{
+ */
+#define FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT 127 /**< Counters above this value lead to ERROR_PASSIVE. */
+#define FMI3_LS_BUS_CAN_FAULT_BUS_OFF_LIMIT 255 /**< A TEC above this value leads to BUS_OFF. */
+/** \} */
+
+/**
+ * \brief This data type holds the error counters and states of a set of CAN nodes.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_CAN_FAULT_INIT.
+ */
+typedef struct
+{
+    fmi3UInt16* tec;                /**< Transmit error counter per node. */
+    fmi3UInt8* rec;                 /**< Receive error counter per node. */
+    fmi3LsBusCanStatusKind* states; /**< CAN node state per node. */
+    size_t nodeCount;               /**< Number of nodes. */
+    fmi3UInt64 busErrors;           /**< Number of bus errors applied to nodes. */
+    fmi3UInt64 transitions;         /**< Number of state changes. */
+} fmi3LsBusUtilCanFault;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilCanFault with all nodes in state ERROR_ACTIVE.
+ *
+ * Example:
+ * \code
+ * fmi3UInt16 tec[1000];
+ * fmi3UInt8 rec[1000];
+ * fmi3LsBusCanStatusKind states[1000];
+ * fmi3LsBusUtilCanFault fault;
+ * FMI3_LS_BUS_CAN_FAULT_INIT(&fault, tec, rec, states, 1000);
+ * \endcode
+ *
+ * \param[in] Fault      Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Tec        Array of fmi3UInt16 with `NodeCount` elements.
+ * \param[in] Rec        Array of fmi3UInt8 with `NodeCount` elements.
+ * \param[in] States     Array of \ref fmi3LsBusCanStatusKind with `NodeCount` elements.
+ * \param[in] NodeCount  Number of nodes.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_INIT(Fault, Tec, Rec, States, NodeCount)                      \
+    do                                                                                      \
+    {                                                                                       \
+        size_t _node;                                                                       \
+        (Fault)->tec = (Tec);                                                               \
+        (Fault)->rec = (Rec);                                                               \
+        (Fault)->states = (States);                                                         \
+        (Fault)->nodeCount = (size_t)(NodeCount);                                           \
+        (Fault)->busErrors = 0;                                                             \
+        (Fault)->transitions = 0;                                                           \
+        memset((Fault)->tec, 0, sizeof(fmi3UInt16) * (Fault)->nodeCount);                   \
+        memset((Fault)->rec, 0, sizeof(fmi3UInt8) * (Fault)->nodeCount);                    \
+        for (_node = 0; _node < (Fault)->nodeCount; _node++)                                \
+        {                                                                                   \
+            (Fault)->states[_node] = FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE; \
+        }                                                                                   \
+    }                                                                                       \
+    while (0)
+
+/**
+ * \brief Returns the CAN node state of a node.
+ *
+ * \param[in] Fault  Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Node   Index of the node.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_STATE(Fault, Node) ((Fault)->states[(size_t)(Node)])
+
+/**
+ * \brief Derives the state of a node from its counters and creates a Status operation if it changed.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL(Fault, Node, BufferInfo)                                                  \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        fmi3LsBusUtilBufferInfo* _statusBufferInfo = (BufferInfo);                                                      \
+        const fmi3LsBusCanStatusKind _state =                                                                           \
+            (Fault)->tec[Node] > FMI3_LS_BUS_CAN_FAULT_BUS_OFF_LIMIT ? FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF \
+            : (Fault)->tec[Node] > FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT ||                                               \
+                    (Fault)->rec[Node] > FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT                                            \
+                ? FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE                                                \
+                : FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE;                                                \
+        if (_state != (Fault)->states[Node])                                                                            \
+        {                                                                                                               \
+            (Fault)->states[Node] = _state;                                                                             \
+            (Fault)->transitions++;                                                                                     \
+            if (_statusBufferInfo != NULL)                                                                              \
+            {                                                                                                           \
+                FMI3_LS_BUS_CAN_CREATE_OP_STATUS(_statusBufferInfo, _state);                                            \
+            }                                                                                                           \
+        }                                                                                                               \
+    }                                                                                                                   \
+    while (0)
+
+/**
+ * \brief Applies an error to a node.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_APPLY_INTERNAL(Fault, Node, IsSender, ErrorCode)                         \
+    do                                                                                                 \
+    {                                                                                                  \
+        if ((IsSender) != FMI3_LS_BUS_FALSE)                                                           \
+        {                                                                                              \
+            if (!((ErrorCode) == FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_ACK_ERROR &&                \
+                  (Fault)->states[Node] == FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE))    \
+            {                                                                                          \
+                (Fault)->tec[Node] = (fmi3UInt16)((Fault)->tec[Node] + 8);                             \
+            }                                                                                          \
+        }                                                                                              \
+        else                                                                                           \
+        {                                                                                              \
+            (Fault)->rec[Node] = (fmi3UInt8)((Fault)->rec[Node] + ((Fault)->rec[Node] < 255 ? 1 : 0)); \
+        }                                                                                              \
+        (Fault)->busErrors++;                                                                          \
+    }                                                                                                  \
+    while (0)
+
+/**
+ * \brief Updates a node with a received Bus Error operation.
+ *
+ * A transmitting node (`isSender` set) increases its TEC by 8, except for ACK errors in state ERROR_PASSIVE.
+ * A receiving node increases its REC by 1. Nodes in state BUS_OFF ignore bus errors. If the state of the
+ * node changes, a Status operation is created in `BufferInfo`.
+ *
+ * \param[in] Fault       Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Node        Index of the node.
+ * \param[in] Operation   Pointer to \ref fmi3LsBusCanOperationBusError.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the Status operation, may be NULL.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_BUS_ERROR(Fault, Node, Operation, BufferInfo)                                       \
+    do                                                                                                            \
+    {                                                                                                             \
+        const fmi3LsBusCanOperationBusError* _busError = (const fmi3LsBusCanOperationBusError*)(Operation);       \
+        const size_t _faultNode = (size_t)(Node);                                                                 \
+        if ((Fault)->states[_faultNode] != FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF)                      \
+        {                                                                                                         \
+            FMI3_LS_BUS_CAN_FAULT_APPLY_INTERNAL((Fault), _faultNode, _busError->isSender, _busError->errorCode); \
+            FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL((Fault), _faultNode, (BufferInfo));                             \
+        }                                                                                                         \
+    }                                                                                                             \
+    while (0)
+
+/**
+ * \brief Applies a bus error caused by a transmission of node `Sender` to all nodes not in state BUS_OFF.
+ *
+ * This macro is equivalent to calling \ref FMI3_LS_BUS_CAN_FAULT_BUS_ERROR for each node with `isSender`
+ * set for `Sender` only, e.g. for error injection campaigns simulating many bus errors.
+ *
+ * \param[in] Fault        Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Sender       Index of the transmitting node.
+ * \param[in] ErrorCode    Bus error code (\ref fmi3LsBusCanErrorCode).
+ * \param[in] BufferInfos  Array of \ref fmi3LsBusUtilBufferInfo indexed by node receiving the Status
+ *                         operations, may be NULL.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_BUS_ERROR_ALL(Fault, Sender, ErrorCode, BufferInfos)                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        fmi3LsBusUtilBufferInfo* _bufferInfos = (BufferInfos);                                                         \
+        size_t _node;                                                                                                  \
+        for (_node = 0; _node < (Fault)->nodeCount; _node++)                                                           \
+        {                                                                                                              \
+            if ((Fault)->states[_node] != FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF)                            \
+            {                                                                                                          \
+                FMI3_LS_BUS_CAN_FAULT_APPLY_INTERNAL((Fault), _node,                                                   \
+                                                     _node == (size_t)(Sender) ? FMI3_LS_BUS_TRUE : FMI3_LS_BUS_FALSE, \
+                                                     (ErrorCode));                                                     \
+                FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL((Fault), _node,                                                  \
+                                                      _bufferInfos != NULL ? &_bufferInfos[_node] : NULL);             \
+            }                                                                                                          \
+        }                                                                                                              \
+    }                                                                                                                  \
+    while (0)
+
+/**
+ * \brief Updates a node after it transmitted a frame successfully, e.g. on a Confirm operation.
+ *
+ * The TEC is decreased by 1. If the state of the node changes, a Status operation is created in `BufferInfo`.
+ *
+ * \param[in] Fault       Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Node        Index of the node.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the Status operation, may be NULL.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_TRANSMIT_SUCCESS(Fault, Node, BufferInfo)                        \
+    do                                                                                         \
+    {                                                                                          \
+        const size_t _faultNode = (size_t)(Node);                                              \
+        if ((Fault)->states[_faultNode] != FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF && \
+            (Fault)->tec[_faultNode] > 0)                                                      \
+        {                                                                                      \
+            (Fault)->tec[_faultNode]--;                                                        \
+            FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL((Fault), _faultNode, (BufferInfo));          \
+        }                                                                                      \
+    }                                                                                          \
+    while (0)
+
+/**
+ * \brief Updates a node after it received a frame successfully, e.g. on a Transmit operation.
+ *
+ * The REC is decreased by 1, a REC above \ref FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT is set to
+ * \ref FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT. If the state of the node changes, a Status operation is
+ * created in `BufferInfo`.
+ *
+ * \param[in] Fault       Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Node        Index of the node.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the Status operation, may be NULL.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_RECEIVE_SUCCESS(Fault, Node, BufferInfo)                                \
+    do                                                                                                \
+    {                                                                                                 \
+        const size_t _faultNode = (size_t)(Node);                                                     \
+        if ((Fault)->states[_faultNode] != FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF &&        \
+            (Fault)->rec[_faultNode] > 0)                                                             \
+        {                                                                                             \
+            (Fault)->rec[_faultNode] = (Fault)->rec[_faultNode] > FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT \
+                                           ? (fmi3UInt8)FMI3_LS_BUS_CAN_FAULT_PASSIVE_LIMIT           \
+                                           : (fmi3UInt8)((Fault)->rec[_faultNode] - 1);               \
+            FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL((Fault), _faultNode, (BufferInfo));                 \
+        }                                                                                             \
+    }                                                                                                 \
+    while (0)
+
+/**
+ * \brief Recovers a node from state BUS_OFF, resetting its counters.
+ *
+ * Usually called after the node observed 128 occurrences of 11 consecutive recessive bits.
+ *
+ * \param[in] Fault       Pointer to \ref fmi3LsBusUtilCanFault.
+ * \param[in] Node        Index of the node.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the Status operation, may be NULL.
+ */
+#define FMI3_LS_BUS_CAN_FAULT_RECOVER(Fault, Node, BufferInfo)                    \
+    do                                                                            \
+    {                                                                             \
+        const size_t _faultNode = (size_t)(Node);                                 \
+        (Fault)->tec[_faultNode] = 0;                                             \
+        (Fault)->rec[_faultNode] = 0;                                             \
+        FMI3_LS_BUS_CAN_FAULT_UPDATE_INTERNAL((Fault), _faultNode, (BufferInfo)); \
+    }                                                                             \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilCanFault_h */
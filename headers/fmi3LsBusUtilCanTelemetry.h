@@ -0,0 +1,501 @@
+#ifndef fmi3LsBusUtilCanTelemetry_h
+#define fmi3LsBusUtilCanTelemetry_h
+
+/*
+This header file contains utility macros to collect telemetry of a simulated CAN bus:
+bus utilization, frame counts per CAN ID, arbitration losses, bus errors, status
+transitions and a histogram of the latencies between transmit and confirm operations.
+
+This header can be used when creating bus simulations for CAN.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Number of CAN IDs counted individually, must be a power of 2 not greater than 256.
+ *        Frames of further CAN IDs are counted in `otherFrames`.
+ */
+#ifndef FMI3_LS_BUS_CAN_TELEMETRY_IDS
+#define FMI3_LS_BUS_CAN_TELEMETRY_IDS 128
+#endif
+
+/**
+ * \brief Number of buckets of the latency histogram. The buckets are log-linear with 4 buckets per power of 2,
+ *        so each bucket covers a range of at most 25% of its lower bound.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_HISTOGRAM_SIZE 252
+
+/**
+ * \brief Telemetry of a single CAN ID.
+ */
+typedef struct
+{
+    fmi3LsBusCanId id;              /**< CAN ID. */
+    fmi3Boolean used;               /**< Whether the entry is used. */
+    fmi3Boolean pending;            /**< Whether a transmit operation is waiting for its confirmation. */
+    fmi3UInt8 ide;                  /**< ID type of the last transmit operation. */
+    fmi3UInt8 rtr;                  /**< Remote Transmission Request of the last transmit operation. */
+    fmi3UInt16 dataLength;          /**< Data length of the last transmit operation. */
+    fmi3UInt64 transmitTime;        /**< Time of the last transmit operation in nanoseconds. */
+    fmi3UInt64 transmitted;         /**< Number of transmit operations. */
+    fmi3UInt64 confirmed;           /**< Number of confirm operations. */
+} fmi3LsBusUtilCanTelemetryId;
+
+/**
+ * \brief Telemetry of a CAN bus.
+ *
+ * A variable of this type must only be updated by a single thread. Bus simulations running on several threads
+ * keep one variable per thread and combine them using \ref FMI3_LS_BUS_CAN_TELEMETRY_MERGE when dumping them.
+ * The variable does not contain pointers, so it can also be dumped in binary form using `fwrite`.
+ */
+typedef struct
+{
+    fmi3LsBusCanBaudrate baudrate;                                   /**< Last configured CAN baud rate in bit/s. */
+    fmi3LsBusCanStatusKind status;                                   /**< Last reported CAN status. */
+    fmi3UInt64 startTime;                                            /**< Time of the first observed operation in nanoseconds. */
+    fmi3UInt64 endTime;                                              /**< Time of the last observed operation in nanoseconds. */
+    fmi3UInt64 busyBits;                                             /**< Nominal bits of all confirmed frames. */
+    fmi3UInt64 frames;                                               /**< Number of confirmed frames. */
+    fmi3UInt64 otherFrames;                                          /**< Confirmed frames of IDs not fitting into `ids`. */
+    fmi3UInt64 arbitrationLost;                                      /**< Number of Arbitration Lost operations. */
+    fmi3UInt64 busErrors[7];                                         /**< Number of Bus Error operations per error code. */
+    fmi3UInt64 statusTransitions[4];                                 /**< Number of changes to each CAN status. */
+    fmi3UInt64 latencyCount;                                         /**< Number of latencies recorded. */
+    fmi3UInt64 latencySum;                                           /**< Sum of latencies in nanoseconds. */
+    fmi3UInt64 latency[FMI3_LS_BUS_CAN_TELEMETRY_HISTOGRAM_SIZE];    /**< Latency histogram. */
+    fmi3LsBusUtilCanTelemetryId ids[FMI3_LS_BUS_CAN_TELEMETRY_IDS];  /**< Telemetry per CAN ID. */
+} fmi3LsBusUtilCanTelemetry;
+
+/**
+ * \brief Returns the nominal number of bits of a classic CAN frame including the interframe space, without stuff bits.
+ *
+ * \param[in] Ide         CAN message ID type (\ref fmi3LsBusCanIde).
+ * \param[in] Rtr         Remote Transmission Request (\ref fmi3LsBusCanRtr).
+ * \param[in] DataLength  Message data length (\ref fmi3LsBusCanDataLength).
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_FRAME_BITS(Ide, Rtr, DataLength)                                        \
+    ((fmi3UInt32)((Ide) ? 67 : 47) + ((Rtr) ? 0 : 8 * (fmi3UInt32)((DataLength) > 8 ? 8 : (DataLength))))
+
+/**
+ * \brief Returns the index of the histogram bucket of a latency in nanoseconds.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_INTERNAL(Value, Index)                                        \
+    do                                                                                                 \
+    {                                                                                                  \
+        const fmi3UInt64 _value = (Value);                                                             \
+        const unsigned _msb = _value < 4 ? 0 : 63 - (unsigned)__builtin_clzll(_value);                 \
+        (Index) = _value < 4 ? (size_t)_value : (size_t)(_msb - 1) * 4 + ((_value >> (_msb - 2)) & 3); \
+    }                                                                                                  \
+    while (0)
+#else
+#define FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_INTERNAL(Value, Index)                                        \
+    do                                                                                                 \
+    {                                                                                                  \
+        const fmi3UInt64 _value = (Value);                                                             \
+        unsigned _msb = 0;                                                                             \
+        while ((_value >> _msb) > 1)                                                                   \
+        {                                                                                              \
+            _msb++;                                                                                    \
+        }                                                                                              \
+        (Index) = _value < 4 ? (size_t)_value : (size_t)(_msb - 1) * 4 + ((_value >> (_msb - 2)) & 3); \
+    }                                                                                                  \
+    while (0)
+#endif
+
+/**
+ * \brief Returns the largest latency in nanoseconds counted in a histogram bucket.
+ *
+ * \param[in] Index  Index of the bucket.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_LIMIT(Index)                            \
+    ((Index) < 4 ? (fmi3UInt64)(Index)                                           \
+                 : ((fmi3UInt64)(4 + (Index) % 4 + 1) << ((Index) / 4 - 1)) - 1)
+
+/**
+ * \brief Looks up the telemetry entry of a CAN ID and inserts it if necessary.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_FIND_INTERNAL(Telemetry, Id, Entry)                      \
+    do                                                                                     \
+    {                                                                                      \
+        size_t _slot = (size_t)(((fmi3UInt32)(Id) * 0x9E3779B1U) >> 24);                   \
+        size_t _probe;                                                                     \
+        (Entry) = NULL;                                                                    \
+        for (_probe = 0; _probe < FMI3_LS_BUS_CAN_TELEMETRY_IDS; _probe++)                 \
+        {                                                                                  \
+            fmi3LsBusUtilCanTelemetryId* _candidate =                                      \
+                &(Telemetry)->ids[(_slot + _probe) & (FMI3_LS_BUS_CAN_TELEMETRY_IDS - 1)]; \
+            if (!_candidate->used)                                                         \
+            {                                                                              \
+                _candidate->used = fmi3True;                                               \
+                _candidate->id = (Id);                                                     \
+            }                                                                              \
+            if (_candidate->id == (Id))                                                    \
+            {                                                                              \
+                (Entry) = _candidate;                                                      \
+                break;                                                                     \
+            }                                                                              \
+        }                                                                                  \
+    }                                                                                      \
+    while (0)
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilCanTelemetry.
+ *
+ * \param[in] Telemetry  Pointer to \ref fmi3LsBusUtilCanTelemetry.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_INIT(Telemetry)                                    \
+    do                                                                               \
+    {                                                                                \
+        memset((Telemetry), 0, sizeof(fmi3LsBusUtilCanTelemetry));                   \
+        (Telemetry)->status = FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE; \
+        (Telemetry)->startTime = (fmi3UInt64)-1;                                     \
+    }                                                                                \
+    while (0)
+
+/**
+ * \brief Updates the telemetry with an operation passing the bus simulation.
+ *
+ * The bus simulation calls this macro for the transmit, arbitration lost, bus error, status and configuration
+ * operations received from the FMUs and for the confirm operations it creates. The latency of a frame is the time
+ * between its transmit operation and its confirm operation.
+ *
+ * Example:
+ * \code
+ * while (FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation))
+ * {
+ *     FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(&telemetry, operation, timeNs);
+ *     ...
+ * }
+ * \endcode
+ *
+ * \param[in] Telemetry  Pointer to \ref fmi3LsBusUtilCanTelemetry.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ * \param[in] Time       Simulation time in nanoseconds, not decreasing between calls.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(Telemetry, Operation, Time)                                               \
+    do                                                                                                              \
+    {                                                                                                               \
+        const fmi3UInt64 _time = (fmi3UInt64)(Time);                                                                \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                     \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);   \
+        fmi3LsBusUtilCanTelemetryId* _entry = NULL;                                                                 \
+        if ((Telemetry)->startTime > _time)                                                                         \
+        {                                                                                                           \
+            (Telemetry)->startTime = _time;                                                                         \
+        }                                                                                                           \
+        (Telemetry)->endTime = _time;                                                                               \
+        switch (FMI3_LS_BUS_GET_LE(_header->opCode))                                                                \
+        {                                                                                                           \
+            case FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT:                                                                   \
+                if (_opLength >= sizeof(fmi3LsBusCanOperationCanTransmit))                                          \
+                {                                                                                                   \
+                    const fmi3LsBusCanOperationCanTransmit* _tx = (const fmi3LsBusCanOperationCanTransmit*)_header; \
+                    FMI3_LS_BUS_CAN_TELEMETRY_FIND_INTERNAL((Telemetry), FMI3_LS_BUS_GET_LE(_tx->id), _entry);      \
+                    if (_entry != NULL)                                                                             \
+                    {                                                                                               \
+                        _entry->pending = fmi3True;                                                                 \
+                        _entry->ide = _tx->ide;                                                                     \
+                        _entry->rtr = _tx->rtr;                                                                     \
+                        _entry->dataLength = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_tx->dataLength);                       \
+                        _entry->transmitTime = _time;                                                               \
+                        _entry->transmitted++;                                                                      \
+                    }                                                                                               \
+                }                                                                                                   \
+                break;                                                                                              \
+            case FMI3_LS_BUS_CAN_OP_CONFIRM:                                                                        \
+                if (_opLength >= sizeof(fmi3LsBusCanOperationConfirm))                                              \
+                {                                                                                                   \
+                    const fmi3LsBusCanOperationConfirm* _confirm = (const fmi3LsBusCanOperationConfirm*)_header;    \
+                    FMI3_LS_BUS_CAN_TELEMETRY_FIND_INTERNAL((Telemetry), FMI3_LS_BUS_GET_LE(_confirm->id), _entry); \
+                    (Telemetry)->frames++;                                                                          \
+                    if (_entry == NULL)                                                                             \
+                    {                                                                                               \
+                        (Telemetry)->otherFrames++;                                                                 \
+                    }                                                                                               \
+                    else                                                                                            \
+                    {                                                                                               \
+                        _entry->confirmed++;                                                                        \
+                        (Telemetry)->busyBits +=                                                                    \
+                            FMI3_LS_BUS_CAN_TELEMETRY_FRAME_BITS(_entry->ide, _entry->rtr, _entry->dataLength);     \
+                    }                                                                                               \
+                    if (_entry != NULL && _entry->pending)                                                          \
+                    {                                                                                               \
+                        size_t _bucket;                                                                             \
+                        FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_INTERNAL(_time - _entry->transmitTime, _bucket);           \
+                        (Telemetry)->latency[_bucket]++;                                                            \
+                        (Telemetry)->latencyCount++;                                                                \
+                        (Telemetry)->latencySum += _time - _entry->transmitTime;                                    \
+                        _entry->pending = fmi3False;                                                                \
+                    }                                                                                               \
+                }                                                                                                   \
+                break;                                                                                              \
+            case FMI3_LS_BUS_CAN_OP_ARBITRATION_LOST:                                                               \
+                (Telemetry)->arbitrationLost++;                                                                     \
+                break;                                                                                              \
+            case FMI3_LS_BUS_CAN_OP_BUS_ERROR:                                                                      \
+                if (_opLength >= sizeof(fmi3LsBusCanOperationBusError))                                             \
+                {                                                                                                   \
+                    const fmi3LsBusCanOperationBusError* _error = (const fmi3LsBusCanOperationBusError*)_header;    \
+                    (Telemetry)->busErrors[_error->errorCode < 7 ? _error->errorCode : 0]++;                        \
+                }                                                                                                   \
+                break;                                                                                              \
+            case FMI3_LS_BUS_CAN_OP_STATUS:                                                                         \
+                if (_opLength >= sizeof(fmi3LsBusCanOperationStatus))                                               \
+                {                                                                                                   \
+                    const fmi3LsBusCanOperationStatus* _status = (const fmi3LsBusCanOperationStatus*)_header;       \
+                    if (_status->status != (Telemetry)->status && _status->status < 4)                              \
+                    {                                                                                               \
+                        (Telemetry)->status = _status->status;                                                      \
+                        (Telemetry)->statusTransitions[_status->status]++;                                          \
+                    }                                                                                               \
+                }                                                                                                   \
+                break;                                                                                              \
+            case FMI3_LS_BUS_CAN_OP_CONFIGURATION:                                                                  \
+                if (_opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanConfigParameterType) +       \
+                                 sizeof(fmi3LsBusCanBaudrate))                                                      \
+                {                                                                                                   \
+                    const fmi3LsBusCanOperationConfiguration* _config =                                             \
+                        (const fmi3LsBusCanOperationConfiguration*)_header;                                         \
+                    if (_config->parameterType == FMI3_LS_BUS_CAN_CONFIG_PARAM_TYPE_CAN_BAUDRATE)                   \
+                    {                                                                                               \
+                        (Telemetry)->baudrate = (fmi3LsBusCanBaudrate)FMI3_LS_BUS_GET_LE(_config->baudrate);        \
+                    }                                                                                               \
+                }                                                                                                   \
+                break;                                                                                              \
+            default:                                                                                                \
+                break;                                                                                              \
+        }                                                                                                           \
+    }                                                                                                               \
+    while (0)
+
+/**
+ * \brief Adds the counters of one telemetry variable to another, e.g. to combine the variables of several threads.
+ *
+ * \param[in] Destination  Pointer to \ref fmi3LsBusUtilCanTelemetry receiving the sum.
+ * \param[in] Source       Pointer to \ref fmi3LsBusUtilCanTelemetry.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_MERGE(Destination, Source)                                 \
+    do                                                                                       \
+    {                                                                                        \
+        size_t _i;                                                                           \
+        if ((Source)->startTime < (Destination)->startTime)                                  \
+        {                                                                                    \
+            (Destination)->startTime = (Source)->startTime;                                  \
+        }                                                                                    \
+        if ((Source)->endTime > (Destination)->endTime)                                      \
+        {                                                                                    \
+            (Destination)->endTime = (Source)->endTime;                                      \
+            (Destination)->status = (Source)->status;                                        \
+        }                                                                                    \
+        if ((Destination)->baudrate == 0)                                                    \
+        {                                                                                    \
+            (Destination)->baudrate = (Source)->baudrate;                                    \
+        }                                                                                    \
+        (Destination)->busyBits += (Source)->busyBits;                                       \
+        (Destination)->frames += (Source)->frames;                                           \
+        (Destination)->otherFrames += (Source)->otherFrames;                                 \
+        (Destination)->arbitrationLost += (Source)->arbitrationLost;                         \
+        (Destination)->latencyCount += (Source)->latencyCount;                               \
+        (Destination)->latencySum += (Source)->latencySum;                                   \
+        for (_i = 0; _i < 7; _i++)                                                           \
+        {                                                                                    \
+            (Destination)->busErrors[_i] += (Source)->busErrors[_i];                         \
+        }                                                                                    \
+        for (_i = 0; _i < 4; _i++)                                                           \
+        {                                                                                    \
+            (Destination)->statusTransitions[_i] += (Source)->statusTransitions[_i];         \
+        }                                                                                    \
+        for (_i = 0; _i < FMI3_LS_BUS_CAN_TELEMETRY_HISTOGRAM_SIZE; _i++)                    \
+        {                                                                                    \
+            (Destination)->latency[_i] += (Source)->latency[_i];                             \
+        }                                                                                    \
+        for (_i = 0; _i < FMI3_LS_BUS_CAN_TELEMETRY_IDS; _i++)                               \
+        {                                                                                    \
+            const fmi3LsBusUtilCanTelemetryId* _source = &(Source)->ids[_i];                 \
+            fmi3LsBusUtilCanTelemetryId* _entry = NULL;                                      \
+            if (_source->used)                                                               \
+            {                                                                                \
+                FMI3_LS_BUS_CAN_TELEMETRY_FIND_INTERNAL((Destination), _source->id, _entry); \
+                if (_entry == NULL)                                                          \
+                {                                                                            \
+                    (Destination)->otherFrames += _source->confirmed;                        \
+                }                                                                            \
+                else                                                                         \
+                {                                                                            \
+                    _entry->transmitted += _source->transmitted;                             \
+                    _entry->confirmed += _source->confirmed;                                 \
+                }                                                                            \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+    while (0)
+
+/**
+ * \brief Returns the bus utilization between the first and the last observed operation, from 0.0 to 1.0.
+ *
+ * \param[in] Telemetry  Pointer to \ref fmi3LsBusUtilCanTelemetry.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_UTILIZATION(Telemetry)                                                            \
+    ((Telemetry)->baudrate == 0 || (Telemetry)->endTime <= (Telemetry)->startTime                                   \
+         ? 0.0                                                                                                      \
+         : (fmi3Float64)(Telemetry)->busyBits * 1e9 /                                                               \
+               ((fmi3Float64)(Telemetry)->baudrate * (fmi3Float64)((Telemetry)->endTime - (Telemetry)->startTime)))
+
+/**
+ * \brief Appends formatted text to a character buffer.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL(Text, TextSize, Length, ...)                   \
+    do                                                                                          \
+    {                                                                                           \
+        int _printed;                                                                           \
+        if ((Length) < (size_t)(TextSize))                                                      \
+        {                                                                                       \
+            _printed = snprintf((Text) + (Length), (size_t)(TextSize) - (Length), __VA_ARGS__); \
+        }                                                                                       \
+        else                                                                                    \
+        {                                                                                       \
+            _printed = snprintf(NULL, 0, __VA_ARGS__);                                          \
+        }                                                                                       \
+        (Length) += _printed > 0 ? (size_t)_printed : 0;                                        \
+    }                                                                                           \
+    while (0)
+
+/**
+ * \brief Formats the telemetry in the Prometheus text exposition format.
+ *
+ * The text is zero-terminated. `Length` receives the length of the complete text without the terminating zero.
+ * If `Length` is not less than `TextSize`, the text was truncated to `TextSize - 1` characters and a buffer of
+ * `Length + 1` characters is required.
+ *
+ * Example:
+ * \code
+ * char text[16384];
+ * size_t length;
+ * FMI3_LS_BUS_CAN_TELEMETRY_FORMAT_PROMETHEUS(&telemetry, "powertrain", text, sizeof(text), length);
+ * FILE* file = fopen("can_telemetry.prom", "w");
+ * fwrite(text, 1, length < sizeof(text) ? length : sizeof(text) - 1, file);
+ * fclose(file);
+ * \endcode
+ *
+ * \param[in]  Telemetry  Pointer to \ref fmi3LsBusUtilCanTelemetry.
+ * \param[in]  Bus        Zero-terminated name of the bus used as label.
+ * \param[out] Text       Character buffer receiving the text.
+ * \param[in]  TextSize   Size of the character buffer.
+ * \param[out] Length     Variable of type size_t receiving the length of the text.
+ */
+#define FMI3_LS_BUS_CAN_TELEMETRY_FORMAT_PROMETHEUS(Telemetry, Bus, Text, TextSize, Length)                        \
+    do                                                                                                             \
+    {                                                                                                              \
+        static const char* const _statusNames[4] = { "unknown", "error_active", "error_passive", "bus_off" };      \
+        fmi3UInt64 _cumulative = 0;                                                                                \
+        size_t _i;                                                                                                 \
+        (Length) = 0;                                                                                              \
+        if ((size_t)(TextSize) > 0)                                                                                \
+        {                                                                                                          \
+            (Text)[0] = '\0';                                                                                      \
+        }                                                                                                          \
+        FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                                     \
+            "fmi3_ls_bus_can_utilization{bus=\"%s\"} %.6f\n"                                                       \
+            "fmi3_ls_bus_can_frames_total{bus=\"%s\"} %llu\n"                                                      \
+            "fmi3_ls_bus_can_arbitration_lost_total{bus=\"%s\"} %llu\n",                                           \
+            (Bus), FMI3_LS_BUS_CAN_TELEMETRY_UTILIZATION(Telemetry), (Bus),                                        \
+            (unsigned long long)(Telemetry)->frames, (Bus), (unsigned long long)(Telemetry)->arbitrationLost);     \
+        FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                                     \
+            "fmi3_ls_bus_can_bus_errors_total{bus=\"%s\",code=\"unknown\"} %llu\n",                                \
+            (Bus), (unsigned long long)(Telemetry)->busErrors[0]);                                                 \
+        for (_i = 1; _i < 7; _i++)                                                                                 \
+        {                                                                                                          \
+            FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                                 \
+                "fmi3_ls_bus_can_bus_errors_total{bus=\"%s\",code=\"%u\"} %llu\n",                                 \
+                (Bus), (unsigned)_i, (unsigned long long)(Telemetry)->busErrors[_i]);                              \
+        }                                                                                                          \
+        for (_i = 1; _i < 4; _i++)                                                                                 \
+        {                                                                                                          \
+            FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                                 \
+                "fmi3_ls_bus_can_status_transitions_total{bus=\"%s\",status=\"%s\"} %llu\n",                       \
+                (Bus), _statusNames[_i], (unsigned long long)(Telemetry)->statusTransitions[_i]);                  \
+        }                                                                                                          \
+        for (_i = 0; _i < FMI3_LS_BUS_CAN_TELEMETRY_IDS; _i++)                                                     \
+        {                                                                                                          \
+            if ((Telemetry)->ids[_i].used)                                                                         \
+            {                                                                                                      \
+                FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                             \
+                    "fmi3_ls_bus_can_id_frames_total{bus=\"%s\",id=\"0x%X\"} %llu\n",                              \
+                    (Bus), (unsigned)(Telemetry)->ids[_i].id, (unsigned long long)(Telemetry)->ids[_i].confirmed); \
+            }                                                                                                      \
+        }                                                                                                          \
+        for (_i = 0; _i < FMI3_LS_BUS_CAN_TELEMETRY_HISTOGRAM_SIZE; _i++)                                          \
+        {                                                                                                          \
+            _cumulative += (Telemetry)->latency[_i];                                                               \
+            if ((Telemetry)->latency[_i] != 0)                                                                     \
+            {                                                                                                      \
+                FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                             \
+                    "fmi3_ls_bus_can_latency_seconds_bucket{bus=\"%s\",le=\"%.9g\"} %llu\n",                       \
+                    (Bus), (fmi3Float64)FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_LIMIT(_i) * 1e-9,                         \
+                    (unsigned long long)_cumulative);                                                              \
+            }                                                                                                      \
+        }                                                                                                          \
+        FMI3_LS_BUS_CAN_TELEMETRY_PRINT_INTERNAL((Text), (TextSize), (Length),                                     \
+            "fmi3_ls_bus_can_latency_seconds_bucket{bus=\"%s\",le=\"+Inf\"} %llu\n"                                \
+            "fmi3_ls_bus_can_latency_seconds_sum{bus=\"%s\"} %.9g\n"                                               \
+            "fmi3_ls_bus_can_latency_seconds_count{bus=\"%s\"} %llu\n",                                            \
+            (Bus), (unsigned long long)(Telemetry)->latencyCount, (Bus),                                           \
+            (fmi3Float64)(Telemetry)->latencySum * 1e-9, (Bus), (unsigned long long)(Telemetry)->latencyCount);    \
+    }                                                                                                              \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilCanTelemetry_h */
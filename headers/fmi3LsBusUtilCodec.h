@@ -0,0 +1,363 @@
+#ifndef fmi3LsBusUtilCodec_h
+#define fmi3LsBusUtilCodec_h
+
+/*
+This header file contains utility macros to compress streams of FMI-LS-BUS operations,
+e.g. for recordings or bus bridges. CAN transmit operations are encoded with delta-encoded
+IDs and frames repeating the last payload of their ID are replaced by a single byte
+referring to a dictionary. All other operations are stored unchanged.
+
+This header can be used when creating importers or tools recording bus traffic.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Number of entries of the payload dictionary, must be a power of 2 not greater than 128.
+ */
+#ifndef FMI3_LS_BUS_CODEC_DICTIONARY_SIZE
+#define FMI3_LS_BUS_CODEC_DICTIONARY_SIZE 64
+#endif
+
+#if FMI3_LS_BUS_CODEC_DICTIONARY_SIZE > 128 || (FMI3_LS_BUS_CODEC_DICTIONARY_SIZE & (FMI3_LS_BUS_CODEC_DICTIONARY_SIZE - 1)) != 0
+#error "FMI3_LS_BUS_CODEC_DICTIONARY_SIZE must be a power of 2 not greater than 128"
+#endif
+
+/**
+ * \brief Tags of the encoded records. A tag with the highest bit set refers to the dictionary entry
+ *        given by the remaining bits.
+ *
+ * \note These macros are reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CODEC_TAG_RAW_INTERNAL 0x00
+#define FMI3_LS_BUS_CODEC_TAG_CAN_TRANSMIT_INTERNAL 0x01
+#define FMI3_LS_BUS_CODEC_TAG_CAN_REPEAT_INTERNAL 0x80
+
+/**
+ * \brief Returns the dictionary entry index of a CAN ID.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CODEC_SLOT_INTERNAL(Id)                                              \
+    ((((fmi3UInt32)(Id) * 0x9E3779B1U) >> 24) & (FMI3_LS_BUS_CODEC_DICTIONARY_SIZE - 1))
+
+/**
+ * \brief Entry of the payload dictionary holding the last CAN transmit operation of a CAN ID.
+ */
+typedef struct
+{
+    fmi3LsBusCanId id;
+    fmi3UInt8 flags;
+    fmi3UInt8 dataLength;
+    fmi3UInt8 data[8];
+} fmi3LsBusUtilCodecEntry;
+
+/**
+ * \brief State of an encoder or decoder. Encoder and decoder of a stream must start with the same state.
+ */
+typedef struct
+{
+    fmi3LsBusCanId lastId;                                                 /**< ID of the last CAN transmit operation. */
+    fmi3LsBusUtilCodecEntry dictionary[FMI3_LS_BUS_CODEC_DICTIONARY_SIZE]; /**< Last CAN transmit operation per slot. */
+} fmi3LsBusUtilCodec;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilCodec.
+ *
+ * \param[in] Codec  Pointer to \ref fmi3LsBusUtilCodec.
+ */
+#define FMI3_LS_BUS_CODEC_INIT(Codec)                   \
+    do                                                  \
+    {                                                   \
+        memset((Codec), 0, sizeof(fmi3LsBusUtilCodec)); \
+    }                                                   \
+    while (0)
+
+/**
+ * \brief Writes an unsigned LEB128 encoded integer.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CODEC_WRITE_VARINT_INTERNAL(Pos, Value) \
+    do                                                      \
+    {                                                       \
+        fmi3UInt32 _varint = (Value);                       \
+        while (_varint >= 0x80)                             \
+        {                                                   \
+            *(Pos)++ = (fmi3UInt8)(_varint | 0x80);         \
+            _varint >>= 7;                                  \
+        }                                                   \
+        *(Pos)++ = (fmi3UInt8)_varint;                      \
+    }                                                       \
+    while (0)
+
+/**
+ * \brief Reads an unsigned LEB128 encoded integer, `Valid` is set to fmi3False if the input is truncated.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_CODEC_READ_VARINT_INTERNAL(Pos, End, Value, Valid) \
+    do                                                                 \
+    {                                                                  \
+        fmi3UInt32 _shift = 0;                                         \
+        (Value) = 0;                                                   \
+        (Valid) = fmi3False;                                           \
+        while ((Pos) < (End) && _shift < 35)                           \
+        {                                                              \
+            const fmi3UInt8 _byte = *(Pos)++;                          \
+            (Value) |= (fmi3UInt32)(_byte & 0x7F) << _shift;           \
+            if ((_byte & 0x80) == 0)                                   \
+            {                                                          \
+                (Valid) = fmi3True;                                    \
+                break;                                                 \
+            }                                                          \
+            _shift += 7;                                               \
+        }                                                              \
+    }                                                                  \
+    while (0)
+
+/**
+ * \brief Encodes the unread operations of a buffer.
+ *
+ * The operations starting at the read position of `InBufferInfo` are encoded and appended to `OutBufferInfo`.
+ * The read position of `InBufferInfo` is advanced to the first operation not encoded. If there is not enough
+ * buffer space available or an operation is malformed, the 'status' variable of the argument 'OutBufferInfo'
+ * is set to fmi3False. Encoding can be continued after making space available in 'OutBufferInfo'.
+ * Buffer statistics of 'OutBufferInfo' only count overflows, since the encoded stream does not consist of operations.
+ *
+ * \param[in] Codec          Pointer to \ref fmi3LsBusUtilCodec of the encoder.
+ * \param[in] InBufferInfo   Pointer to \ref fmi3LsBusUtilBufferInfo holding the operations.
+ * \param[in] OutBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the encoded stream.
+ */
+#define FMI3_LS_BUS_CODEC_ENCODE(Codec, InBufferInfo, OutBufferInfo)                                                 \
+    do                                                                                                               \
+    {                                                                                                                \
+        while ((OutBufferInfo)->status &&                                                                            \
+               (size_t)((InBufferInfo)->writePos - (InBufferInfo)->readPos) >= sizeof(fmi3LsBusOperationHeader))     \
+        {                                                                                                            \
+            const fmi3UInt8* _in = (InBufferInfo)->readPos;                                                          \
+            const fmi3UInt32 _opCode = FMI3_LS_BUS_LOAD_LE32(_in);                                                   \
+            const fmi3UInt32 _opLength = FMI3_LS_BUS_LOAD_LE32(_in + sizeof(fmi3LsBusOperationCode));                \
+            const size_t _space = (size_t)((OutBufferInfo)->end - (OutBufferInfo)->writePos);                        \
+            const fmi3LsBusCanOperationCanTransmit* _tx = NULL;                                                      \
+            if (_opLength < sizeof(fmi3LsBusOperationHeader) ||                                                      \
+                _opLength > (size_t)((InBufferInfo)->writePos - _in))                                                \
+            {                                                                                                        \
+                (OutBufferInfo)->status = fmi3False;                                                                 \
+                break;                                                                                               \
+            }                                                                                                        \
+            if (_opCode == FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT && _opLength >= sizeof(fmi3LsBusCanOperationCanTransmit)) \
+            {                                                                                                        \
+                _tx = (const fmi3LsBusCanOperationCanTransmit*)_in;                                                  \
+                if (FMI3_LS_BUS_GET_LE(_tx->dataLength) > 8 || _tx->ide > 1 || _tx->rtr > 1 ||                       \
+                    _opLength != sizeof(fmi3LsBusCanOperationCanTransmit) + FMI3_LS_BUS_GET_LE(_tx->dataLength))     \
+                {                                                                                                    \
+                    _tx = NULL;                                                                                      \
+                }                                                                                                    \
+            }                                                                                                        \
+            if (_tx != NULL)                                                                                         \
+            {                                                                                                        \
+                const fmi3LsBusCanId _id = (fmi3LsBusCanId)FMI3_LS_BUS_GET_LE(_tx->id);                              \
+                const fmi3UInt8 _flags = (fmi3UInt8)(_tx->ide | (_tx->rtr << 1));                                    \
+                const fmi3UInt8 _dataLength = (fmi3UInt8)FMI3_LS_BUS_GET_LE(_tx->dataLength);                        \
+                const fmi3UInt32 _slot = FMI3_LS_BUS_CODEC_SLOT_INTERNAL(_id);                                       \
+                fmi3LsBusUtilCodecEntry* _entry = &(Codec)->dictionary[_slot];                                       \
+                if (_entry->id == _id && _entry->flags == _flags && _entry->dataLength == _dataLength &&             \
+                    memcmp(_entry->data, _tx->data, _dataLength) == 0)                                               \
+                {                                                                                                    \
+                    if (_space < 1)                                                                                  \
+                    {                                                                                                \
+                        (OutBufferInfo)->status = fmi3False;                                                         \
+                        FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                     \
+                        break;                                                                                       \
+                    }                                                                                                \
+                    *(OutBufferInfo)->writePos++ = (fmi3UInt8)(FMI3_LS_BUS_CODEC_TAG_CAN_REPEAT_INTERNAL | _slot);   \
+                }                                                                                                    \
+                else                                                                                                 \
+                {                                                                                                    \
+                    const fmi3UInt32 _delta = _id - (Codec)->lastId;                                                 \
+                    if (_space < 1 + 5 + 2 + (size_t)_dataLength)                                                    \
+                    {                                                                                                \
+                        (OutBufferInfo)->status = fmi3False;                                                         \
+                        FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                     \
+                        break;                                                                                       \
+                    }                                                                                                \
+                    *(OutBufferInfo)->writePos++ = FMI3_LS_BUS_CODEC_TAG_CAN_TRANSMIT_INTERNAL;                      \
+                    FMI3_LS_BUS_CODEC_WRITE_VARINT_INTERNAL((OutBufferInfo)->writePos,                               \
+                                                            (_delta << 1) ^ (fmi3UInt32)((fmi3Int32)_delta >> 31));  \
+                    *(OutBufferInfo)->writePos++ = _flags;                                                           \
+                    *(OutBufferInfo)->writePos++ = _dataLength;                                                      \
+                    memcpy((OutBufferInfo)->writePos, _tx->data, _dataLength);                                       \
+                    (OutBufferInfo)->writePos += _dataLength;                                                        \
+                    _entry->id = _id;                                                                                \
+                    _entry->flags = _flags;                                                                          \
+                    _entry->dataLength = _dataLength;                                                                \
+                    memcpy(_entry->data, _tx->data, _dataLength);                                                    \
+                }                                                                                                    \
+                (Codec)->lastId = _id;                                                                               \
+            }                                                                                                        \
+            else                                                                                                     \
+            {                                                                                                        \
+                if (_space < 1 + 5 + (size_t)_opLength)                                                              \
+                {                                                                                                    \
+                    (OutBufferInfo)->status = fmi3False;                                                             \
+                    FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                         \
+                    break;                                                                                           \
+                }                                                                                                    \
+                *(OutBufferInfo)->writePos++ = FMI3_LS_BUS_CODEC_TAG_RAW_INTERNAL;                                   \
+                FMI3_LS_BUS_CODEC_WRITE_VARINT_INTERNAL((OutBufferInfo)->writePos, _opLength);                       \
+                memcpy((OutBufferInfo)->writePos, _in, _opLength);                                                   \
+                (OutBufferInfo)->writePos += _opLength;                                                              \
+            }                                                                                                        \
+            (InBufferInfo)->readPos += _opLength;                                                                    \
+        }                                                                                                            \
+    }                                                                                                                \
+    while (0)
+
+/**
+ * \brief Decodes an encoded stream.
+ *
+ * The encoded stream starting at the read position of `InBufferInfo` is decoded and the operations are appended
+ * to `OutBufferInfo`. The read position of `InBufferInfo` is advanced to the first record not decoded. If there is
+ * not enough buffer space available or the stream is malformed, the 'status' variable of the argument
+ * 'OutBufferInfo' is set to fmi3False. Decoding can be continued after making space available in 'OutBufferInfo'.
+ *
+ * \param[in] Codec          Pointer to \ref fmi3LsBusUtilCodec of the decoder.
+ * \param[in] InBufferInfo   Pointer to \ref fmi3LsBusUtilBufferInfo holding the encoded stream.
+ * \param[in] OutBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving the operations.
+ */
+#define FMI3_LS_BUS_CODEC_DECODE(Codec, InBufferInfo, OutBufferInfo)                                                      \
+    do                                                                                                                    \
+    {                                                                                                                     \
+        while ((OutBufferInfo)->status && (InBufferInfo)->readPos < (InBufferInfo)->writePos)                             \
+        {                                                                                                                 \
+            const fmi3UInt8* _in = (InBufferInfo)->readPos;                                                               \
+            const fmi3UInt8* _inEnd = (InBufferInfo)->writePos;                                                           \
+            const size_t _space = (size_t)((OutBufferInfo)->end - (OutBufferInfo)->writePos);                             \
+            const fmi3UInt8 _tag = *_in++;                                                                                \
+            fmi3LsBusUtilCodecEntry* _entry = NULL;                                                                       \
+            fmi3UInt32 _value = 0;                                                                                        \
+            fmi3Boolean _valid = fmi3True;                                                                                \
+            if ((_tag & FMI3_LS_BUS_CODEC_TAG_CAN_REPEAT_INTERNAL) != 0)                                                  \
+            {                                                                                                             \
+                _valid = (fmi3UInt32)(_tag & 0x7F) < FMI3_LS_BUS_CODEC_DICTIONARY_SIZE;                                   \
+                _entry = _valid ? &(Codec)->dictionary[_tag & 0x7F] : NULL;                                               \
+            }                                                                                                             \
+            else if (_tag == FMI3_LS_BUS_CODEC_TAG_RAW_INTERNAL)                                                          \
+            {                                                                                                             \
+                FMI3_LS_BUS_CODEC_READ_VARINT_INTERNAL(_in, _inEnd, _value, _valid);                                      \
+                _valid = _valid && _value >= sizeof(fmi3LsBusOperationHeader) && _value <= (size_t)(_inEnd - _in) &&      \
+                         _value == FMI3_LS_BUS_LOAD_LE32(_in + sizeof(fmi3LsBusOperationCode));                           \
+                if (_valid && _value > _space)                                                                            \
+                {                                                                                                         \
+                    (OutBufferInfo)->status = fmi3False;                                                                  \
+                    FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                              \
+                    break;                                                                                                \
+                }                                                                                                         \
+                if (_valid)                                                                                               \
+                {                                                                                                         \
+                    memcpy((OutBufferInfo)->writePos, _in, _value);                                                       \
+                    (OutBufferInfo)->writePos += _value;                                                                  \
+                    FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL((OutBufferInfo), _value);                                       \
+                    _in += _value;                                                                                        \
+                }                                                                                                         \
+            }                                                                                                             \
+            else if (_tag == FMI3_LS_BUS_CODEC_TAG_CAN_TRANSMIT_INTERNAL)                                                 \
+            {                                                                                                             \
+                fmi3LsBusCanId _id = 0;                                                                                   \
+                FMI3_LS_BUS_CODEC_READ_VARINT_INTERNAL(_in, _inEnd, _value, _valid);                                      \
+                _id = (Codec)->lastId + ((_value >> 1) ^ (0U - (_value & 1U)));                                           \
+                _valid = _valid && _inEnd - _in >= 2 && _in[1] <= 8 && (size_t)(_inEnd - _in) >= 2U + _in[1];             \
+                if (_valid && sizeof(fmi3LsBusCanOperationCanTransmit) + _in[1] > _space)                                 \
+                {                                                                                                         \
+                    (OutBufferInfo)->status = fmi3False;                                                                  \
+                    FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                              \
+                    break;                                                                                                \
+                }                                                                                                         \
+                if (_valid)                                                                                               \
+                {                                                                                                         \
+                    _entry = &(Codec)->dictionary[FMI3_LS_BUS_CODEC_SLOT_INTERNAL(_id)];                                  \
+                    _entry->id = _id;                                                                                     \
+                    _entry->flags = _in[0];                                                                               \
+                    _entry->dataLength = _in[1];                                                                          \
+                    memcpy(_entry->data, _in + 2, _entry->dataLength);                                                    \
+                    _in += 2 + _entry->dataLength;                                                                        \
+                }                                                                                                         \
+            }                                                                                                             \
+            else                                                                                                          \
+            {                                                                                                             \
+                _valid = fmi3False;                                                                                       \
+            }                                                                                                             \
+            if (!_valid)                                                                                                  \
+            {                                                                                                             \
+                (OutBufferInfo)->status = fmi3False;                                                                      \
+                break;                                                                                                    \
+            }                                                                                                             \
+            if (_entry != NULL)                                                                                           \
+            {                                                                                                             \
+                if (sizeof(fmi3LsBusCanOperationCanTransmit) + _entry->dataLength > _space)                               \
+                {                                                                                                         \
+                    (OutBufferInfo)->status = fmi3False;                                                                  \
+                    FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                              \
+                    break;                                                                                                \
+                }                                                                                                         \
+                FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT((OutBufferInfo), _entry->id, (fmi3LsBusCanIde)(_entry->flags & 1), \
+                                                       (fmi3LsBusCanRtr)((_entry->flags >> 1) & 1), _entry->dataLength,   \
+                                                       _entry->data);                                                     \
+                (Codec)->lastId = _entry->id;                                                                             \
+            }                                                                                                             \
+            (InBufferInfo)->readPos = (fmi3UInt8*)_in;                                                                    \
+        }                                                                                                                 \
+    }                                                                                                                     \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilCodec_h */
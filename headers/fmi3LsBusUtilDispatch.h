@@ -0,0 +1,239 @@
+#ifndef fmi3LsBusUtilDispatch_h
+#define fmi3LsBusUtilDispatch_h
+
+/*
+This header file contains utility macros to dispatch received bus operations to
+handler functions registered per operation code.
+
+This header can be used when creating Network FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtil.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Highest operation code supported by the dispatch table.
+ */
+#define FMI3_LS_BUS_DISPATCH_MAX_OP_CODE 0x0050
+
+/**
+ * \brief Function type of operation handlers called by \ref FMI3_LS_BUS_DISPATCH.
+ *
+ * Handlers are usually defined using \ref FMI3_LS_BUS_DISPATCH_DEFINE_HANDLER.
+ *
+ * \param[in] context       The context pointer of the dispatcher.
+ * \param[in] operation     The received operation.
+ * \param[in] txBufferInfo  The buffer to submit response operations to.
+ * \return                  fmi3True if the operation was processed, fmi3False if it is malformed and shall be
+ *                          answered with a Format Error operation by \ref FMI3_LS_BUS_DISPATCH.
+ */
+typedef fmi3Boolean (*fmi3LsBusUtilDispatchHandler)(void* context,
+                                                    const fmi3LsBusOperationHeader* operation,
+                                                    fmi3LsBusUtilBufferInfo* txBufferInfo);
+
+/**
+ * \brief This data type holds a dense table of operation handlers indexed by operation code.
+ */
+typedef struct
+{
+    fmi3LsBusUtilDispatchHandler handlers[FMI3_LS_BUS_DISPATCH_MAX_OP_CODE + 1]; /**< Handlers indexed by operation code. */
+    void* context;                                                              /**< Context pointer passed to the handlers. */
+    fmi3UInt32 formatErrors;                                                    /**< Number of Format Error operations created. */
+    fmi3UInt32 droppedFormatErrors;                                             /**< Number of Format Error operations not fitting into the Tx buffer. */
+} fmi3LsBusUtilDispatcher;
+
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilDispatcher without any registered handler.
+ *
+ * \param[in] Dispatcher  Pointer to variable of type \ref fmi3LsBusUtilDispatcher.
+ * \param[in] Context     Context pointer passed to the handlers, e.g. the instance of the FMU.
+ */
+#define FMI3_LS_BUS_DISPATCH_INIT(Dispatcher, Context)            \
+    do                                                            \
+    {                                                             \
+        memset((Dispatcher), 0, sizeof(fmi3LsBusUtilDispatcher)); \
+        (Dispatcher)->context = (void*)(Context);                 \
+    }                                                             \
+    while (0)
+
+/**
+ * \brief Registers the handler for the specified operation code.
+ *
+ * Operation codes greater than \ref FMI3_LS_BUS_DISPATCH_MAX_OP_CODE are ignored.
+ *
+ * \param[in] Dispatcher  Pointer to variable of type \ref fmi3LsBusUtilDispatcher.
+ * \param[in] OpCode      Operation code (\ref fmi3LsBusOperationCode).
+ * \param[in] Handler     Handler of type \ref fmi3LsBusUtilDispatchHandler or NULL to remove the handler.
+ */
+#define FMI3_LS_BUS_DISPATCH_REGISTER(Dispatcher, OpCode, Handler)                \
+    do                                                                            \
+    {                                                                             \
+        if ((fmi3LsBusOperationCode)(OpCode) <= FMI3_LS_BUS_DISPATCH_MAX_OP_CODE) \
+        {                                                                         \
+            (Dispatcher)->handlers[(OpCode)] = (Handler);                         \
+        }                                                                         \
+    }                                                                             \
+    while (0)
+
+/**
+ * \brief Defines a static handler function receiving a typed pointer to the operation.
+ *
+ * The macro is followed by the body of the handler, which can access the parameters `context`, `operation`
+ * (of type `const OperationType*`) and `txBufferInfo`. Operations shorter than the fixed part of
+ * `OperationType` are rejected without calling the body, so they are answered with a Format Error operation.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_DISPATCH_DEFINE_HANDLER(OnCanTransmit, fmi3LsBusCanOperationCanTransmit)
+ * {
+ *     FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(txBufferInfo, operation->id);
+ * }
+ * ...
+ * FMI3_LS_BUS_DISPATCH_REGISTER(&dispatcher, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, OnCanTransmit);
+ * \endcode
+ *
+ * \param[in] Name           Name of the handler function.
+ * \param[in] OperationType  Structure type of the operation, e.g. \ref fmi3LsBusCanOperationCanTransmit.
+ */
+#define FMI3_LS_BUS_DISPATCH_DEFINE_HANDLER(Name, OperationType)                                                             \
+    static void Name##_Typed(void* context, const OperationType* operation, fmi3LsBusUtilBufferInfo* txBufferInfo);          \
+    static fmi3Boolean Name(void* context, const fmi3LsBusOperationHeader* operation, fmi3LsBusUtilBufferInfo* txBufferInfo) \
+    {                                                                                                                        \
+        if (FMI3_LS_BUS_GET_LE(operation->length) < sizeof(OperationType))                                                   \
+        {                                                                                                                    \
+            return fmi3False;                                                                                                \
+        }                                                                                                                    \
+        Name##_Typed(context, (const OperationType*)operation, txBufferInfo);                                                \
+        return fmi3True;                                                                                                     \
+    }                                                                                                                        \
+    static void Name##_Typed(void* context, const OperationType* operation, fmi3LsBusUtilBufferInfo* txBufferInfo)
+
+/**
+ * \brief Answers malformed data with a Format Error operation containing at most its first 65535 bytes.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_DISPATCH_FORMAT_ERROR_INTERNAL(Dispatcher, TxBufferInfo, Length, Data)                      \
+    do                                                                                                          \
+    {                                                                                                           \
+        const fmi3LsBusDataLength _echoLength = (fmi3LsBusDataLength)((Length) < 0xFFFFU ? (Length) : 0xFFFFU); \
+        FMI3_LS_BUS_CREATE_OP_FORMAT_ERROR((TxBufferInfo), _echoLength, (Data));                                \
+        if ((TxBufferInfo)->status)                                                                             \
+        {                                                                                                       \
+            (Dispatcher)->formatErrors++;                                                                       \
+        }                                                                                                       \
+        else                                                                                                    \
+        {                                                                                                       \
+            (Dispatcher)->droppedFormatErrors++;                                                                \
+        }                                                                                                       \
+    }                                                                                                           \
+    while (0)
+
+/**
+ * \brief Reads all operations from the Rx buffer and calls the registered handlers.
+ *
+ * Each operation is dispatched by a single lookup in the handler table. Operations without a registered handler
+ * or rejected by their handler are answered with a Format Error operation containing the operation, truncated to
+ * 65535 bytes. Format Error operations not fitting into the Tx buffer are counted in `droppedFormatErrors`.
+ * Received Format Error operations are never answered with a Format Error operation.
+ * An operation length shorter than the operation header or exceeding the remaining data makes the framing of the
+ * remaining data unreliable: it is answered with a single Format Error operation containing the remaining data,
+ * which is discarded.
+ *
+ * Example:
+ * \code
+ * fmi3SetBinary(..., const size_t valueSizes[], const fmi3Binary values[], ...)
+ * {
+ *     ...
+ *     FMI3_LS_BUS_BUFFER_WRITE(&rxBufferInfo, values[0], valueSizes[0]);
+ *     FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+ * }
+ * \endcode
+ *
+ * \param[in] Dispatcher    Pointer to variable of type \ref fmi3LsBusUtilDispatcher.
+ * \param[in] RxBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo holding the received operations.
+ * \param[in] TxBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo receiving response operations.
+ */
+#define FMI3_LS_BUS_DISPATCH(Dispatcher, RxBufferInfo, TxBufferInfo)                                           \
+    do                                                                                                         \
+    {                                                                                                          \
+        fmi3LsBusOperationHeader* _dispatchOp;                                                                 \
+        for (;;)                                                                                               \
+        {                                                                                                      \
+            const fmi3UInt32 _remaining = (fmi3UInt32)((RxBufferInfo)->writePos - (RxBufferInfo)->readPos);    \
+            fmi3UInt32 _opLength;                                                                              \
+            fmi3LsBusOperationCode _opCode;                                                                    \
+            fmi3LsBusUtilDispatchHandler _handler;                                                             \
+            if (_remaining < sizeof(fmi3LsBusOperationHeader))                                                 \
+            {                                                                                                  \
+                break;                                                                                         \
+            }                                                                                                  \
+            _opLength = FMI3_LS_BUS_LOAD_LE32((RxBufferInfo)->readPos + sizeof(fmi3LsBusOperationCode));       \
+            if (_opLength < sizeof(fmi3LsBusOperationHeader) || _opLength > _remaining)                        \
+            {                                                                                                  \
+                FMI3_LS_BUS_DISPATCH_FORMAT_ERROR_INTERNAL((Dispatcher), (TxBufferInfo), _remaining,           \
+                                                           (const fmi3UInt8*)(RxBufferInfo)->readPos);         \
+                (RxBufferInfo)->readPos = (RxBufferInfo)->writePos;                                            \
+                break;                                                                                         \
+            }                                                                                                  \
+            if (!(FMI3_LS_BUS_READ_NEXT_OPERATION((RxBufferInfo), _dispatchOp)))                               \
+            {                                                                                                  \
+                break;                                                                                         \
+            }                                                                                                  \
+            _opCode = (fmi3LsBusOperationCode)FMI3_LS_BUS_GET_LE(_dispatchOp->opCode);                         \
+            _handler = (_opCode <= FMI3_LS_BUS_DISPATCH_MAX_OP_CODE) ? (Dispatcher)->handlers[_opCode] : NULL; \
+            if ((_handler == NULL || !_handler((Dispatcher)->context, _dispatchOp, (TxBufferInfo))) &&         \
+                _opCode != FMI3_LS_BUS_OP_FORMAT_ERROR)                                                        \
+            {                                                                                                  \
+                FMI3_LS_BUS_DISPATCH_FORMAT_ERROR_INTERNAL((Dispatcher), (TxBufferInfo), _opLength,            \
+                                                           (const fmi3UInt8*)_dispatchOp);                     \
+            }                                                                                                  \
+        }                                                                                                      \
+    }                                                                                                          \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilDispatch_h */
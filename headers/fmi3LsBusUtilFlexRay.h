@@ -70,14 +70,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationTransmit _op;                                         \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT;                           \
         _op.header.length = sizeof(_op) + (DataLength);                                \
-        _op.cycleId = (CycleId);                                                       \
-        _op.slotId = (SlotId);                                                         \
-        _op.channel = (Channel);                                                       \
-        _op.startupFrameIndicator = (StartupFrameIndicator);                           \
-        _op.syncFrameIndicator = (SyncFrameIndicator);                                 \
-        _op.nullFrameIndicator = (NullFrameIndicator);                                 \
-        _op.payloadPreambleIndicator = (PayloadPreambleIndicator);                     \
-        _op.dataLength = (DataLength);                                                 \
+        FMI3_LS_BUS_SET_LE(_op.cycleId, (CycleId));                                    \
+        FMI3_LS_BUS_SET_LE(_op.slotId, (SlotId));                                      \
+        FMI3_LS_BUS_SET_LE(_op.channel, (Channel));                                    \
+        FMI3_LS_BUS_SET_LE(_op.startupFrameIndicator, (StartupFrameIndicator));        \
+        FMI3_LS_BUS_SET_LE(_op.syncFrameIndicator, (SyncFrameIndicator));              \
+        FMI3_LS_BUS_SET_LE(_op.nullFrameIndicator, (NullFrameIndicator));              \
+        FMI3_LS_BUS_SET_LE(_op.payloadPreambleIndicator, (PayloadPreambleIndicator));  \
+        FMI3_LS_BUS_SET_LE(_op.dataLength, (DataLength));                              \
                                                                                        \
         FMI_LS_BUS_SUBMIT_OPERATION_INTERNAL((BufferInfo), _op, (DataLength), (Data)); \
     }                                                                                  \
@@ -103,9 +103,9 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationCancel _op;                                           \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_CANCEL;                             \
         _op.header.length = sizeof(_op);                                               \
-        _op.cycleId = (CycleId);                                                       \
-        _op.slotId = (SlotId);                                                         \
-        _op.channel = (Channel);                                                       \
+        FMI3_LS_BUS_SET_LE(_op.cycleId, (CycleId));                                    \
+        FMI3_LS_BUS_SET_LE(_op.slotId, (SlotId));                                      \
+        FMI3_LS_BUS_SET_LE(_op.channel, (Channel));                                    \
                                                                                        \
         FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);               \
     }                                                                                  \
@@ -131,9 +131,9 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationConfirm _op;                                          \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_CONFIRM;                            \
         _op.header.length = sizeof(_op);                                               \
-        _op.cycleId = (CycleId);                                                       \
-        _op.slotId = (SlotId);                                                         \
-        _op.channel = (Channel);                                                       \
+        FMI3_LS_BUS_SET_LE(_op.cycleId, (CycleId));                                    \
+        FMI3_LS_BUS_SET_LE(_op.slotId, (SlotId));                                      \
+        FMI3_LS_BUS_SET_LE(_op.channel, (Channel));                                    \
                                                                                        \
         FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);               \
     }                                                                                  \
@@ -160,10 +160,10 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationBusError _op;                            \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_BUS_ERROR;             \
         _op.header.length = sizeof(_op);                                  \
-        _op.errorFlags = (ErrorFlags);                                    \
-        _op.cycleId = (CycleId);                                          \
-        _op.segmentIndicator = (SegmentIndicator);                        \
-        _op.channel = (Channel);                                          \
+        FMI3_LS_BUS_SET_LE(_op.errorFlags, (ErrorFlags));                 \
+        FMI3_LS_BUS_SET_LE(_op.cycleId, (CycleId));                       \
+        FMI3_LS_BUS_SET_LE(_op.segmentIndicator, (SegmentIndicator));     \
+        FMI3_LS_BUS_SET_LE(_op.channel, (Channel));                       \
                                                                           \
         FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);  \
     }                                                                     \
@@ -196,39 +196,39 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * \param[in] DynamicSlotIdleTime           The length of dynamic slot idle time within a dynamic segment in macroticks (\ref fmi3LsBusFlexRayDurationMt32).
  * \param[in] ColdstartNode                 Specifies the coldstart capabilities of a FlexRay node (\ref fmi3LsBusFlexRayColdstartNodeType).
  */
-#define FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(BufferInfo, \
-            MacrotickDuration, MacroticksPerCycle, CycleCountMax, ActionPointOffset, StaticSlotLength, \
-            NumberOfStaticSlots, StaticPayloadLength, MinislotActionPointOffset, \
+#define FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(BufferInfo,                                           \
+            MacrotickDuration, MacroticksPerCycle, CycleCountMax, ActionPointOffset, StaticSlotLength,                   \
+            NumberOfStaticSlots, StaticPayloadLength, MinislotActionPointOffset,                                         \
             NumberOfMinislots, MinislotLength, MaximumDynamicPayloadLength, SymbolActionPointOffset, SymbolWindowLength, \
-            NitLength, NMVectorLength, DynamicSlotIdleTime, ColdstartNode) \
-    do                                                                                 \
-    {                                                                                  \
-        fmi3LsBusFlexRayOperationConfiguration _op;                                    \
-        _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION;                      \
-        _op.header.length = sizeof(fmi3LsBusOperationHeader) +                         \
-            sizeof(fmi3LsBusFlexRayConfigParameterType) +                              \
-            sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig);                        \
-        _op.parameterType = FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG;      \
-        _op.flexRayConfig.macrotickDuration = (MacrotickDuration);                     \
-        _op.flexRayConfig.macroticksPerCycle = (MacroticksPerCycle);                   \
-        _op.flexRayConfig.cycleCountMax = (CycleCountMax);                             \
-        _op.flexRayConfig.actionPointOffset = (ActionPointOffset);                     \
-        _op.flexRayConfig.staticSlotLength = (StaticSlotLength);                       \
-        _op.flexRayConfig.numberOfStaticSlots = (NumberOfStaticSlots);                 \
-        _op.flexRayConfig.staticPayloadLength = (StaticPayloadLength);                 \
-        _op.flexRayConfig.minislotActionPointOffset = (MinislotActionPointOffset);     \
-        _op.flexRayConfig.numberOfMinislots = (NumberOfMinislots);                     \
-        _op.flexRayConfig.minislotLength = (MinislotLength);                           \
-        _op.flexRayConfig.maximumDynamicPayloadLength = (MaximumDynamicPayloadLength); \
-        _op.flexRayConfig.symbolActionPointOffset = (SymbolActionPointOffset);         \
-        _op.flexRayConfig.symbolWindowLength = (SymbolWindowLength);                   \
-        _op.flexRayConfig.nitLength = (NitLength);                                     \
-        _op.flexRayConfig.nmVectorLength = (NMVectorLength);                           \
-        _op.flexRayConfig.dynamicSlotIdleTime = (DynamicSlotIdleTime);                 \
-        _op.flexRayConfig.coldstartNode = (ColdstartNode);                             \
-                                                                                       \
-        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);               \
-    }                                                                                  \
+            NitLength, NMVectorLength, DynamicSlotIdleTime, ColdstartNode)                                               \
+    do                                                                                                                   \
+    {                                                                                                                    \
+        fmi3LsBusFlexRayOperationConfiguration _op;                                                                      \
+        _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION;                                                        \
+        _op.header.length = sizeof(fmi3LsBusOperationHeader) +                                                           \
+            sizeof(fmi3LsBusFlexRayConfigParameterType) +                                                                \
+            sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig);                                                          \
+        FMI3_LS_BUS_SET_LE(_op.parameterType, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG);                     \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.macrotickDuration, (MacrotickDuration));                                    \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.macroticksPerCycle, (MacroticksPerCycle));                                  \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.cycleCountMax, (CycleCountMax));                                            \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.actionPointOffset, (ActionPointOffset));                                    \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.staticSlotLength, (StaticSlotLength));                                      \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.numberOfStaticSlots, (NumberOfStaticSlots));                                \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.staticPayloadLength, (StaticPayloadLength));                                \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.minislotActionPointOffset, (MinislotActionPointOffset));                    \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.numberOfMinislots, (NumberOfMinislots));                                    \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.minislotLength, (MinislotLength));                                          \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.maximumDynamicPayloadLength, (MaximumDynamicPayloadLength));                \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.symbolActionPointOffset, (SymbolActionPointOffset));                        \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.symbolWindowLength, (SymbolWindowLength));                                  \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.nitLength, (NitLength));                                                    \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.nmVectorLength, (NMVectorLength));                                          \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.dynamicSlotIdleTime, (DynamicSlotIdleTime));                                \
+        FMI3_LS_BUS_SET_LE(_op.flexRayConfig.coldstartNode, (ColdstartNode));                                            \
+                                                                                                                         \
+        FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);                                                 \
+    }                                                                                                                    \
     while (0)
 
 
@@ -249,7 +249,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationStartCommunication _op;                  \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_START_COMMUNICATION;   \
         _op.header.length = sizeof(_op);                                  \
-        _op.startTime = (StartTime);                                      \
+        FMI3_LS_BUS_SET_LE(_op.startTime, (StartTime));                   \
                                                                           \
         FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);  \
     }                                                                     \
@@ -275,9 +275,9 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
         fmi3LsBusFlexRayOperationSymbol _op;                              \
         _op.header.opCode = FMI3_LS_BUS_FLEXRAY_OP_SYMBOL;                \
         _op.header.length = sizeof(_op);                                  \
-        _op.cycleId = (CycleId);                                          \
-        _op.channel = (Channel);                                          \
-        _op.type = (Type);                                                \
+        FMI3_LS_BUS_SET_LE(_op.cycleId, (CycleId));                       \
+        FMI3_LS_BUS_SET_LE(_op.channel, (Channel));                       \
+        FMI3_LS_BUS_SET_LE(_op.type, (Type));                             \
                                                                           \
         FMI_LS_BUS_SUBMIT_OPERATION_NO_DATA_INTERNAL((BufferInfo), _op);  \
     }                                                                     \
@@ -0,0 +1,335 @@
+#ifndef fmi3LsBusUtilFlexRayAnalyzer_h
+#define fmi3LsBusUtilFlexRayAnalyzer_h
+
+/*
+This header file contains utility macros to analyze the slot utilization of a simulated FlexRay
+cluster: occupancy of the static segment, minislots used in the dynamic segment, the ratio of
+null frames and the delay of confirmed frames relative to the action points of their static slots.
+The analyzer is updated incrementally from the stream of bus operations and needs constant memory
+per slot.
+
+This header can be used when creating bus simulations or tools observing FlexRay traffic.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Duration of a bit in nanoseconds, i.e. a bit rate of 10 Mbit/s.
+ */
+#ifndef FMI3_LS_BUS_FLEXRAY_ANALYZER_BIT_DURATION_NS
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_BIT_DURATION_NS 100
+#endif
+
+/**
+ * \brief Statistics of a single FlexRay slot.
+ */
+typedef struct
+{
+    fmi3UInt32 transmits;       /**< Number of transmit operations. */
+    fmi3UInt32 nullFrames;      /**< Number of transmit operations of null frames. */
+    fmi3UInt32 confirms;        /**< Number of confirm operations. */
+    fmi3UInt32 busErrors;       /**< Number of bus errors reported for this slot. */
+    fmi3UInt8 dataLength;       /**< Data length of the last transmit operation. */
+    fmi3Boolean nullFrame;      /**< Whether the last transmit operation was a null frame. */
+    fmi3UInt32 delayCount;      /**< Number of delays recorded. */
+    fmi3UInt64 delaySum;        /**< Sum of the delays after the action point in nanoseconds. */
+    fmi3UInt64 delayMin;        /**< Minimum delay after the action point in nanoseconds. */
+    fmi3UInt64 delayMax;        /**< Maximum delay after the action point in nanoseconds. */
+} fmi3LsBusUtilFlexRaySlotStatistics;
+
+/**
+ * \brief This data type holds the state of a FlexRay analyzer.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_ANALYZER_INIT.
+ */
+typedef struct
+{
+    fmi3UInt32 macrotickDuration;                /**< Duration of a macrotick in ns, 0 until configured. */
+    fmi3UInt16 macroticksPerCycle;               /**< Length of a cycle in macroticks. */
+    fmi3UInt8 actionPointOffset;                 /**< Action point offset of a static slot in macroticks. */
+    fmi3UInt16 staticSlotLength;                 /**< Length of a static slot in macroticks. */
+    fmi3UInt16 numberOfStaticSlots;              /**< Number of static slots in a cycle. */
+    fmi3UInt16 numberOfMinislots;                /**< Number of minislots in a cycle. */
+    fmi3UInt8 minislotLength;                    /**< Length of a minislot in macroticks. */
+    fmi3Boolean started;                         /**< Whether the communication was started. */
+    fmi3UInt64 startTime;                        /**< Start time of the first cycle in ns. */
+    fmi3UInt64 time;                             /**< Time of the last observed operation in ns. */
+    fmi3UInt64 transmits;                        /**< Number of transmit operations. */
+    fmi3UInt64 nullFrames;                       /**< Number of transmit operations of null frames. */
+    fmi3UInt64 staticFrames;                     /**< Confirmed frames other than null frames in the static segment. */
+    fmi3UInt64 minislotsUsed;                    /**< Minislots used by confirmed frames in the dynamic segment. */
+    fmi3UInt64 busErrors[8];                     /**< Number of bus errors per bit of the error flags. */
+    fmi3LsBusUtilFlexRaySlotStatistics* slots;   /**< Statistics per slot ID, provided by the caller. */
+    size_t slotCount;                            /**< Number of elements of `slots`. */
+} fmi3LsBusUtilFlexRayAnalyzer;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayAnalyzer.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilFlexRaySlotStatistics slots[1 + 62 + 200];
+ * fmi3LsBusUtilFlexRayAnalyzer analyzer;
+ * FMI3_LS_BUS_FLEXRAY_ANALYZER_INIT(&analyzer, slots, sizeof(slots) / sizeof(slots[0]));
+ * \endcode
+ *
+ * \param[in] Analyzer   Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ * \param[in] Slots      Array of \ref fmi3LsBusUtilFlexRaySlotStatistics indexed by slot ID. Slot IDs
+ *                       start at 1, so the array needs one element more than the highest slot ID.
+ * \param[in] SlotCount  Number of elements of `Slots`.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_INIT(Analyzer, Slots, SlotCount)                         \
+    do                                                                                        \
+    {                                                                                         \
+        memset((Analyzer), 0, sizeof(fmi3LsBusUtilFlexRayAnalyzer));                          \
+        memset((Slots), 0, sizeof(fmi3LsBusUtilFlexRaySlotStatistics) * (size_t)(SlotCount)); \
+        (Analyzer)->slots = (Slots);                                                          \
+        (Analyzer)->slotCount = (size_t)(SlotCount);                                          \
+    }                                                                                         \
+    while (0)
+
+/**
+ * \brief Returns the number of minislots a frame occupies in the dynamic segment.
+ *
+ * The duration of the frame is the nominal length of a frame with `DataLength` bytes of payload,
+ * including transmission start, frame start and frame end sequences.
+ *
+ * \param[in] Analyzer    Pointer to a configured \ref fmi3LsBusUtilFlexRayAnalyzer.
+ * \param[in] DataLength  Payload length in bytes.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_FRAME_MINISLOTS(Analyzer, DataLength)                                    \
+    (((fmi3UInt64)(14 + 10 * (8 + (fmi3UInt32)(DataLength))) * FMI3_LS_BUS_FLEXRAY_ANALYZER_BIT_DURATION_NS + \
+      (fmi3UInt64)(Analyzer)->minislotLength * (Analyzer)->macrotickDuration - 1) /                           \
+     ((fmi3UInt64)(Analyzer)->minislotLength * (Analyzer)->macrotickDuration))
+
+/**
+ * \brief Returns the duration of a cycle in nanoseconds.
+ *
+ * \param[in] Analyzer  Pointer to a configured \ref fmi3LsBusUtilFlexRayAnalyzer.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLE_DURATION(Analyzer)                    \
+    ((fmi3UInt64)(Analyzer)->macroticksPerCycle * (Analyzer)->macrotickDuration)
+
+/**
+ * \brief Returns the number of cycles started since the communication was started.
+ *
+ * \param[in] Analyzer  Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(Analyzer)                                                             \
+    ((Analyzer)->started && FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLE_DURATION(Analyzer) != 0 &&                         \
+             (Analyzer)->time >= (Analyzer)->startTime                                                            \
+         ? ((Analyzer)->time - (Analyzer)->startTime) / FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLE_DURATION(Analyzer) + 1 \
+         : 0)
+
+/**
+ * \brief Returns the fraction of static slots carrying a frame other than a null frame, from 0.0 to 1.0.
+ *
+ * \param[in] Analyzer  Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_STATIC_OCCUPANCY(Analyzer)                                                \
+    (FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(Analyzer) == 0 || (Analyzer)->numberOfStaticSlots == 0                \
+         ? 0.0                                                                                                 \
+         : (fmi3Float64)(Analyzer)->staticFrames /                                                             \
+               ((fmi3Float64)FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(Analyzer) * (Analyzer)->numberOfStaticSlots))
+
+/**
+ * \brief Returns the fraction of minislots used by frames in the dynamic segment, from 0.0 to 1.0.
+ *
+ * \param[in] Analyzer  Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_MINISLOT_USAGE(Analyzer)                                                \
+    (FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(Analyzer) == 0 || (Analyzer)->numberOfMinislots == 0                \
+         ? 0.0                                                                                               \
+         : (fmi3Float64)(Analyzer)->minislotsUsed /                                                          \
+               ((fmi3Float64)FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(Analyzer) * (Analyzer)->numberOfMinislots))
+
+/**
+ * \brief Returns the fraction of transmit operations sending null frames, from 0.0 to 1.0.
+ *
+ * \param[in] Analyzer  Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_NULL_FRAME_RATIO(Analyzer)                                                   \
+    ((Analyzer)->transmits == 0 ? 0.0 : (fmi3Float64)(Analyzer)->nullFrames / (fmi3Float64)(Analyzer)->transmits)
+
+/**
+ * \brief Returns the jitter of a static slot in nanoseconds, i.e. the difference between the maximum and
+ *        the minimum delay of its confirmations after the action point.
+ *
+ * \param[in] Slot  Pointer to \ref fmi3LsBusUtilFlexRaySlotStatistics.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_JITTER(Slot)                                   \
+    ((Slot)->delayCount == 0 ? (fmi3UInt64)0 : (Slot)->delayMax - (Slot)->delayMin)
+
+/**
+ * \brief Updates the analyzer with an operation of the FlexRay cluster.
+ *
+ * The analyzer evaluates configuration, start communication, transmit, confirm and bus error operations.
+ * The delay of a confirmation is measured from the last action point of its static slot before `Time`.
+ *
+ * \param[in] Analyzer   Pointer to \ref fmi3LsBusUtilFlexRayAnalyzer.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ * \param[in] Time       Simulation time of the operation in nanoseconds, not decreasing between calls.
+ */
+#define FMI3_LS_BUS_FLEXRAY_ANALYZER_OBSERVE(Analyzer, Operation, Time)                                                     \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                             \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);           \
+        fmi3LsBusUtilFlexRaySlotStatistics* _slot = NULL;                                                                   \
+        fmi3UInt16 _slotId = 0;                                                                                             \
+        (Analyzer)->time = (fmi3UInt64)(Time);                                                                              \
+        switch (FMI3_LS_BUS_GET_LE(_header->opCode))                                                                        \
+        {                                                                                                                   \
+            case FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION:                                                                      \
+                if (_opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusFlexRayConfigParameterType) +           \
+                                      sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig))                                   \
+                {                                                                                                           \
+                    const fmi3LsBusFlexRayOperationConfiguration* _config =                                                 \
+                        (const fmi3LsBusFlexRayOperationConfiguration*)_header;                                             \
+                    const fmi3LsBusFlexRayConfigurationFlexRayConfig* _cfg = &_config->flexRayConfig;                       \
+                    if (FMI3_LS_BUS_GET_LE(_config->parameterType) == FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG) \
+                    {                                                                                                       \
+                        (Analyzer)->macrotickDuration = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->macrotickDuration);            \
+                        (Analyzer)->macroticksPerCycle = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->macroticksPerCycle);          \
+                        (Analyzer)->actionPointOffset = _cfg->actionPointOffset;                                            \
+                        (Analyzer)->staticSlotLength = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->staticSlotLength);              \
+                        (Analyzer)->numberOfStaticSlots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfStaticSlots);        \
+                        (Analyzer)->numberOfMinislots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfMinislots);            \
+                        (Analyzer)->minislotLength = _cfg->minislotLength;                                                  \
+                    }                                                                                                       \
+                }                                                                                                           \
+                break;                                                                                                      \
+            case FMI3_LS_BUS_FLEXRAY_OP_START_COMMUNICATION:                                                                \
+                if (_opLength >= sizeof(fmi3LsBusFlexRayOperationStartCommunication))                                       \
+                {                                                                                                           \
+                    (Analyzer)->started = fmi3True;                                                                         \
+                    (Analyzer)->startTime = (fmi3UInt64)FMI3_LS_BUS_GET_LE(                                                 \
+                        ((const fmi3LsBusFlexRayOperationStartCommunication*)_header)->startTime);                          \
+                }                                                                                                           \
+                break;                                                                                                      \
+            case FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT:                                                                           \
+                if (_opLength >= sizeof(fmi3LsBusFlexRayOperationTransmit))                                                 \
+                {                                                                                                           \
+                    const fmi3LsBusFlexRayOperationTransmit* _tx = (const fmi3LsBusFlexRayOperationTransmit*)_header;       \
+                    _slotId = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_tx->slotId);                                                  \
+                    (Analyzer)->transmits++;                                                                                \
+                    (Analyzer)->nullFrames += _tx->nullFrameIndicator ? 1 : 0;                                              \
+                    if (_slotId < (Analyzer)->slotCount)                                                                    \
+                    {                                                                                                       \
+                        _slot = &(Analyzer)->slots[_slotId];                                                                \
+                        _slot->transmits++;                                                                                 \
+                        _slot->nullFrames += _tx->nullFrameIndicator ? 1 : 0;                                               \
+                        _slot->nullFrame = _tx->nullFrameIndicator ? fmi3True : fmi3False;                                  \
+                        _slot->dataLength = _tx->dataLength;                                                                \
+                    }                                                                                                       \
+                }                                                                                                           \
+                break;                                                                                                      \
+            case FMI3_LS_BUS_FLEXRAY_OP_CONFIRM:                                                                            \
+                if (_opLength >= sizeof(fmi3LsBusFlexRayOperationConfirm))                                                  \
+                {                                                                                                           \
+                    _slotId = (fmi3UInt16)FMI3_LS_BUS_GET_LE(((const fmi3LsBusFlexRayOperationConfirm*)_header)->slotId);   \
+                    _slot = _slotId < (Analyzer)->slotCount ? &(Analyzer)->slots[_slotId] : NULL;                           \
+                }                                                                                                           \
+                if (_slot != NULL)                                                                                          \
+                {                                                                                                           \
+                    _slot->confirms++;                                                                                      \
+                    if (_slotId > (Analyzer)->numberOfStaticSlots && (Analyzer)->macrotickDuration != 0 &&                  \
+                        (Analyzer)->minislotLength != 0)                                                                    \
+                    {                                                                                                       \
+                        (Analyzer)->minislotsUsed += FMI3_LS_BUS_FLEXRAY_ANALYZER_FRAME_MINISLOTS((Analyzer),               \
+                                                                                                  _slot->dataLength);       \
+                    }                                                                                                       \
+                    else if (_slotId >= 1 && _slotId <= (Analyzer)->numberOfStaticSlots && !_slot->nullFrame)               \
+                    {                                                                                                       \
+                        (Analyzer)->staticFrames++;                                                                         \
+                    }                                                                                                       \
+                    if (_slotId >= 1 && _slotId <= (Analyzer)->numberOfStaticSlots && (Analyzer)->started &&                \
+                        (Analyzer)->time >= (Analyzer)->startTime && (Analyzer)->macroticksPerCycle != 0)                   \
+                    {                                                                                                       \
+                        const fmi3UInt64 _cycleDuration = FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLE_DURATION(Analyzer);            \
+                        const fmi3UInt64 _elapsed = (Analyzer)->time - (Analyzer)->startTime;                               \
+                        fmi3UInt64 _actionPoint = _elapsed - _elapsed % _cycleDuration +                                    \
+                            ((fmi3UInt64)(_slotId - 1) * (Analyzer)->staticSlotLength + (Analyzer)->actionPointOffset) *    \
+                            (Analyzer)->macrotickDuration;                                                                  \
+                        if (_actionPoint > _elapsed && _actionPoint >= _cycleDuration)                                      \
+                        {                                                                                                   \
+                            _actionPoint -= _cycleDuration;                                                                 \
+                        }                                                                                                   \
+                        if (_actionPoint <= _elapsed)                                                                       \
+                        {                                                                                                   \
+                            const fmi3UInt64 _delay = _elapsed - _actionPoint;                                              \
+                            _slot->delayMin = _slot->delayCount == 0 || _delay < _slot->delayMin ? _delay                   \
+                                                                                                 : _slot->delayMin;         \
+                            _slot->delayMax = _delay > _slot->delayMax ? _delay : _slot->delayMax;                          \
+                            _slot->delaySum += _delay;                                                                      \
+                            _slot->delayCount++;                                                                            \
+                        }                                                                                                   \
+                    }                                                                                                       \
+                }                                                                                                           \
+                break;                                                                                                      \
+            case FMI3_LS_BUS_FLEXRAY_OP_BUS_ERROR:                                                                          \
+                if (_opLength >= sizeof(fmi3LsBusFlexRayOperationBusError))                                                 \
+                {                                                                                                           \
+                    const fmi3LsBusFlexRayOperationBusError* _error = (const fmi3LsBusFlexRayOperationBusError*)_header;    \
+                    size_t _bit;                                                                                            \
+                    _slotId = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_error->segmentIndicator);                                     \
+                    for (_bit = 0; _bit < 8; _bit++)                                                                        \
+                    {                                                                                                       \
+                        (Analyzer)->busErrors[_bit] += (_error->errorFlags >> _bit) & 1;                                    \
+                    }                                                                                                       \
+                    if (_slotId < (Analyzer)->slotCount)                                                                    \
+                    {                                                                                                       \
+                        (Analyzer)->slots[_slotId].busErrors++;                                                             \
+                    }                                                                                                       \
+                }                                                                                                           \
+                break;                                                                                                      \
+            default:                                                                                                        \
+                break;                                                                                                      \
+        }                                                                                                                   \
+    }                                                                                                                       \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayAnalyzer_h */
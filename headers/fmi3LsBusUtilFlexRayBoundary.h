@@ -0,0 +1,310 @@
+#ifndef fmi3LsBusUtilFlexRayBoundary_h
+#define fmi3LsBusUtilFlexRayBoundary_h
+
+/*
+This header file contains utility macros for Bus Simulations delivering FlexRay operations on boundaries
+(see the `DeliveryOnBoundary` parameter). Operations for the Network FMUs are collected per node into
+contiguous Rx buffers and released together at the next slot, segment or cycle boundary, so that each node
+receives one fmi3SetBinary call per boundary instead of one per frame.
+
+This header can be used when creating Bus Simulation FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+#include "fmi3LsBusUtil.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Operations are released at the end of each static slot or minislot, as required by `DeliveryOnBoundary`.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT ((fmi3UInt8)0)
+
+/**
+ * \brief Operations are released at the end of the static segment, the dynamic segment and the cycle.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_SEGMENT ((fmi3UInt8)1)
+
+/**
+ * \brief Operations are released at the end of each cycle.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_CYCLE ((fmi3UInt8)2)
+
+/**
+ * \brief Constant returned by \ref FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME if no operation is collected.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE ((fmi3UInt64)0xFFFFFFFFFFFFFFFFULL)
+
+/**
+ * \brief This data type holds the state of a collector delivering FlexRay operations on boundaries.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_BOUNDARY_INIT.
+ */
+typedef struct
+{
+    fmi3UInt32 macrotickDuration;          /**< Duration of a macrotick in ns, 0 until configured. */
+    fmi3UInt16 macroticksPerCycle;         /**< Length of a cycle in macroticks. */
+    fmi3UInt16 staticSlotLength;           /**< Length of a static slot in macroticks. */
+    fmi3UInt16 numberOfStaticSlots;        /**< Number of static slots in a cycle. */
+    fmi3UInt16 numberOfMinislots;          /**< Number of minislots in a cycle. */
+    fmi3UInt8 minislotLength;              /**< Length of a minislot in macroticks. */
+    fmi3Boolean started;                   /**< Whether the communication was started. */
+    fmi3UInt64 startTime;                  /**< Start time of the first cycle in ns. */
+    fmi3UInt8 granularity;                 /**< Boundaries operations are released at, e.g. \ref FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT. */
+    fmi3LsBusUtilBufferInfo* bufferInfos;  /**< Rx buffer per node, provided by the caller. */
+    size_t nodeCount;                      /**< Number of elements of `bufferInfos`. */
+    fmi3UInt64 boundary;                   /**< Release time of the collected operations in ns. */
+    fmi3UInt64 operations;                 /**< Number of collected operations. */
+    fmi3UInt64 batches;                    /**< Number of released batches. */
+    fmi3Boolean status;                    /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+} fmi3LsBusUtilFlexRayBoundary;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayBoundary.
+ *
+ * \param[in] Collector    Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \param[in] BufferInfos  Array of initialized \ref fmi3LsBusUtilBufferInfo, one Rx buffer per node.
+ * \param[in] NodeCount    Number of elements of `BufferInfos`.
+ * \param[in] Granularity  Boundaries operations are released at, e.g. \ref FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_INIT(Collector, BufferInfos, NodeCount, Granularity) \
+    do                                                                                    \
+    {                                                                                     \
+        memset((Collector), 0, sizeof(fmi3LsBusUtilFlexRayBoundary));                     \
+        (Collector)->granularity = (Granularity);                                         \
+        (Collector)->bufferInfos = (BufferInfos);                                         \
+        (Collector)->nodeCount = (size_t)(NodeCount);                                     \
+        (Collector)->boundary = FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE;                   \
+        (Collector)->status = fmi3True;                                                   \
+    }                                                                                     \
+    while (0)
+
+/**
+ * \brief Updates the cycle timing of the collector from a Configuration or Start Communication operation.
+ *
+ * Other operations are ignored. Until the collector is configured and the communication is started, every
+ * operation is released at its own time.
+ *
+ * \param[in] Collector  Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_CONFIGURE(Collector, Operation)                                                        \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                             \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);           \
+        if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION &&                                  \
+            _opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusFlexRayConfigParameterType) +                   \
+                             sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig))                                            \
+        {                                                                                                                   \
+            const fmi3LsBusFlexRayOperationConfiguration* _config = (const fmi3LsBusFlexRayOperationConfiguration*)_header; \
+            const fmi3LsBusFlexRayConfigurationFlexRayConfig* _cfg = &_config->flexRayConfig;                               \
+            if (FMI3_LS_BUS_GET_LE(_config->parameterType) == FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG)         \
+            {                                                                                                               \
+                (Collector)->macrotickDuration = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->macrotickDuration);                   \
+                (Collector)->macroticksPerCycle = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->macroticksPerCycle);                 \
+                (Collector)->staticSlotLength = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->staticSlotLength);                     \
+                (Collector)->numberOfStaticSlots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfStaticSlots);               \
+                (Collector)->numberOfMinislots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfMinislots);                   \
+                (Collector)->minislotLength = _cfg->minislotLength;                                                         \
+            }                                                                                                               \
+        }                                                                                                                   \
+        else if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_FLEXRAY_OP_START_COMMUNICATION &&                       \
+                 _opLength >= sizeof(fmi3LsBusFlexRayOperationStartCommunication))                                          \
+        {                                                                                                                   \
+            (Collector)->started = fmi3True;                                                                                \
+            (Collector)->startTime = (fmi3UInt64)FMI3_LS_BUS_GET_LE(                                                        \
+                ((const fmi3LsBusFlexRayOperationStartCommunication*)_header)->startTime);                                  \
+        }                                                                                                                   \
+    }                                                                                                                       \
+    while (0)
+
+/**
+ * \brief Rounds `Offset` up to the next multiple of `Step`.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_ROUND_UP_INTERNAL(Offset, Step)     \
+    ((Step) == 0 ? (Offset) : ((Offset) + (Step) - 1) / (Step) * (Step))
+
+/**
+ * \brief Computes the first boundary at or after `Time`.
+ *
+ * Static slots end every static slot length from the start of the cycle, minislots every minislot length from
+ * the end of the static segment. Operations in the symbol window or the NIT are released at the end of the cycle.
+ *
+ * \param[in]  Collector  Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \param[in]  Time       Time the operation is available at in ns, e.g. the end of its transmission.
+ * \param[out] Boundary   Variable of type fmi3UInt64 set to the time of the boundary in ns.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(Collector, Time, Boundary)                                                       \
+    do                                                                                                                   \
+    {                                                                                                                    \
+        const fmi3UInt64 _time = (fmi3UInt64)(Time);                                                                     \
+        const fmi3UInt64 _mt = (Collector)->macrotickDuration;                                                           \
+        const fmi3UInt64 _cycle = (fmi3UInt64)(Collector)->macroticksPerCycle * _mt;                                     \
+        (Boundary) = _time;                                                                                              \
+        if ((Collector)->started && _cycle != 0 && _time >= (Collector)->startTime)                                      \
+        {                                                                                                                \
+            const fmi3UInt64 _offset = (_time - (Collector)->startTime) % _cycle;                                        \
+            const fmi3UInt64 _slot = (fmi3UInt64)(Collector)->staticSlotLength * _mt;                                    \
+            const fmi3UInt64 _minislot = (fmi3UInt64)(Collector)->minislotLength * _mt;                                  \
+            const fmi3UInt64 _staticEnd = (fmi3UInt64)(Collector)->numberOfStaticSlots * _slot;                          \
+            const fmi3UInt64 _dynamicEnd = _staticEnd + (fmi3UInt64)(Collector)->numberOfMinislots * _minislot;          \
+            fmi3UInt64 _end = _cycle;                                                                                    \
+            if (_offset == 0)                                                                                            \
+            {                                                                                                            \
+                _end = 0;                                                                                                \
+            }                                                                                                            \
+            else if ((Collector)->granularity == FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT)                                      \
+            {                                                                                                            \
+                if (_offset <= _staticEnd)                                                                               \
+                {                                                                                                        \
+                    _end = FMI3_LS_BUS_FLEXRAY_BOUNDARY_ROUND_UP_INTERNAL(_offset, _slot);                               \
+                }                                                                                                        \
+                else if (_offset <= _dynamicEnd)                                                                         \
+                {                                                                                                        \
+                    _end = _staticEnd + FMI3_LS_BUS_FLEXRAY_BOUNDARY_ROUND_UP_INTERNAL(_offset - _staticEnd, _minislot); \
+                }                                                                                                        \
+            }                                                                                                            \
+            else if ((Collector)->granularity == FMI3_LS_BUS_FLEXRAY_BOUNDARY_SEGMENT)                                   \
+            {                                                                                                            \
+                _end = _offset <= _staticEnd ? _staticEnd : _offset <= _dynamicEnd ? _dynamicEnd : _cycle;               \
+            }                                                                                                            \
+            (Boundary) = _time - _offset + (_end < _cycle ? _end : _cycle);                                              \
+        }                                                                                                                \
+    }                                                                                                                    \
+    while (0)
+
+/**
+ * \brief Collects an operation for a node until the boundary following `Time`.
+ *
+ * The operation is appended to the Rx buffer of the node. If the boundary of the operation differs from the
+ * boundary of the already collected operations, the operation is not collected and the 'status' variable of the
+ * argument 'Collector' is set to fmi3False; release the collected operations and add the operation again.
+ * Operations must therefore be added in order of their boundaries.
+ * If the Rx buffer is full, `status` is set to fmi3False as well.
+ *
+ * \param[in] Collector  Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \param[in] Node       Index of the receiving node.
+ * \param[in] Time       Time the operation is available at in ns, e.g. the end of its transmission.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(Collector, Node, Time, Operation)                                         \
+    do                                                                                                             \
+    {                                                                                                              \
+        const fmi3LsBusOperationHeader* _addHeader = (const fmi3LsBusOperationHeader*)(Operation);                 \
+        const size_t _addLength = (size_t)FMI3_LS_BUS_GET_LE(_addHeader->length);                                  \
+        fmi3LsBusUtilBufferInfo* _rx = &(Collector)->bufferInfos[(Node)];                                          \
+        fmi3UInt64 _boundary;                                                                                      \
+        FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT((Collector), (Time), _boundary);                                           \
+        (Collector)->status = fmi3False;                                                                           \
+        if ((Collector)->boundary == FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE || _boundary == (Collector)->boundary) \
+        {                                                                                                          \
+            if ((size_t)(_rx->end - _rx->writePos) >= _addLength)                                                  \
+            {                                                                                                      \
+                memcpy(_rx->writePos, _addHeader, _addLength);                                                     \
+                _rx->writePos += _addLength;                                                                       \
+                FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL(_rx, _addLength);                                            \
+                (Collector)->boundary = _boundary;                                                                 \
+                (Collector)->operations++;                                                                         \
+                (Collector)->status = fmi3True;                                                                    \
+            }                                                                                                      \
+            else                                                                                                   \
+            {                                                                                                      \
+                _rx->status = fmi3False;                                                                           \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(_rx);                                                     \
+            }                                                                                                      \
+        }                                                                                                          \
+    }                                                                                                              \
+    while (0)
+
+/**
+ * \brief Returns the time the collected operations have to be released at in ns.
+ *
+ * The Bus Simulation can use this time for the next tick of its Tx Clocks.
+ *
+ * \param[in] Collector  Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \return               The release time or \ref FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME(Collector) ((Collector)->boundary)
+
+/**
+ * \brief Checks whether the collected operations are due at `Time` and closes the batch if so.
+ *
+ * If `Due` is set to `fmi3True`, the Rx buffer of every node holds the operations to be passed to the node in a
+ * single fmi3SetBinary call. The buffers have to be reset by \ref FMI3_LS_BUS_BUFFER_INFO_RESET afterwards.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_FLEXRAY_BOUNDARY_RELEASE(&collector, time, due);
+ * if (due)
+ * {
+ *     for (node = 0; node < nodeCount; node++)
+ *     {
+ *         // Pass FMI3_LS_BUS_BUFFER_START(&rxBufferInfos[node]) and FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfos[node])
+ *         FMI3_LS_BUS_BUFFER_INFO_RESET(&rxBufferInfos[node]);
+ *     }
+ * }
+ * \endcode
+ *
+ * \param[in]  Collector  Pointer to \ref fmi3LsBusUtilFlexRayBoundary.
+ * \param[in]  Time       Current time in ns.
+ * \param[out] Due        Variable of type fmi3Boolean set to `fmi3True` if the collected operations are released.
+ */
+#define FMI3_LS_BUS_FLEXRAY_BOUNDARY_RELEASE(Collector, Time, Due)                                                          \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        (Due) = fmi3False;                                                                                                  \
+        if ((Collector)->boundary != FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE && (fmi3UInt64)(Time) >= (Collector)->boundary) \
+        {                                                                                                                   \
+            (Due) = fmi3True;                                                                                               \
+            (Collector)->boundary = FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE;                                                 \
+            (Collector)->batches++;                                                                                         \
+        }                                                                                                                   \
+    }                                                                                                                       \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayBoundary_h */
@@ -0,0 +1,248 @@
+#ifndef fmi3LsBusUtilFlexRayDynamic_h
+#define fmi3LsBusUtilFlexRayDynamic_h
+
+/*
+This header file contains utility macros resolving the arbitration of a FlexRay dynamic segment. The frames
+pending for one channel are processed in a single pass in ascending slot order: empty slots consume one minislot,
+transmitted frames consume the minislots covering action point offset, frame and dynamic slot idle time. The
+result states which frames are transmitted and when their transmission starts and ends.
+
+This header can be used when creating Bus Simulation FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Duration of a bit in nanoseconds, i.e. a bit rate of 10 Mbit/s.
+ */
+#ifndef FMI3_LS_BUS_FLEXRAY_DYNAMIC_BIT_DURATION_NS
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_BIT_DURATION_NS 100
+#endif
+
+/**
+ * \brief Highest slot ID of a FlexRay cycle.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_MAX_SLOT_ID 2047
+
+/**
+ * \brief Frame pending for the dynamic segment.
+ *
+ * `slotId` and `dataLength` are set by the caller, the remaining fields by \ref FMI3_LS_BUS_FLEXRAY_DYNAMIC_RESOLVE.
+ */
+typedef struct
+{
+    fmi3UInt16 slotId;        /**< Slot ID of the frame. */
+    fmi3UInt8 dataLength;     /**< Payload length in bytes. */
+    fmi3Boolean transmitted;  /**< Whether the frame is transmitted in this dynamic segment. */
+    fmi3UInt64 startTime;     /**< Start of the transmission in ns, i.e. the action point of the dynamic slot. */
+    fmi3UInt64 endTime;       /**< End of the transmission in ns. */
+} fmi3LsBusUtilFlexRayDynamicFrame;
+
+/**
+ * \brief This data type holds the dynamic segment configuration and the result of the last arbitration.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_DYNAMIC_INIT.
+ */
+typedef struct
+{
+    fmi3UInt32 macrotickDuration;           /**< Duration of a macrotick in ns, 0 until configured. */
+    fmi3UInt16 numberOfStaticSlots;         /**< Number of static slots in a cycle. */
+    fmi3UInt16 numberOfMinislots;           /**< Number of minislots in a cycle. */
+    fmi3UInt8 minislotLength;               /**< Length of a minislot in macroticks. */
+    fmi3UInt8 minislotActionPointOffset;    /**< Action point offset of a dynamic slot in macroticks. */
+    fmi3UInt8 maximumDynamicPayloadLength;  /**< Maximum payload length in the dynamic segment in bytes. */
+    fmi3UInt32 dynamicSlotIdleTime;         /**< Dynamic slot idle time in macroticks. */
+    fmi3UInt32 minislotsUsed;               /**< Minislots elapsed up to the end of the last slot with a pending frame. */
+    fmi3UInt16 slotCounter;                 /**< Slot counter at the end of the last dynamic segment. */
+    size_t transmitted;                     /**< Number of frames transmitted in the last arbitration. */
+} fmi3LsBusUtilFlexRayDynamic;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayDynamic.
+ *
+ * \param[in] Dynamic  Pointer to \ref fmi3LsBusUtilFlexRayDynamic.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_INIT(Dynamic)                  \
+    do                                                             \
+    {                                                              \
+        memset((Dynamic), 0, sizeof(fmi3LsBusUtilFlexRayDynamic)); \
+    }                                                              \
+    while (0)
+
+/**
+ * \brief Updates the dynamic segment configuration from a Configuration operation of type FLEXRAY_CONFIG.
+ *
+ * Other operations are ignored.
+ *
+ * \param[in] Dynamic    Pointer to \ref fmi3LsBusUtilFlexRayDynamic.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_CONFIGURE(Dynamic, Operation)                                                           \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                             \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);           \
+        if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION &&                                  \
+            _opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusFlexRayConfigParameterType) +                   \
+                             sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig))                                            \
+        {                                                                                                                   \
+            const fmi3LsBusFlexRayOperationConfiguration* _config = (const fmi3LsBusFlexRayOperationConfiguration*)_header; \
+            const fmi3LsBusFlexRayConfigurationFlexRayConfig* _cfg = &_config->flexRayConfig;                               \
+            if (FMI3_LS_BUS_GET_LE(_config->parameterType) == FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG)         \
+            {                                                                                                               \
+                (Dynamic)->macrotickDuration = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->macrotickDuration);                     \
+                (Dynamic)->numberOfStaticSlots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfStaticSlots);                 \
+                (Dynamic)->numberOfMinislots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_cfg->numberOfMinislots);                     \
+                (Dynamic)->minislotLength = _cfg->minislotLength;                                                           \
+                (Dynamic)->minislotActionPointOffset = _cfg->minislotActionPointOffset;                                     \
+                (Dynamic)->maximumDynamicPayloadLength = _cfg->maximumDynamicPayloadLength;                                 \
+                (Dynamic)->dynamicSlotIdleTime = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->dynamicSlotIdleTime);                 \
+            }                                                                                                               \
+        }                                                                                                                   \
+    }                                                                                                                       \
+    while (0)
+
+/**
+ * \brief Returns the duration of a frame with `DataLength` bytes of payload in nanoseconds.
+ *
+ * The duration is the nominal length of the frame including transmission start, frame start and frame end sequences.
+ *
+ * \param[in] DataLength  Payload length in bytes.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_DURATION(DataLength)                                             \
+    ((fmi3UInt64)(14 + 10 * (8 + (fmi3UInt32)(DataLength))) * FMI3_LS_BUS_FLEXRAY_DYNAMIC_BIT_DURATION_NS)
+
+/**
+ * \brief Returns the number of minislots a dynamic slot transmitting a frame with `DataLength` bytes of payload
+ *        consumes, covering the action point offset, the frame and the dynamic slot idle time.
+ *
+ * \param[in] Dynamic     Pointer to a configured \ref fmi3LsBusUtilFlexRayDynamic.
+ * \param[in] DataLength  Payload length in bytes.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_MINISLOTS(Dynamic, DataLength)                                                   \
+    ((((fmi3UInt64)(Dynamic)->minislotActionPointOffset + (Dynamic)->dynamicSlotIdleTime) * (Dynamic)->macrotickDuration + \
+      FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_DURATION(DataLength) +                                                             \
+      (fmi3UInt64)(Dynamic)->minislotLength * (Dynamic)->macrotickDuration - 1) /                                          \
+     ((fmi3UInt64)(Dynamic)->minislotLength * (Dynamic)->macrotickDuration))
+
+/**
+ * \brief Resolves the arbitration of one dynamic segment on one channel.
+ *
+ * `Frames` must be sorted by ascending slot ID. Frames are not transmitted if their slot ID belongs to the static
+ * segment, if another frame of the same slot ID precedes them, if their payload exceeds the maximum dynamic
+ * payload length, or if their dynamic slot does not fit into the remaining minislots. A frame that does not fit
+ * still consumes one minislot. The arbitration stops when all minislots elapsed or slot 2047 was passed, so the
+ * effort only depends on the number of frames.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_FLEXRAY_DYNAMIC_RESOLVE(&dynamic, frames, frameCount, cycleStart + staticSegmentDuration);
+ * for (i = 0; i < frameCount; i++)
+ * {
+ *     if (frames[i].transmitted)
+ *     {
+ *         // Deliver the frame at frames[i].endTime
+ *     }
+ * }
+ * \endcode
+ *
+ * \param[in]     Dynamic       Pointer to a configured \ref fmi3LsBusUtilFlexRayDynamic.
+ * \param[in,out] Frames        Array of \ref fmi3LsBusUtilFlexRayDynamicFrame sorted by slot ID.
+ * \param[in]     FrameCount    Number of elements of `Frames`.
+ * \param[in]     SegmentStart  Start time of the dynamic segment in ns.
+ */
+#define FMI3_LS_BUS_FLEXRAY_DYNAMIC_RESOLVE(Dynamic, Frames, FrameCount, SegmentStart)                                          \
+    do                                                                                                                          \
+    {                                                                                                                           \
+        const fmi3UInt64 _minislotNs = (fmi3UInt64)(Dynamic)->minislotLength * (Dynamic)->macrotickDuration;                    \
+        const fmi3UInt64 _minislots = (fmi3UInt64)(Dynamic)->numberOfMinislots;                                                 \
+        fmi3UInt64 _elapsed = 0;                                                                                                \
+        fmi3UInt64 _slot = (fmi3UInt64)(Dynamic)->numberOfStaticSlots + 1;                                                      \
+        size_t _frameIndex;                                                                                                     \
+        (Dynamic)->transmitted = 0;                                                                                             \
+        for (_frameIndex = 0; _frameIndex < (size_t)(FrameCount); _frameIndex++)                                                \
+        {                                                                                                                       \
+            fmi3LsBusUtilFlexRayDynamicFrame* _frame = &(Frames)[_frameIndex];                                                  \
+            _frame->transmitted = fmi3False;                                                                                    \
+            _frame->startTime = 0;                                                                                              \
+            _frame->endTime = 0;                                                                                                \
+            if (_frame->slotId < _slot || _frame->slotId > FMI3_LS_BUS_FLEXRAY_DYNAMIC_MAX_SLOT_ID || _elapsed >= _minislots || \
+                _minislotNs == 0)                                                                                               \
+            {                                                                                                                   \
+                continue;                                                                                                       \
+            }                                                                                                                   \
+            if (_elapsed + (_frame->slotId - _slot) >= _minislots)                                                              \
+            {                                                                                                                   \
+                _slot += _minislots - _elapsed;                                                                                 \
+                _elapsed = _minislots;                                                                                          \
+                continue;                                                                                                       \
+            }                                                                                                                   \
+            _elapsed += _frame->slotId - _slot;                                                                                 \
+            _slot = _frame->slotId;                                                                                             \
+            if (_frame->dataLength <= (Dynamic)->maximumDynamicPayloadLength &&                                                 \
+                _elapsed + FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_MINISLOTS((Dynamic), _frame->dataLength) <= _minislots)            \
+            {                                                                                                                   \
+                _frame->transmitted = fmi3True;                                                                                 \
+                _frame->startTime = (fmi3UInt64)(SegmentStart) + _elapsed * _minislotNs +                                       \
+                                    (fmi3UInt64)(Dynamic)->minislotActionPointOffset * (Dynamic)->macrotickDuration;            \
+                _frame->endTime = _frame->startTime + FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_DURATION(_frame->dataLength);           \
+                _elapsed += FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_MINISLOTS((Dynamic), _frame->dataLength);                         \
+                (Dynamic)->transmitted++;                                                                                       \
+            }                                                                                                                   \
+            else                                                                                                                \
+            {                                                                                                                   \
+                _elapsed++;                                                                                                     \
+            }                                                                                                                   \
+            _slot++;                                                                                                            \
+        }                                                                                                                       \
+        (Dynamic)->minislotsUsed = (fmi3UInt32)(_elapsed < _minislots ? _elapsed : _minislots);                                 \
+        _slot += _minislots - (fmi3UInt64)(Dynamic)->minislotsUsed;                                                             \
+        (Dynamic)->slotCounter =                                                                                                \
+            (fmi3UInt16)(_slot < FMI3_LS_BUS_FLEXRAY_DYNAMIC_MAX_SLOT_ID ? _slot : FMI3_LS_BUS_FLEXRAY_DYNAMIC_MAX_SLOT_ID);    \
+    }                                                                                                                           \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayDynamic_h */
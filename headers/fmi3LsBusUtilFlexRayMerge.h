@@ -0,0 +1,263 @@
+#ifndef fmi3LsBusUtilFlexRayMerge_h
+#define fmi3LsBusUtilFlexRayMerge_h
+
+/*
+This header file contains utility macros merging the copies of a FlexRay frame received on channel A and channel B
+into one logical frame. Transmit and Bus Error operations are grouped by cycle and slot: identical copies are
+forwarded once, differing copies and copies accompanied by a Bus Error on the other channel are flagged. The merged
+frames refer to the operations within the Rx buffer, so no payload is copied.
+
+This header can be used when creating Network FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Highest slot ID merged by \ref FMI3_LS_BUS_FLEXRAY_MERGE_ADD.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_MAX_SLOT_ID 2047
+
+/**
+ * \brief States of a merged frame.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE ((fmi3UInt8)0)        /**< The frame was received on one channel only. */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_REDUNDANT ((fmi3UInt8)1)     /**< Identical copies were received on both channels. */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_MISMATCH ((fmi3UInt8)2)      /**< The copies received on both channels differ. */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_CHANNEL_ERROR ((fmi3UInt8)3) /**< The frame was received on one channel, a Bus Error on the other. */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_ERROR ((fmi3UInt8)4)         /**< Only Bus Errors were received. */
+
+/**
+ * \brief Logical frame merged from the copies of one cycle and slot.
+ */
+typedef struct
+{
+    const fmi3LsBusFlexRayOperationTransmit* operation;    /**< First received copy, NULL if only Bus Errors were received. */
+    const fmi3LsBusFlexRayOperationTransmit* conflicting;  /**< Copy of the other channel if it differs from `operation`, otherwise NULL. */
+    fmi3UInt8 cycleId;                                     /**< The cycle the frame is transferred in. */
+    fmi3UInt16 slotId;                                     /**< The slot the frame is transferred in. */
+    fmi3LsBusFlexRayChannel channels;                      /**< Channels on which a copy was received. */
+    fmi3LsBusFlexRayChannel errorChannels;                 /**< Channels on which a Bus Error was received. */
+    fmi3UInt8 state;                                       /**< One of FMI3_LS_BUS_FLEXRAY_MERGE_STATE_*. */
+} fmi3LsBusUtilFlexRayMergeFrame;
+
+/**
+ * \brief This data type holds the frames merged since the last reset.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_MERGE_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusUtilFlexRayMergeFrame* frames;                           /**< Merged frames in order of their first copy. */
+    size_t capacity;                                                  /**< Number of elements of `frames`. */
+    size_t count;                                                     /**< Number of merged frames. */
+    fmi3UInt32 slotIndex[FMI3_LS_BUS_FLEXRAY_MERGE_MAX_SLOT_ID + 1];  /**< Index + 1 of the latest frame of each slot, validated on use. */
+    size_t merged;                                                    /**< Number of operations merged into an existing frame. */
+    size_t mismatches;                                                /**< Number of copies differing from the first copy. */
+    fmi3Boolean status;                                               /**< fmi3False if operations were rejected because `frames` was full. */
+} fmi3LsBusUtilFlexRayMerge;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayMerge.
+ *
+ * \param[in] Merge     Pointer to \ref fmi3LsBusUtilFlexRayMerge.
+ * \param[in] Frames    Array of \ref fmi3LsBusUtilFlexRayMergeFrame receiving the merged frames.
+ * \param[in] Capacity  Number of elements of Frames.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_INIT(Merge, Frames, Capacity) \
+    do                                                          \
+    {                                                           \
+        memset((Merge), 0, sizeof(fmi3LsBusUtilFlexRayMerge));  \
+        (Merge)->frames = (Frames);                             \
+        (Merge)->capacity = (Capacity);                         \
+        (Merge)->status = fmi3True;                             \
+    }                                                           \
+    while (0)
+
+/**
+ * \brief Discards the merged frames, e.g. after they were processed for one Rx buffer.
+ *
+ * The slot index does not need to be cleared, since its entries are validated against the merged frames.
+ *
+ * \param[in] Merge  Pointer to \ref fmi3LsBusUtilFlexRayMerge.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_RESET(Merge) \
+    do                                         \
+    {                                          \
+        (Merge)->count = 0;                    \
+        (Merge)->status = fmi3True;            \
+    }                                          \
+    while (0)
+
+/**
+ * \brief Compares two Transmit operations from the indicators up to the end of the data.
+ *
+ * Both operations must have been checked to hold at least a complete \ref fmi3LsBusFlexRayOperationTransmit.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_EQUAL_INTERNAL(A, B)                                    \
+    (FMI3_LS_BUS_GET_LE((A)->header.length) == FMI3_LS_BUS_GET_LE((B)->header.length) &&  \
+     memcmp(&(A)->startupFrameIndicator, &(B)->startupFrameIndicator,                     \
+            (size_t)FMI3_LS_BUS_GET_LE((A)->header.length) -                              \
+                offsetof(fmi3LsBusFlexRayOperationTransmit, startupFrameIndicator)) == 0)
+
+/**
+ * \brief Derives the state of a merged frame from its copies and Bus Errors.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_STATE_INTERNAL(Frame)                                                          \
+    ((Frame)->operation == NULL                                  ? FMI3_LS_BUS_FLEXRAY_MERGE_STATE_ERROR         \
+     : (Frame)->conflicting != NULL                              ? FMI3_LS_BUS_FLEXRAY_MERGE_STATE_MISMATCH      \
+     : (Frame)->errorChannels != 0                               ? FMI3_LS_BUS_FLEXRAY_MERGE_STATE_CHANNEL_ERROR \
+     : (Frame)->channels == (FMI3_LS_BUS_FLEXRAY_CHANNEL_A |                                                     \
+                             FMI3_LS_BUS_FLEXRAY_CHANNEL_B)      ? FMI3_LS_BUS_FLEXRAY_MERGE_STATE_REDUNDANT     \
+                                                                 : FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE)
+
+/**
+ * \brief Merges a received operation into the frame of its cycle and slot.
+ *
+ * Transmit operations and Bus Error operations referring to a slot are merged, `Handled` is set to `fmi3True` for them.
+ * Other operations and operations too short for their structure and data are left to the caller and `Handled` is set
+ * to `fmi3False`. A copy is merged into the latest frame of the same cycle and slot unless that frame already holds its
+ * channel, otherwise a new frame is started.
+ * The second copy of a frame is only compared with the first one and never copied.
+ * If `frames` is full, `status` is set to `fmi3False` and `Handled` to `fmi3False`.
+ *
+ * \param[in] Merge      Pointer to \ref fmi3LsBusUtilFlexRayMerge.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation, which must stay valid
+ *                       until the merged frames are processed.
+ * \param[out] Handled   Variable of type fmi3Boolean.
+ */
+#define FMI3_LS_BUS_FLEXRAY_MERGE_ADD(Merge, Operation, Handled)                                                                     \
+    do                                                                                                                               \
+    {                                                                                                                                \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                                      \
+        const fmi3LsBusOperationCode _opCode = (fmi3LsBusOperationCode)FMI3_LS_BUS_GET_LE(_header->opCode);                          \
+        const fmi3LsBusOperationLength _length = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);                      \
+        const fmi3LsBusFlexRayOperationTransmit* _tx = NULL;                                                                         \
+        fmi3UInt8 _cycle = 0;                                                                                                        \
+        fmi3UInt32 _slot = FMI3_LS_BUS_FLEXRAY_MERGE_MAX_SLOT_ID + 1;                                                                \
+        fmi3LsBusFlexRayChannel _channel = 0;                                                                                        \
+        (Handled) = fmi3False;                                                                                                       \
+        if (_opCode == FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT && _length >= sizeof(fmi3LsBusFlexRayOperationTransmit) &&                    \
+            _length >= sizeof(fmi3LsBusFlexRayOperationTransmit) +                                                                   \
+                           FMI3_LS_BUS_GET_LE(((const fmi3LsBusFlexRayOperationTransmit*)_header)->dataLength))                      \
+        {                                                                                                                            \
+            _tx = (const fmi3LsBusFlexRayOperationTransmit*)_header;                                                                 \
+            _cycle = _tx->cycleId;                                                                                                   \
+            _slot = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_tx->slotId);                                                                     \
+            _channel = (fmi3LsBusFlexRayChannel)(_tx->channel & (FMI3_LS_BUS_FLEXRAY_CHANNEL_A | FMI3_LS_BUS_FLEXRAY_CHANNEL_B));    \
+        }                                                                                                                            \
+        else if (_opCode == FMI3_LS_BUS_FLEXRAY_OP_BUS_ERROR && _length >= sizeof(fmi3LsBusFlexRayOperationBusError))                \
+        {                                                                                                                            \
+            const fmi3LsBusFlexRayOperationBusError* _error = (const fmi3LsBusFlexRayOperationBusError*)_header;                     \
+            _cycle = _error->cycleId;                                                                                                \
+            _slot = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_error->segmentIndicator);                                                        \
+            _channel = (fmi3LsBusFlexRayChannel)(_error->channel & (FMI3_LS_BUS_FLEXRAY_CHANNEL_A | FMI3_LS_BUS_FLEXRAY_CHANNEL_B)); \
+        }                                                                                                                            \
+        if (_channel != 0 && _slot <= FMI3_LS_BUS_FLEXRAY_MERGE_MAX_SLOT_ID)                                                         \
+        {                                                                                                                            \
+            const fmi3UInt32 _index = (Merge)->slotIndex[_slot];                                                                     \
+            fmi3LsBusUtilFlexRayMergeFrame* _frame = NULL;                                                                           \
+            if (_index != 0 && _index <= (Merge)->count)                                                                             \
+            {                                                                                                                        \
+                _frame = &(Merge)->frames[_index - 1];                                                                               \
+                if (_frame->cycleId != _cycle || _frame->slotId != _slot ||                                                          \
+                    ((_frame->channels | _frame->errorChannels) & _channel) != 0)                                                    \
+                {                                                                                                                    \
+                    _frame = NULL;                                                                                                   \
+                }                                                                                                                    \
+                else                                                                                                                 \
+                {                                                                                                                    \
+                    (Merge)->merged++;                                                                                               \
+                }                                                                                                                    \
+            }                                                                                                                        \
+            if (_frame == NULL && (Merge)->count < (Merge)->capacity)                                                                \
+            {                                                                                                                        \
+                _frame = &(Merge)->frames[(Merge)->count++];                                                                         \
+                (Merge)->slotIndex[_slot] = (fmi3UInt32)(Merge)->count;                                                              \
+                _frame->operation = NULL;                                                                                            \
+                _frame->conflicting = NULL;                                                                                          \
+                _frame->cycleId = _cycle;                                                                                            \
+                _frame->slotId = (fmi3UInt16)_slot;                                                                                  \
+                _frame->channels = 0;                                                                                                \
+                _frame->errorChannels = 0;                                                                                           \
+            }                                                                                                                        \
+            if (_frame == NULL)                                                                                                      \
+            {                                                                                                                        \
+                (Merge)->status = fmi3False;                                                                                         \
+            }                                                                                                                        \
+            else                                                                                                                     \
+            {                                                                                                                        \
+                if (_tx == NULL)                                                                                                     \
+                {                                                                                                                    \
+                    _frame->errorChannels |= _channel;                                                                               \
+                }                                                                                                                    \
+                else                                                                                                                 \
+                {                                                                                                                    \
+                    if (_frame->operation == NULL)                                                                                   \
+                    {                                                                                                                \
+                        _frame->operation = _tx;                                                                                     \
+                    }                                                                                                                \
+                    else if (!FMI3_LS_BUS_FLEXRAY_MERGE_EQUAL_INTERNAL(_frame->operation, _tx))                                      \
+                    {                                                                                                                \
+                        _frame->conflicting = _tx;                                                                                   \
+                        (Merge)->mismatches++;                                                                                       \
+                    }                                                                                                                \
+                    _frame->channels |= _channel;                                                                                    \
+                }                                                                                                                    \
+                _frame->state = FMI3_LS_BUS_FLEXRAY_MERGE_STATE_INTERNAL(_frame);                                                    \
+                (Handled) = fmi3True;                                                                                                \
+            }                                                                                                                        \
+        }                                                                                                                            \
+    }                                                                                                                                \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayMerge_h */
@@ -0,0 +1,430 @@
+#ifndef fmi3LsBusUtilFlexRayPending_h
+#define fmi3LsBusUtilFlexRayPending_h
+
+/*
+This header file contains utility macros to buffer the FlexRay Transmit operations of Network FMUs within a
+Bus Simulation until their slot is simulated. The pending transmissions are kept in a table indexed by cycle,
+slot and channel, so that Transmit, Cancel and the transmission in a slot take constant time, and a bitmap of
+occupied entries allows iterating only the occupied slots of a cycle.
+
+This header can be used when creating Bus Simulation FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Maximum data length of buffered Transmit operations. Longer Transmit operations are rejected.
+ */
+#ifndef FMI3_LS_BUS_FLEXRAY_PENDING_MAX_DATA_LENGTH
+#define FMI3_LS_BUS_FLEXRAY_PENDING_MAX_DATA_LENGTH 254
+#endif
+
+/**
+ * \brief Number of cycles of a FlexRay cycle period.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES 64
+
+/**
+ * \brief Returns the number of elements of the entry array for `SlotCount` slots.
+ *
+ * \param[in] SlotCount  Highest slot ID handled, at most 2047.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_ENTRY_COUNT(SlotCount)                 \
+    ((size_t)FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES * (size_t)(SlotCount) * 2)
+
+/**
+ * \brief Returns the number of 64-bit words of the bitmap of one cycle for `SlotCount` slots.
+ *
+ * \param[in] SlotCount  Highest slot ID handled, at most 2047.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_CYCLE_WORDS(SlotCount) (((size_t)(SlotCount) * 2 + 63) / 64)
+
+/**
+ * \brief Returns the number of elements of the bitmap array for `SlotCount` slots.
+ *
+ * \param[in] SlotCount  Highest slot ID handled, at most 2047.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_WORD_COUNT(SlotCount)                                             \
+    ((size_t)FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES * FMI3_LS_BUS_FLEXRAY_PENDING_CYCLE_WORDS(SlotCount))
+
+/**
+ * \brief Buffered Transmit operation.
+ */
+typedef struct
+{
+    fmi3UInt32 next;                  /**< Index of the next free frame, only used while the frame is free. */
+    fmi3LsBusFlexRayChannel channels; /**< Channels the frame is still pending on. */
+
+    /** Copy of the Transmit operation. */
+    fmi3UInt8 operation[sizeof(fmi3LsBusFlexRayOperationTransmit) + FMI3_LS_BUS_FLEXRAY_PENDING_MAX_DATA_LENGTH];
+} fmi3LsBusUtilFlexRayPendingFrame;
+
+/**
+ * \brief This data type holds the pending Transmit operations of a FlexRay Bus Simulation.
+ *
+ * Every combination of cycle, slot and channel refers to at most one frame. A Transmit operation for both
+ * channels is stored once and referenced by the entries of both channels.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_PENDING_INIT.
+ */
+typedef struct
+{
+    fmi3UInt32* entries;                      /**< Frame index plus one per cycle, slot and channel, 0 if empty. */
+    fmi3UInt64* occupied;                     /**< Bitmap of the occupied entries, one bit per slot and channel. */
+    fmi3UInt64 summary[64];                   /**< Per cycle, one bit per non-zero bitmap word. */
+    size_t slotCount;                         /**< Highest slot ID handled. */
+    size_t cycleWords;                        /**< Number of bitmap words per cycle. */
+    fmi3LsBusUtilFlexRayPendingFrame* frames; /**< Frames holding the buffered Transmit operations. */
+    size_t frameCount;                        /**< Number of elements of `frames`. */
+    fmi3UInt32 freeFrame;                     /**< Index of the first free frame, `frameCount` if none is free. */
+    size_t size;                              /**< Number of occupied entries. */
+    fmi3Boolean status;                       /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+} fmi3LsBusUtilFlexRayPending;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayPending.
+ *
+ * Example:
+ * \code
+ * static fmi3UInt32 entries[FMI3_LS_BUS_FLEXRAY_PENDING_ENTRY_COUNT(100)];
+ * static fmi3UInt64 occupied[FMI3_LS_BUS_FLEXRAY_PENDING_WORD_COUNT(100)];
+ * static fmi3LsBusUtilFlexRayPendingFrame frames[64];
+ * fmi3LsBusUtilFlexRayPending pending;
+ * FMI3_LS_BUS_FLEXRAY_PENDING_INIT(&pending, entries, occupied, 100, frames, 64);
+ * \endcode
+ *
+ * \param[in] Pending     Pointer to \ref fmi3LsBusUtilFlexRayPending.
+ * \param[in] Entries     Array of fmi3UInt32 with \ref FMI3_LS_BUS_FLEXRAY_PENDING_ENTRY_COUNT elements.
+ * \param[in] Occupied    Array of fmi3UInt64 with \ref FMI3_LS_BUS_FLEXRAY_PENDING_WORD_COUNT elements.
+ * \param[in] SlotCount   Highest slot ID handled, at most 2047.
+ * \param[in] Frames      Array of \ref fmi3LsBusUtilFlexRayPendingFrame.
+ * \param[in] FrameCount  Number of elements of `Frames`, i.e. the maximum number of pending Transmit operations.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_INIT(Pending, Entries, Occupied, SlotCount, Frames, FrameCount)             \
+    do                                                                                                          \
+    {                                                                                                           \
+        size_t _frame;                                                                                          \
+        memset((Pending), 0, sizeof(fmi3LsBusUtilFlexRayPending));                                              \
+        (Pending)->entries = (Entries);                                                                         \
+        (Pending)->occupied = (Occupied);                                                                       \
+        (Pending)->slotCount = (size_t)(SlotCount);                                                             \
+        (Pending)->cycleWords = FMI3_LS_BUS_FLEXRAY_PENDING_CYCLE_WORDS(SlotCount);                             \
+        (Pending)->frames = (Frames);                                                                           \
+        (Pending)->frameCount = (size_t)(FrameCount);                                                           \
+        memset((Pending)->entries, 0, sizeof(fmi3UInt32) * FMI3_LS_BUS_FLEXRAY_PENDING_ENTRY_COUNT(SlotCount)); \
+        memset((Pending)->occupied, 0, sizeof(fmi3UInt64) * FMI3_LS_BUS_FLEXRAY_PENDING_WORD_COUNT(SlotCount)); \
+        for (_frame = 0; _frame < (Pending)->frameCount; _frame++)                                              \
+        {                                                                                                       \
+            (Pending)->frames[_frame].next = (fmi3UInt32)(_frame + 1);                                          \
+            (Pending)->frames[_frame].channels = 0;                                                             \
+        }                                                                                                       \
+        (Pending)->status = fmi3True;                                                                           \
+    }                                                                                                           \
+    while (0)
+
+/**
+ * \brief Returns the position of the lowest bit set in a non-zero 64-bit word.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define FMI3_LS_BUS_FLEXRAY_PENDING_LOWEST_BIT_INTERNAL(Word, Bit) \
+    do                                                             \
+    {                                                              \
+        (Bit) = (size_t)__builtin_ctzll(Word);                     \
+    }                                                              \
+    while (0)
+#else
+#define FMI3_LS_BUS_FLEXRAY_PENDING_LOWEST_BIT_INTERNAL(Word, Bit) \
+    do                                                             \
+    {                                                              \
+        fmi3UInt64 _lowest = (Word);                               \
+        (Bit) = 0;                                                 \
+        while ((_lowest & 1U) == 0)                                \
+        {                                                          \
+            _lowest >>= 1;                                         \
+            (Bit)++;                                               \
+        }                                                          \
+    }                                                              \
+    while (0)
+#endif
+
+/**
+ * \brief Returns the bit position of a slot and a single channel within the bitmap of a cycle.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_POSITION_INTERNAL(SlotId, Channel)                  \
+    (((size_t)(SlotId) - 1) * 2 + ((Channel) == FMI3_LS_BUS_FLEXRAY_CHANNEL_B ? 1 : 0))
+
+/**
+ * \brief Removes the entry of a cycle, slot and single channel and releases its frame once it is not
+ *        referenced by any channel.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_REMOVE_INTERNAL(Pending, CycleId, SlotId, Channel, Frame)                 \
+    do                                                                                                        \
+    {                                                                                                         \
+        const size_t _position = FMI3_LS_BUS_FLEXRAY_PENDING_POSITION_INTERNAL((SlotId), (Channel));          \
+        const size_t _word = (size_t)(CycleId) * (Pending)->cycleWords + _position / 64;                      \
+        fmi3UInt32* _entry = &(Pending)->entries[((size_t)(CycleId) * (Pending)->slotCount * 2) + _position]; \
+        (Frame) = NULL;                                                                                       \
+        if (*_entry != 0)                                                                                     \
+        {                                                                                                     \
+            (Frame) = &(Pending)->frames[*_entry - 1];                                                        \
+            (Frame)->channels &= (fmi3LsBusFlexRayChannel) ~(Channel);                                        \
+            if ((Frame)->channels == 0)                                                                       \
+            {                                                                                                 \
+                (Frame)->next = (Pending)->freeFrame;                                                         \
+                (Pending)->freeFrame = *_entry - 1;                                                           \
+            }                                                                                                 \
+            *_entry = 0;                                                                                      \
+            (Pending)->occupied[_word] &= ~((fmi3UInt64)1 << (_position % 64));                               \
+            if ((Pending)->occupied[_word] == 0)                                                              \
+            {                                                                                                 \
+                (Pending)->summary[(CycleId)] &= ~((fmi3UInt64)1 << (_position / 64));                        \
+            }                                                                                                 \
+            (Pending)->size--;                                                                                \
+        }                                                                                                     \
+    }                                                                                                         \
+    while (0)
+
+/**
+ * \brief Buffers a received FlexRay Transmit operation until its slot is simulated.
+ *
+ * A Transmit operation replaces a pending Transmit operation of the same cycle, slot and channel.
+ * If the cycle or slot is out of range, the operation is shorter than its data, the data is longer than
+ * \ref FMI3_LS_BUS_FLEXRAY_PENDING_MAX_DATA_LENGTH or no frame is free or released by the replacement, the
+ * 'status' variable of the argument 'Pending' is set to fmi3False and the pending Transmit operations are kept.
+ *
+ * \param[in] Pending    Pointer to \ref fmi3LsBusUtilFlexRayPending.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusFlexRayOperationTransmit.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(Pending, Operation)                                                                   \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        const fmi3LsBusFlexRayOperationTransmit* _tx = (Operation);                                                                \
+        const size_t _length = (size_t)FMI3_LS_BUS_LOAD_LE32((const fmi3UInt8*)_tx + sizeof(fmi3LsBusOperationCode));              \
+        (Pending)->status = fmi3False;                                                                                             \
+        if (_length >= sizeof(fmi3LsBusFlexRayOperationTransmit) &&                                                                \
+            _length >= sizeof(fmi3LsBusFlexRayOperationTransmit) + FMI3_LS_BUS_GET_LE(_tx->dataLength) &&                          \
+            _length <= sizeof(((fmi3LsBusUtilFlexRayPendingFrame*)0)->operation))                                                  \
+        {                                                                                                                          \
+            const size_t _cycle = (size_t)_tx->cycleId;                                                                            \
+            const size_t _slot = (size_t)FMI3_LS_BUS_GET_LE(_tx->slotId);                                                          \
+            const fmi3LsBusFlexRayChannel _channels =                                                                              \
+                (fmi3LsBusFlexRayChannel)(_tx->channel & (FMI3_LS_BUS_FLEXRAY_CHANNEL_A | FMI3_LS_BUS_FLEXRAY_CHANNEL_B));         \
+            fmi3Boolean _available = (Pending)->freeFrame < (Pending)->frameCount ? fmi3True : fmi3False;                          \
+            fmi3LsBusUtilFlexRayPendingFrame* _replaced;                                                                           \
+            fmi3UInt32 _channelBit;                                                                                                \
+            if (_cycle < FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES && _slot >= 1 && _slot <= (Pending)->slotCount && _channels != 0)      \
+            {                                                                                                                      \
+                for (_channelBit = FMI3_LS_BUS_FLEXRAY_CHANNEL_A; _channelBit <= FMI3_LS_BUS_FLEXRAY_CHANNEL_B; _channelBit <<= 1) \
+                {                                                                                                                  \
+                    const fmi3UInt32 _entry =                                                                                      \
+                        (Pending)->entries[_cycle * (Pending)->slotCount * 2 +                                                     \
+                                           FMI3_LS_BUS_FLEXRAY_PENDING_POSITION_INTERNAL(_slot, _channelBit)];                     \
+                    if ((_channels & _channelBit) != 0 && _entry != 0 &&                                                           \
+                        ((Pending)->frames[_entry - 1].channels & (fmi3LsBusFlexRayChannel) ~_channels) == 0)                      \
+                    {                                                                                                              \
+                        _available = fmi3True;                                                                                     \
+                    }                                                                                                              \
+                }                                                                                                                  \
+            }                                                                                                                      \
+            else                                                                                                                   \
+            {                                                                                                                      \
+                _available = fmi3False;                                                                                            \
+            }                                                                                                                      \
+            if (_available)                                                                                                        \
+            {                                                                                                                      \
+                fmi3UInt32 _frameIndex;                                                                                            \
+                for (_channelBit = FMI3_LS_BUS_FLEXRAY_CHANNEL_A; _channelBit <= FMI3_LS_BUS_FLEXRAY_CHANNEL_B; _channelBit <<= 1) \
+                {                                                                                                                  \
+                    if ((_channels & _channelBit) != 0)                                                                            \
+                    {                                                                                                              \
+                        FMI3_LS_BUS_FLEXRAY_PENDING_REMOVE_INTERNAL((Pending), _cycle, _slot, _channelBit, _replaced);             \
+                    }                                                                                                              \
+                }                                                                                                                  \
+                (void)_replaced;                                                                                                   \
+                _frameIndex = (Pending)->freeFrame;                                                                                \
+                (Pending)->freeFrame = (Pending)->frames[_frameIndex].next;                                                        \
+                (Pending)->frames[_frameIndex].channels = _channels;                                                               \
+                memcpy((Pending)->frames[_frameIndex].operation, _tx, _length);                                                    \
+                for (_channelBit = FMI3_LS_BUS_FLEXRAY_CHANNEL_A; _channelBit <= FMI3_LS_BUS_FLEXRAY_CHANNEL_B; _channelBit <<= 1) \
+                {                                                                                                                  \
+                    if ((_channels & _channelBit) != 0)                                                                            \
+                    {                                                                                                              \
+                        const size_t _position = FMI3_LS_BUS_FLEXRAY_PENDING_POSITION_INTERNAL(_slot, _channelBit);                \
+                        (Pending)->entries[_cycle * (Pending)->slotCount * 2 + _position] = _frameIndex + 1;                       \
+                        (Pending)->occupied[_cycle * (Pending)->cycleWords + _position / 64] |= (fmi3UInt64)1 << (_position % 64); \
+                        (Pending)->summary[_cycle] |= (fmi3UInt64)1 << (_position / 64);                                           \
+                        (Pending)->size++;                                                                                         \
+                    }                                                                                                              \
+                }                                                                                                                  \
+                (Pending)->status = fmi3True;                                                                                      \
+            }                                                                                                                      \
+        }                                                                                                                          \
+    }                                                                                                                              \
+    while (0)
+
+/**
+ * \brief Removes a pending Transmit operation after a FlexRay Cancel operation.
+ *
+ * If no Transmit operation is pending for any of the given channels, the 'status' variable of the argument
+ * 'Pending' is set to fmi3False.
+ *
+ * \param[in] Pending  Pointer to \ref fmi3LsBusUtilFlexRayPending.
+ * \param[in] CycleId  Cycle of the Transmit operation.
+ * \param[in] SlotId   Slot of the Transmit operation.
+ * \param[in] Channel  Channel(s) of the Transmit operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_CANCEL(Pending, CycleId, SlotId, Channel)                                                 \
+    do                                                                                                                        \
+    {                                                                                                                         \
+        const size_t _cancelCycle = (size_t)(CycleId);                                                                        \
+        const size_t _cancelSlot = (size_t)(SlotId);                                                                          \
+        (Pending)->status = fmi3False;                                                                                        \
+        if (_cancelCycle < FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES && _cancelSlot >= 1 && _cancelSlot <= (Pending)->slotCount)     \
+        {                                                                                                                     \
+            fmi3LsBusUtilFlexRayPendingFrame* _canceled;                                                                      \
+            fmi3UInt32 _cancelBit;                                                                                            \
+            for (_cancelBit = FMI3_LS_BUS_FLEXRAY_CHANNEL_A; _cancelBit <= FMI3_LS_BUS_FLEXRAY_CHANNEL_B; _cancelBit <<= 1)   \
+            {                                                                                                                 \
+                if (((Channel) & _cancelBit) != 0)                                                                            \
+                {                                                                                                             \
+                    FMI3_LS_BUS_FLEXRAY_PENDING_REMOVE_INTERNAL((Pending), _cancelCycle, _cancelSlot, _cancelBit, _canceled); \
+                    (Pending)->status = _canceled != NULL ? fmi3True : (Pending)->status;                                     \
+                }                                                                                                             \
+            }                                                                                                                 \
+        }                                                                                                                     \
+    }                                                                                                                         \
+    while (0)
+
+/**
+ * \brief Finds the first pending Transmit operation of a cycle at or after a slot.
+ *
+ * The search only visits non-zero words of the bitmap. Entries of channel A precede entries of channel B of
+ * the same slot.
+ *
+ * \param[in]  Pending   Pointer to \ref fmi3LsBusUtilFlexRayPending.
+ * \param[in]  CycleId   Cycle to search.
+ * \param[in]  FromSlot  First slot to consider, at least 1.
+ * \param[out] SlotId    Variable of type size_t set to the slot of the Transmit operation, 0 if none is pending.
+ * \param[out] Channel   Variable of type \ref fmi3LsBusFlexRayChannel set to the channel of the Transmit operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_NEXT(Pending, CycleId, FromSlot, SlotId, Channel)                                                     \
+    do                                                                                                                                    \
+    {                                                                                                                                     \
+        const size_t _from = ((size_t)(FromSlot) - 1) * 2;                                                                                \
+        const size_t _base = (size_t)(CycleId) * (Pending)->cycleWords;                                                                   \
+        (SlotId) = 0;                                                                                                                     \
+        (Channel) = 0;                                                                                                                    \
+        if (_from / 64 < (Pending)->cycleWords)                                                                                           \
+        {                                                                                                                                 \
+            fmi3UInt64 _bits = (Pending)->occupied[_base + _from / 64] & (~(fmi3UInt64)0 << (_from % 64));                                \
+            size_t _wordIndex = _from / 64;                                                                                               \
+            size_t _bit;                                                                                                                  \
+            if (_bits == 0)                                                                                                               \
+            {                                                                                                                             \
+                const fmi3UInt64 _words = _wordIndex + 1 < 64 ? (Pending)->summary[(CycleId)] & (~(fmi3UInt64)0 << (_wordIndex + 1)) : 0; \
+                if (_words != 0)                                                                                                          \
+                {                                                                                                                         \
+                    FMI3_LS_BUS_FLEXRAY_PENDING_LOWEST_BIT_INTERNAL(_words, _wordIndex);                                                  \
+                    _bits = (Pending)->occupied[_base + _wordIndex];                                                                      \
+                }                                                                                                                         \
+            }                                                                                                                             \
+            if (_bits != 0)                                                                                                               \
+            {                                                                                                                             \
+                FMI3_LS_BUS_FLEXRAY_PENDING_LOWEST_BIT_INTERNAL(_bits, _bit);                                                             \
+                (SlotId) = (_wordIndex * 64 + _bit) / 2 + 1;                                                                              \
+                (Channel) = (_bit % 2) == 0 ? FMI3_LS_BUS_FLEXRAY_CHANNEL_A : FMI3_LS_BUS_FLEXRAY_CHANNEL_B;                              \
+            }                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    while (0)
+
+/**
+ * \brief Takes the pending Transmit operation of a cycle, slot and single channel for its transmission.
+ *
+ * `Operation` is set to NULL if no Transmit operation is pending. The returned operation stays valid until the
+ * next call of \ref FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT. A Transmit operation for both channels is returned
+ * once per channel.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_FLEXRAY_PENDING_NEXT(&pending, cycle, 1, slot, channel);
+ * while (slot != 0)
+ * {
+ *     FMI3_LS_BUS_FLEXRAY_PENDING_FIRE(&pending, cycle, slot, channel, operation);
+ *     // Simulate the transmission of operation in slot ...
+ *     FMI3_LS_BUS_FLEXRAY_PENDING_NEXT(&pending, cycle, slot, slot, channel);
+ * }
+ * \endcode
+ *
+ * \param[in]  Pending    Pointer to \ref fmi3LsBusUtilFlexRayPending.
+ * \param[in]  CycleId    Cycle of the transmission.
+ * \param[in]  SlotId     Slot of the transmission.
+ * \param[in]  Channel    Single channel of the transmission.
+ * \param[out] Operation  Variable of type pointer to \ref fmi3LsBusFlexRayOperationTransmit.
+ */
+#define FMI3_LS_BUS_FLEXRAY_PENDING_FIRE(Pending, CycleId, SlotId, Channel, Operation)                      \
+    do                                                                                                      \
+    {                                                                                                       \
+        fmi3LsBusUtilFlexRayPendingFrame* _fired = NULL;                                                    \
+        if ((size_t)(CycleId) < FMI3_LS_BUS_FLEXRAY_PENDING_CYCLES && (size_t)(SlotId) >= 1 &&              \
+            (size_t)(SlotId) <= (Pending)->slotCount)                                                       \
+        {                                                                                                   \
+            FMI3_LS_BUS_FLEXRAY_PENDING_REMOVE_INTERNAL((Pending), (CycleId), (SlotId), (Channel), _fired); \
+        }                                                                                                   \
+        (Operation) = _fired != NULL ? (fmi3LsBusFlexRayOperationTransmit*)_fired->operation : NULL;        \
+    }                                                                                                       \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayPending_h */
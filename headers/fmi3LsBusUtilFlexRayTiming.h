@@ -0,0 +1,298 @@
+#ifndef fmi3LsBusUtilFlexRayTiming_h
+#define fmi3LsBusUtilFlexRayTiming_h
+
+/*
+This header file contains utility macros validating a FlexRay cluster configuration and precomputing the timing
+derived from it. The validator checks the protocol constraints between the parameters of a Configuration operation,
+e.g. that the segments add up to the cycle length and that the action points lie within their slots. The derived
+timing holds the segment and slot offsets in nanoseconds, so that the hot path of a Bus Simulation only needs a
+multiplication and an addition to locate a slot.
+
+This header can be used when creating Bus Simulation FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusFlexRay.h"
+#include "fmi3LsBusUtilFlexRayDynamic.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Errors reported by \ref FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE as a bit mask.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_NONE ((fmi3UInt32)0x0000)                  /**< The configuration is valid. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_MACROTICK ((fmi3UInt32)0x0001)             /**< The macrotick duration or the cycle length is zero. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SEGMENTS ((fmi3UInt32)0x0002)              /**< Static segment, dynamic segment, symbol window and NIT do not add up to the cycle length. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SLOT_COUNT ((fmi3UInt32)0x0004)            /**< Less than 2 or more than 1023 static slots, or more slots than slot IDs. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_ACTION_POINT ((fmi3UInt32)0x0008)          /**< The action point offset does not lie within a static slot. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_MINISLOT_ACTION_POINT ((fmi3UInt32)0x0010) /**< The minislot action point offset does not lie within a minislot. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SYMBOL_ACTION_POINT ((fmi3UInt32)0x0020)   /**< The symbol action point offset does not lie within the symbol window. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_PAYLOAD ((fmi3UInt32)0x0040)               /**< A payload length or the NM vector length is out of bounds. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_STATIC_FRAME ((fmi3UInt32)0x0080)          /**< A static frame does not fit between action point and end of its slot. */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_CYCLE_COUNT ((fmi3UInt32)0x0100)           /**< The cycle count max is not an odd number between 7 and 63. */
+
+/**
+ * \brief Upper bounds of the configuration parameters checked by \ref FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_MAX_PAYLOAD_LENGTH 254
+#define FMI3_LS_BUS_FLEXRAY_TIMING_MAX_NM_VECTOR_LENGTH 12
+#define FMI3_LS_BUS_FLEXRAY_TIMING_MAX_STATIC_SLOTS 1023
+
+/**
+ * \brief Alignment of \ref fmi3LsBusUtilFlexRayTiming to a cache line.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ALIGN_INTERNAL __declspec(align(64))
+#else
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ALIGN_INTERNAL __attribute__((aligned(64)))
+#endif
+
+/**
+ * \brief This data type holds the timing derived from a FlexRay configuration.
+ *
+ * All offsets are given in ns relative to the start of a cycle. The structure is aligned to a cache line and
+ * is not modified after \ref FMI3_LS_BUS_FLEXRAY_TIMING_COMPUTE, so it can be shared between threads.
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_FLEXRAY_TIMING_INIT.
+ */
+typedef struct FMI3_LS_BUS_FLEXRAY_TIMING_ALIGN_INTERNAL
+{
+    fmi3UInt64 macrotickDuration;          /**< Duration of a macrotick in ns, 0 until computed. */
+    fmi3UInt64 cycleDuration;              /**< Duration of a cycle in ns. */
+    fmi3UInt64 staticSlotDuration;         /**< Duration of a static slot in ns. */
+    fmi3UInt64 actionPointOffset;          /**< Action point offset of a static slot in ns. */
+    fmi3UInt64 dynamicSegmentStart;        /**< Start of the dynamic segment, i.e. end of the static segment. */
+    fmi3UInt64 minislotDuration;           /**< Duration of a minislot in ns. */
+    fmi3UInt64 minislotActionPointOffset;  /**< Action point offset of a minislot in ns. */
+    fmi3UInt64 symbolWindowStart;          /**< Start of the symbol window, i.e. end of the dynamic segment. */
+    fmi3UInt64 symbolActionPoint;          /**< Action point of the symbol window. */
+    fmi3UInt64 nitStart;                   /**< Start of the network idle time. */
+    fmi3UInt16 numberOfStaticSlots;        /**< Number of static slots in a cycle. */
+    fmi3UInt16 numberOfMinislots;          /**< Number of minislots in a cycle. */
+    fmi3UInt8 cycleCount;                  /**< Number of cycles until the cycle counter wraps, i.e. cycle count max + 1. */
+    fmi3UInt32 errors;                     /**< Errors of the configuration, see \ref FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE. */
+} fmi3LsBusUtilFlexRayTiming;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilFlexRayTiming.
+ *
+ * \param[in] Timing  Pointer to \ref fmi3LsBusUtilFlexRayTiming.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_INIT(Timing)                  \
+    do                                                           \
+    {                                                            \
+        memset((Timing), 0, sizeof(fmi3LsBusUtilFlexRayTiming)); \
+    }                                                            \
+    while (0)
+
+/**
+ * \brief Checks the protocol constraints of a FlexRay configuration.
+ *
+ * The checks are limited to the parameters carried by the Configuration operation. Each violated constraint
+ * sets one of the FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_* bits.
+ *
+ * \param[in] Config  Pointer to \ref fmi3LsBusFlexRayConfigurationFlexRayConfig as received within an operation.
+ * \param[out] Errors Variable of type fmi3UInt32 receiving the errors, FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_NONE if valid.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE(Config, Errors)                                                    \
+    do                                                                                                         \
+    {                                                                                                          \
+        const fmi3LsBusFlexRayConfigurationFlexRayConfig* _cfg = (Config);                                     \
+        const fmi3UInt64 _mt = (fmi3UInt64)FMI3_LS_BUS_GET_LE(_cfg->macrotickDuration);                        \
+        const fmi3UInt32 _macroticks = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->macroticksPerCycle);               \
+        const fmi3UInt32 _staticSlotLength = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->staticSlotLength);           \
+        const fmi3UInt32 _staticSlots = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->numberOfStaticSlots);             \
+        const fmi3UInt32 _minislots = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->numberOfMinislots);                 \
+        const fmi3UInt32 _nitLength = (fmi3UInt32)FMI3_LS_BUS_GET_LE(_cfg->nitLength);                         \
+        fmi3UInt32 _errors = FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_NONE;                                            \
+        if (_mt == 0 || _macroticks == 0)                                                                      \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_MACROTICK;                                             \
+        }                                                                                                      \
+        if (_staticSlotLength * _staticSlots + (fmi3UInt32)_cfg->minislotLength * _minislots +                 \
+                _cfg->symbolWindowLength + _nitLength !=                                                       \
+            _macroticks)                                                                                       \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SEGMENTS;                                              \
+        }                                                                                                      \
+        if (_staticSlots < 2 || _staticSlots > FMI3_LS_BUS_FLEXRAY_TIMING_MAX_STATIC_SLOTS ||                  \
+            _staticSlots + _minislots > FMI3_LS_BUS_FLEXRAY_DYNAMIC_MAX_SLOT_ID)                               \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SLOT_COUNT;                                            \
+        }                                                                                                      \
+        if (_cfg->actionPointOffset == 0 || _cfg->actionPointOffset >= _staticSlotLength)                      \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_ACTION_POINT;                                          \
+        }                                                                                                      \
+        if (_minislots != 0 &&                                                                                 \
+            (_cfg->minislotActionPointOffset == 0 || _cfg->minislotActionPointOffset >= _cfg->minislotLength)) \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_MINISLOT_ACTION_POINT;                                 \
+        }                                                                                                      \
+        if (_cfg->symbolWindowLength != 0 && _cfg->symbolActionPointOffset >= _cfg->symbolWindowLength)        \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SYMBOL_ACTION_POINT;                                   \
+        }                                                                                                      \
+        if (_cfg->staticPayloadLength > FMI3_LS_BUS_FLEXRAY_TIMING_MAX_PAYLOAD_LENGTH ||                       \
+            _cfg->maximumDynamicPayloadLength > FMI3_LS_BUS_FLEXRAY_TIMING_MAX_PAYLOAD_LENGTH ||               \
+            _cfg->nmVectorLength > FMI3_LS_BUS_FLEXRAY_TIMING_MAX_NM_VECTOR_LENGTH ||                          \
+            _cfg->nmVectorLength > _cfg->staticPayloadLength)                                                  \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_PAYLOAD;                                               \
+        }                                                                                                      \
+        if ((fmi3UInt64)_cfg->actionPointOffset * _mt +                                                        \
+                FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_DURATION(_cfg->staticPayloadLength) >                        \
+            (fmi3UInt64)_staticSlotLength * _mt)                                                               \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_STATIC_FRAME;                                          \
+        }                                                                                                      \
+        if (_cfg->cycleCountMax < 7 || _cfg->cycleCountMax > 63 || (_cfg->cycleCountMax & 1) == 0)             \
+        {                                                                                                      \
+            _errors |= FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_CYCLE_COUNT;                                           \
+        }                                                                                                      \
+        (Errors) = _errors;                                                                                    \
+    }                                                                                                          \
+    while (0)
+
+/**
+ * \brief Validates a FlexRay configuration and precomputes its derived timing.
+ *
+ * The timing is computed even if the configuration is invalid, the result of the validation is stored in
+ * the field `errors`. The offsets are only meaningful if `errors` equals FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_NONE.
+ *
+ * \param[out] Timing  Pointer to \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] Config   Pointer to \ref fmi3LsBusFlexRayConfigurationFlexRayConfig as received within an operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_COMPUTE(Timing, Config)                                                          \
+    do                                                                                                              \
+    {                                                                                                               \
+        const fmi3LsBusFlexRayConfigurationFlexRayConfig* _timingCfg = (Config);                                    \
+        fmi3UInt32 _timingErrors;                                                                                   \
+        fmi3UInt64 _macrotick;                                                                                      \
+        FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE(_timingCfg, _timingErrors);                                             \
+        _macrotick = (fmi3UInt64)FMI3_LS_BUS_GET_LE(_timingCfg->macrotickDuration);                                 \
+        (Timing)->macrotickDuration = _macrotick;                                                                   \
+        (Timing)->cycleDuration = (fmi3UInt64)FMI3_LS_BUS_GET_LE(_timingCfg->macroticksPerCycle) * _macrotick;      \
+        (Timing)->staticSlotDuration = (fmi3UInt64)FMI3_LS_BUS_GET_LE(_timingCfg->staticSlotLength) * _macrotick;   \
+        (Timing)->actionPointOffset = (fmi3UInt64)_timingCfg->actionPointOffset * _macrotick;                       \
+        (Timing)->numberOfStaticSlots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_timingCfg->numberOfStaticSlots);            \
+        (Timing)->numberOfMinislots = (fmi3UInt16)FMI3_LS_BUS_GET_LE(_timingCfg->numberOfMinislots);                \
+        (Timing)->dynamicSegmentStart = (Timing)->staticSlotDuration * (Timing)->numberOfStaticSlots;               \
+        (Timing)->minislotDuration = (fmi3UInt64)_timingCfg->minislotLength * _macrotick;                           \
+        (Timing)->minislotActionPointOffset = (fmi3UInt64)_timingCfg->minislotActionPointOffset * _macrotick;       \
+        (Timing)->symbolWindowStart =                                                                               \
+            (Timing)->dynamicSegmentStart + (Timing)->minislotDuration * (Timing)->numberOfMinislots;               \
+        (Timing)->symbolActionPoint =                                                                               \
+            (Timing)->symbolWindowStart + (fmi3UInt64)_timingCfg->symbolActionPointOffset * _macrotick;             \
+        (Timing)->nitStart = (Timing)->symbolWindowStart + (fmi3UInt64)_timingCfg->symbolWindowLength * _macrotick; \
+        (Timing)->cycleCount = (fmi3UInt8)(_timingCfg->cycleCountMax + 1);                                          \
+        (Timing)->errors = _timingErrors;                                                                           \
+    }                                                                                                               \
+    while (0)
+
+/**
+ * \brief Computes the timing from a Configuration operation of type FLEXRAY_CONFIG.
+ *
+ * Other operations are ignored and leave the timing unchanged.
+ *
+ * \param[out] Timing    Pointer to \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] Operation  Pointer to \ref fmi3LsBusOperationHeader of a complete operation.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_CONFIGURE(Timing, Operation)                                                             \
+    do                                                                                                                      \
+    {                                                                                                                       \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                             \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);           \
+        if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_FLEXRAY_OP_CONFIGURATION &&                                  \
+            _opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusFlexRayConfigParameterType) +                   \
+                             sizeof(fmi3LsBusFlexRayConfigurationFlexRayConfig))                                            \
+        {                                                                                                                   \
+            const fmi3LsBusFlexRayOperationConfiguration* _config = (const fmi3LsBusFlexRayOperationConfiguration*)_header; \
+            if (FMI3_LS_BUS_GET_LE(_config->parameterType) == FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_TYPE_FLEXRAY_CONFIG)         \
+            {                                                                                                               \
+                FMI3_LS_BUS_FLEXRAY_TIMING_COMPUTE((Timing), &_config->flexRayConfig);                                      \
+            }                                                                                                               \
+        }                                                                                                                   \
+    }                                                                                                                       \
+    while (0)
+
+/**
+ * \brief Returns the start of a static slot in ns relative to the start of its cycle.
+ *
+ * \param[in] Timing  Pointer to a computed \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] SlotId  Slot ID starting at 1.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_STATIC_SLOT_START(Timing, SlotId) \
+    ((fmi3UInt64)((SlotId) - 1) * (Timing)->staticSlotDuration)
+
+/**
+ * \brief Returns the action point of a static slot in ns relative to the start of its cycle.
+ *
+ * \param[in] Timing  Pointer to a computed \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] SlotId  Slot ID starting at 1.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_ACTION_POINT(Timing, SlotId)                                      \
+    (FMI3_LS_BUS_FLEXRAY_TIMING_STATIC_SLOT_START((Timing), (SlotId)) + (Timing)->actionPointOffset)
+
+/**
+ * \brief Returns the start of a minislot in ns relative to the start of its cycle.
+ *
+ * \param[in] Timing    Pointer to a computed \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] Minislot  Index of the minislot within the dynamic segment starting at 0.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_MINISLOT_START(Timing, Minislot)                       \
+    ((Timing)->dynamicSegmentStart + (fmi3UInt64)(Minislot) * (Timing)->minislotDuration)
+
+/**
+ * \brief Returns the start of the cycle containing a point in time in ns.
+ *
+ * \param[in] Timing  Pointer to a computed \ref fmi3LsBusUtilFlexRayTiming.
+ * \param[in] Start   Start time of the first cycle in ns.
+ * \param[in] Time    Point in time in ns, not before Start.
+ */
+#define FMI3_LS_BUS_FLEXRAY_TIMING_CYCLE_START(Timing, Start, Time)                             \
+    ((fmi3UInt64)(Time) - ((fmi3UInt64)(Time) - (fmi3UInt64)(Start)) % (Timing)->cycleDuration)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilFlexRayTiming_h */
@@ -0,0 +1,427 @@
+#ifndef fmi3LsBusUtilInject_h
+#define fmi3LsBusUtilInject_h
+
+/*
+This header file contains utility macros to inject bus errors into streams of CAN and FlexRay operations,
+e.g. for robustness tests. Transmit operations matching a rule are replaced by Bus Error operations
+while copying the operations from one buffer to another. The decisions are drawn from a counter-based
+random number generator, so that a run is reproducible from its seed alone.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusFlexRay.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+#include "fmi3LsBusUtilFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Key of a rule matching any CAN ID or FlexRay slot.
+ */
+#define FMI3_LS_BUS_INJECT_ANY ((fmi3UInt32)0xFFFFFFFFU)
+
+/**
+ * \brief Converts a probability from 0.0 to 1.0 to the representation used by \ref fmi3LsBusUtilInjectRule.
+ *
+ * \param[in] Probability  Probability as floating point value.
+ */
+#define FMI3_LS_BUS_INJECT_PROBABILITY(Probability) ((fmi3UInt32)((Probability) * 4294967295.0))
+
+/**
+ * \brief A rule selecting transmit operations to be replaced by Bus Error operations.
+ *
+ * Variables of this type should be initialized using \ref FMI3_LS_BUS_INJECT_RULE_INIT.
+ */
+typedef struct
+{
+    fmi3UInt32 key;         /**< CAN ID or FlexRay slot ID, or \ref FMI3_LS_BUS_INJECT_ANY. */
+    fmi3UInt32 probability; /**< Probability of starting a burst in units of 2^-32. */
+    fmi3UInt32 burstLength; /**< Number of consecutive matching operations replaced once a burst started. */
+    fmi3UInt8 error;        /**< CAN error code (\ref fmi3LsBusCanErrorCode) or FlexRay error flags (\ref fmi3LsBusFlexRayError). */
+    fmi3UInt32 remaining;   /**< Number of operations left in the current burst. */
+} fmi3LsBusUtilInjectRule;
+
+/**
+ * \brief This data type holds the state of an error injector.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_INJECT_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusUtilInjectRule* rules; /**< Rules, the first matching rule applies. */
+    size_t ruleCount;               /**< Number of rules. */
+    fmi3UInt64 seed;                /**< Seed of the random number generator. */
+    fmi3UInt64 counter;             /**< Number of transmit operations examined. */
+    fmi3UInt64 injected;            /**< Number of transmit operations replaced. */
+} fmi3LsBusUtilInjector;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilInjectRule.
+ *
+ * \param[in] Rule         Pointer to \ref fmi3LsBusUtilInjectRule.
+ * \param[in] Key          CAN ID or FlexRay slot ID, or \ref FMI3_LS_BUS_INJECT_ANY.
+ * \param[in] Probability  Probability of starting a burst, see \ref FMI3_LS_BUS_INJECT_PROBABILITY.
+ * \param[in] BurstLength  Number of consecutive matching operations replaced once a burst started, at least 1.
+ * \param[in] Error        CAN error code or FlexRay error flags of the created Bus Error operations.
+ */
+#define FMI3_LS_BUS_INJECT_RULE_INIT(Rule, Key, Probability, BurstLength, Error) \
+    do                                                                           \
+    {                                                                            \
+        (Rule)->key = (Key);                                                     \
+        (Rule)->probability = (Probability);                                     \
+        (Rule)->burstLength = (BurstLength);                                     \
+        (Rule)->error = (Error);                                                 \
+        (Rule)->remaining = 0;                                                   \
+    }                                                                            \
+    while (0)
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilInjector.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilInjectRule rules[2];
+ * fmi3LsBusUtilInjector injector;
+ * FMI3_LS_BUS_INJECT_RULE_INIT(&rules[0], 0x100, FMI3_LS_BUS_INJECT_PROBABILITY(0.1), 3,
+ *                              FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_CRC_ERROR);
+ * FMI3_LS_BUS_INJECT_RULE_INIT(&rules[1], FMI3_LS_BUS_INJECT_ANY, FMI3_LS_BUS_INJECT_PROBABILITY(0.001), 1,
+ *                              FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_BIT_ERROR);
+ * FMI3_LS_BUS_INJECT_INIT(&injector, rules, 2, seed);
+ * \endcode
+ *
+ * \param[in] Injector   Pointer to \ref fmi3LsBusUtilInjector.
+ * \param[in] Rules      Array of \ref fmi3LsBusUtilInjectRule.
+ * \param[in] RuleCount  Number of rules.
+ * \param[in] Seed       Seed of the random number generator.
+ */
+#define FMI3_LS_BUS_INJECT_INIT(Injector, Rules, RuleCount, Seed) \
+    do                                                            \
+    {                                                             \
+        size_t _rule;                                             \
+        (Injector)->rules = (Rules);                              \
+        (Injector)->ruleCount = (size_t)(RuleCount);              \
+        (Injector)->seed = (fmi3UInt64)(Seed);                    \
+        (Injector)->counter = 0;                                  \
+        (Injector)->injected = 0;                                 \
+        for (_rule = 0; _rule < (Injector)->ruleCount; _rule++)   \
+        {                                                         \
+            (Injector)->rules[_rule].remaining = 0;               \
+        }                                                         \
+    }                                                             \
+    while (0)
+
+/**
+ * \brief Returns the random number with index `Counter` of the sequence given by `Seed` (SplitMix64).
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_INJECT_RANDOM_INTERNAL(Seed, Counter, Random)         \
+    do                                                                    \
+    {                                                                     \
+        fmi3UInt64 _z = (Seed) + ((Counter) + 1) * 0x9E3779B97F4A7C15ULL; \
+        _z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ULL;                   \
+        _z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBULL;                   \
+        (Random) = _z ^ (_z >> 31);                                       \
+    }                                                                     \
+    while (0)
+
+/**
+ * \brief Decides whether a transmit operation with the given key is replaced, without changing any state.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_INJECT_DECIDE_INTERNAL(Injector, Key, Rule, Hit)                            \
+    do                                                                                          \
+    {                                                                                           \
+        size_t _ruleIndex;                                                                      \
+        (Rule) = NULL;                                                                          \
+        (Hit) = fmi3False;                                                                      \
+        for (_ruleIndex = 0; _ruleIndex < (Injector)->ruleCount; _ruleIndex++)                  \
+        {                                                                                       \
+            if ((Injector)->rules[_ruleIndex].key == (fmi3UInt32)(Key) ||                       \
+                (Injector)->rules[_ruleIndex].key == FMI3_LS_BUS_INJECT_ANY)                    \
+            {                                                                                   \
+                (Rule) = &(Injector)->rules[_ruleIndex];                                        \
+                break;                                                                          \
+            }                                                                                   \
+        }                                                                                       \
+        if ((Rule) != NULL)                                                                     \
+        {                                                                                       \
+            fmi3UInt64 _random;                                                                 \
+            FMI3_LS_BUS_INJECT_RANDOM_INTERNAL((Injector)->seed, (Injector)->counter, _random); \
+            (Hit) = (Rule)->remaining > 0 || (fmi3UInt32)(_random >> 32) < (Rule)->probability  \
+                        ? fmi3True                                                              \
+                        : fmi3False;                                                            \
+        }                                                                                       \
+    }                                                                                           \
+    while (0)
+
+/**
+ * \brief Updates the state after a decision of \ref FMI3_LS_BUS_INJECT_DECIDE_INTERNAL was applied.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_INJECT_COMMIT_INTERNAL(Injector, Rule, Hit)                     \
+    do                                                                              \
+    {                                                                               \
+        (Injector)->counter++;                                                      \
+        if (Hit)                                                                    \
+        {                                                                           \
+            (Rule)->remaining = (Rule)->remaining > 0 ? (Rule)->remaining - 1       \
+                                : (Rule)->burstLength > 0 ? (Rule)->burstLength - 1 \
+                                                          : 0;                      \
+            (Injector)->injected++;                                                 \
+        }                                                                           \
+    }                                                                               \
+    while (0)
+
+/**
+ * \brief Copies an operation of `Length` bytes to a buffer.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_INJECT_COPY_INTERNAL(BufferInfo, Operation, Length) \
+    do                                                                  \
+    {                                                                   \
+        memcpy((BufferInfo)->writePos, (Operation), (Length));          \
+        (BufferInfo)->writePos += (Length);                             \
+        FMI3_LS_BUS_STATISTICS_WRITE_INTERNAL((BufferInfo), (Length));  \
+    }                                                                   \
+    while (0)
+
+/**
+ * \brief Copies the CAN operations of `InBufferInfo` to `OutBufferInfo`, replacing transmit operations
+ *        selected by the rules with Bus Error operations.
+ *
+ * CAN, CAN FD and CAN XL transmit operations are matched by their ID. The Bus Error operations created in
+ * `OutBufferInfo` are meant for the receiving nodes and have `isSender` set to false. If `SenderBufferInfo`
+ * is not NULL, a Bus Error operation with `isSender` set to true is also created there for the transmitting
+ * node. Bit and ACK errors are flagged as detected first by the transmitting node, all other errors as
+ * detected first by the receiving nodes.
+ *
+ * If `OutBufferInfo` or, for a replaced operation, `SenderBufferInfo` has not enough space left, the status
+ * of this buffer is set to `fmi3False` and the remaining operations stay in `InBufferInfo`, so that the macro
+ * can be called again later with the same result. An operation length shorter than the operation header or
+ * exceeding the remaining data makes the framing of the remaining data unreliable: the remaining data of
+ * `InBufferInfo` is discarded and `OutBufferInfo->status` is set to `fmi3False`.
+ *
+ * \param[in] Injector          Pointer to \ref fmi3LsBusUtilInjector.
+ * \param[in] InBufferInfo      Pointer to \ref fmi3LsBusUtilBufferInfo to read the operations from.
+ * \param[in] OutBufferInfo     Pointer to \ref fmi3LsBusUtilBufferInfo to write the operations to.
+ * \param[in] SenderBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo of the transmitting node, may be NULL.
+ */
+#define FMI3_LS_BUS_INJECT_CAN(Injector, InBufferInfo, OutBufferInfo, SenderBufferInfo)                                                \
+    do                                                                                                                                 \
+    {                                                                                                                                  \
+        fmi3LsBusUtilBufferInfo* _senderBufferInfo = (SenderBufferInfo);                                                               \
+        (OutBufferInfo)->status = fmi3True;                                                                                            \
+        if (_senderBufferInfo != NULL)                                                                                                 \
+        {                                                                                                                              \
+            _senderBufferInfo->status = fmi3True;                                                                                      \
+        }                                                                                                                              \
+        while ((size_t)((InBufferInfo)->writePos - (InBufferInfo)->readPos) >= sizeof(fmi3LsBusOperationHeader))                       \
+        {                                                                                                                              \
+            const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(InBufferInfo)->readPos;                        \
+            const size_t _opLength = (size_t)FMI3_LS_BUS_LOAD_LE32((InBufferInfo)->readPos + sizeof(fmi3LsBusOperationCode));          \
+            const fmi3LsBusOperationCode _opCode = (fmi3LsBusOperationCode)FMI3_LS_BUS_GET_LE(_header->opCode);                        \
+            fmi3LsBusUtilInjectRule* _rule = NULL;                                                                                     \
+            fmi3Boolean _hit = fmi3False;                                                                                              \
+            fmi3LsBusCanId _id = 0;                                                                                                    \
+            fmi3Boolean _transmit = (_opCode == FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT ||                                                     \
+                                     _opCode == FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT ||                                                   \
+                                     _opCode == FMI3_LS_BUS_CAN_OP_CANXL_TRANSMIT) &&                                                  \
+                                            _opLength >= sizeof(fmi3LsBusOperationHeader) + sizeof(fmi3LsBusCanId)                     \
+                                        ? fmi3True                                                                                     \
+                                        : fmi3False;                                                                                   \
+            if (_opLength < sizeof(fmi3LsBusOperationHeader) ||                                                                        \
+                _opLength > (size_t)((InBufferInfo)->writePos - (InBufferInfo)->readPos))                                              \
+            {                                                                                                                          \
+                (OutBufferInfo)->status = fmi3False;                                                                                   \
+                (InBufferInfo)->readPos = (InBufferInfo)->writePos;                                                                    \
+                break;                                                                                                                 \
+            }                                                                                                                          \
+            if (_transmit)                                                                                                             \
+            {                                                                                                                          \
+                _id = (fmi3LsBusCanId)FMI3_LS_BUS_GET_LE(((const fmi3LsBusCanOperationCanTransmit*)_header)->id);                      \
+                FMI3_LS_BUS_INJECT_DECIDE_INTERNAL((Injector), _id, _rule, _hit);                                                      \
+            }                                                                                                                          \
+            if ((size_t)((OutBufferInfo)->end - (OutBufferInfo)->writePos) <                                                           \
+                (_hit ? sizeof(fmi3LsBusCanOperationBusError) : _opLength))                                                            \
+            {                                                                                                                          \
+                (OutBufferInfo)->status = fmi3False;                                                                                   \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                                               \
+                break;                                                                                                                 \
+            }                                                                                                                          \
+            if (_hit && _senderBufferInfo != NULL &&                                                                                   \
+                (size_t)(_senderBufferInfo->end - _senderBufferInfo->writePos) < sizeof(fmi3LsBusCanOperationBusError))                \
+            {                                                                                                                          \
+                _senderBufferInfo->status = fmi3False;                                                                                 \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(_senderBufferInfo);                                                           \
+                break;                                                                                                                 \
+            }                                                                                                                          \
+            if (_transmit)                                                                                                             \
+            {                                                                                                                          \
+                FMI3_LS_BUS_INJECT_COMMIT_INTERNAL((Injector), _rule, _hit);                                                           \
+            }                                                                                                                          \
+            if (_hit)                                                                                                                  \
+            {                                                                                                                          \
+                const fmi3Boolean _senderFirst =                                                                                       \
+                    _rule->error == FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_BIT_ERROR ||                                             \
+                            _rule->error == FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_ACK_ERROR                                        \
+                        ? fmi3True                                                                                                     \
+                        : fmi3False;                                                                                                   \
+                FMI3_LS_BUS_CAN_CREATE_OP_BUS_ERROR((OutBufferInfo), _id, _rule->error,                                                \
+                                                    _senderFirst ? FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_SECONDARY_ERROR_FLAG      \
+                                                                 : FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_PRIMARY_ERROR_FLAG,       \
+                                                    FMI3_LS_BUS_FALSE);                                                                \
+                if (_senderBufferInfo != NULL)                                                                                         \
+                {                                                                                                                      \
+                    FMI3_LS_BUS_CAN_CREATE_OP_BUS_ERROR(_senderBufferInfo, _id, _rule->error,                                          \
+                                                        _senderFirst ? FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_PRIMARY_ERROR_FLAG    \
+                                                                     : FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_SECONDARY_ERROR_FLAG, \
+                                                        FMI3_LS_BUS_TRUE);                                                             \
+                }                                                                                                                      \
+            }                                                                                                                          \
+            else                                                                                                                       \
+            {                                                                                                                          \
+                FMI3_LS_BUS_INJECT_COPY_INTERNAL((OutBufferInfo), _header, _opLength);                                                 \
+            }                                                                                                                          \
+            (InBufferInfo)->readPos += _opLength;                                                                                      \
+        }                                                                                                                              \
+    }                                                                                                                                  \
+    while (0)
+
+/**
+ * \brief Copies the FlexRay operations of `InBufferInfo` to `OutBufferInfo`, replacing transmit operations
+ *        selected by the rules with Bus Error operations.
+ *
+ * Transmit operations are matched by their slot ID. The Bus Error operations carry the error flags of the
+ * rule, the cycle, slot and channel of the replaced transmit operation. If `SenderBufferInfo` is not NULL,
+ * the same Bus Error operation is also created there for the transmitting node.
+ *
+ * If `OutBufferInfo` or, for a replaced operation, `SenderBufferInfo` has not enough space left, the status
+ * of this buffer is set to `fmi3False` and the remaining operations stay in `InBufferInfo`, so that the macro
+ * can be called again later with the same result. An operation length shorter than the operation header or
+ * exceeding the remaining data makes the framing of the remaining data unreliable: the remaining data of
+ * `InBufferInfo` is discarded and `OutBufferInfo->status` is set to `fmi3False`.
+ *
+ * \param[in] Injector          Pointer to \ref fmi3LsBusUtilInjector.
+ * \param[in] InBufferInfo      Pointer to \ref fmi3LsBusUtilBufferInfo to read the operations from.
+ * \param[in] OutBufferInfo     Pointer to \ref fmi3LsBusUtilBufferInfo to write the operations to.
+ * \param[in] SenderBufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo of the transmitting node, may be NULL.
+ */
+#define FMI3_LS_BUS_INJECT_FLEXRAY(Injector, InBufferInfo, OutBufferInfo, SenderBufferInfo)                                   \
+    do                                                                                                                        \
+    {                                                                                                                         \
+        fmi3LsBusUtilBufferInfo* _senderBufferInfo = (SenderBufferInfo);                                                      \
+        (OutBufferInfo)->status = fmi3True;                                                                                   \
+        if (_senderBufferInfo != NULL)                                                                                        \
+        {                                                                                                                     \
+            _senderBufferInfo->status = fmi3True;                                                                             \
+        }                                                                                                                     \
+        while ((size_t)((InBufferInfo)->writePos - (InBufferInfo)->readPos) >= sizeof(fmi3LsBusOperationHeader))              \
+        {                                                                                                                     \
+            const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(InBufferInfo)->readPos;               \
+            const size_t _opLength = (size_t)FMI3_LS_BUS_LOAD_LE32((InBufferInfo)->readPos + sizeof(fmi3LsBusOperationCode)); \
+            const fmi3LsBusFlexRayOperationTransmit* _tx = (const fmi3LsBusFlexRayOperationTransmit*)_header;                 \
+            fmi3LsBusUtilInjectRule* _rule = NULL;                                                                            \
+            fmi3Boolean _hit = fmi3False;                                                                                     \
+            const fmi3Boolean _transmit = FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT &&           \
+                                                  _opLength >= sizeof(fmi3LsBusFlexRayOperationTransmit)                      \
+                                              ? fmi3True                                                                      \
+                                              : fmi3False;                                                                    \
+            if (_opLength < sizeof(fmi3LsBusOperationHeader) ||                                                               \
+                _opLength > (size_t)((InBufferInfo)->writePos - (InBufferInfo)->readPos))                                     \
+            {                                                                                                                 \
+                (OutBufferInfo)->status = fmi3False;                                                                          \
+                (InBufferInfo)->readPos = (InBufferInfo)->writePos;                                                           \
+                break;                                                                                                        \
+            }                                                                                                                 \
+            if (_transmit)                                                                                                    \
+            {                                                                                                                 \
+                FMI3_LS_BUS_INJECT_DECIDE_INTERNAL((Injector), FMI3_LS_BUS_GET_LE(_tx->slotId), _rule, _hit);                 \
+            }                                                                                                                 \
+            if ((size_t)((OutBufferInfo)->end - (OutBufferInfo)->writePos) <                                                  \
+                (_hit ? sizeof(fmi3LsBusFlexRayOperationBusError) : _opLength))                                               \
+            {                                                                                                                 \
+                (OutBufferInfo)->status = fmi3False;                                                                          \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(OutBufferInfo);                                                      \
+                break;                                                                                                        \
+            }                                                                                                                 \
+            if (_hit && _senderBufferInfo != NULL &&                                                                          \
+                (size_t)(_senderBufferInfo->end - _senderBufferInfo->writePos) < sizeof(fmi3LsBusFlexRayOperationBusError))   \
+            {                                                                                                                 \
+                _senderBufferInfo->status = fmi3False;                                                                        \
+                FMI3_LS_BUS_STATISTICS_OVERFLOW_INTERNAL(_senderBufferInfo);                                                  \
+                break;                                                                                                        \
+            }                                                                                                                 \
+            if (_transmit)                                                                                                    \
+            {                                                                                                                 \
+                FMI3_LS_BUS_INJECT_COMMIT_INTERNAL((Injector), _rule, _hit);                                                  \
+            }                                                                                                                 \
+            if (_hit)                                                                                                         \
+            {                                                                                                                 \
+                FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR((OutBufferInfo), _rule->error, _tx->cycleId,                          \
+                                                        FMI3_LS_BUS_GET_LE(_tx->slotId), _tx->channel);                       \
+                if (_senderBufferInfo != NULL)                                                                                \
+                {                                                                                                             \
+                    FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR(_senderBufferInfo, _rule->error, _tx->cycleId,                    \
+                                                            FMI3_LS_BUS_GET_LE(_tx->slotId), _tx->channel);                   \
+                }                                                                                                             \
+            }                                                                                                                 \
+            else                                                                                                              \
+            {                                                                                                                 \
+                FMI3_LS_BUS_INJECT_COPY_INTERNAL((OutBufferInfo), _header, _opLength);                                        \
+            }                                                                                                                 \
+            (InBufferInfo)->readPos += _opLength;                                                                             \
+        }                                                                                                                     \
+    }                                                                                                                         \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilInject_h */
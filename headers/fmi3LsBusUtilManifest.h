@@ -0,0 +1,297 @@
+#ifndef fmi3LsBusUtilManifest_h
+#define fmi3LsBusUtilManifest_h
+
+/*
+This header file contains utility macros to parse and validate the FMI-LS-BUS
+layered standard manifest file (extra/org.fmi-standard.fmi-ls-bus/fmi-ls-manifest.xml)
+and to cache the parsed result in a binary form that can be memory-mapped.
+
+This header can be used when creating importers.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtilXml.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief The fixed value of the attribute `fmi-ls:fmi-ls-name` of the manifest file.
+ */
+#define FMI3_LS_BUS_MANIFEST_LS_NAME "org.fmi-standard.fmi-ls-bus"
+
+/**
+ * \brief The fixed value of the attribute `fmi-ls:fmi-ls-description` of the manifest file.
+ */
+#define FMI3_LS_BUS_MANIFEST_LS_DESCRIPTION                                                                                         \
+    "Layered Standard for the simulation of bus communication on a Physical Signal Abstraction or Network Abstraction based level."
+
+/**
+ * \brief Maximum length of the attribute `fmi-ls:fmi-ls-version` including the terminating null character.
+ */
+#define FMI3_LS_BUS_MANIFEST_MAX_VERSION_LENGTH 32
+
+/**
+ * \brief Magic number identifying a cache entry of type \ref fmi3LsBusUtilManifest ('FLBM').
+ */
+#define FMI3_LS_BUS_MANIFEST_CACHE_MAGIC ((fmi3UInt32)0x4D424C46)
+
+/**
+ * \brief Version of the binary layout of \ref fmi3LsBusUtilManifest.
+ */
+#define FMI3_LS_BUS_MANIFEST_CACHE_FORMAT_VERSION ((fmi3UInt32)0x1)
+
+/**
+ * \brief Initial value of the hash computed by \ref FMI3_LS_BUS_MANIFEST_HASH.
+ */
+#define FMI3_LS_BUS_MANIFEST_HASH_INIT ((fmi3UInt64)0xCBF29CE484222325ULL)
+
+#pragma pack(1)
+
+/**
+ * \brief Parsed content of a FMI-LS-BUS manifest file.
+ *
+ * The structure has a fixed size of 64 bytes and does not contain pointers. Therefore, an array of
+ * this structure can be written to a file as it is and later be memory-mapped to skip parsing the
+ * XML text when the same FMU is loaded again (see \ref FMI3_LS_BUS_MANIFEST_CACHE_FIND).
+ * The cache is meant to be used on the host that created it, numbers are stored in host byte order.
+ */
+typedef struct
+{
+    fmi3UInt32 magic;                                         /**< Always \ref FMI3_LS_BUS_MANIFEST_CACHE_MAGIC. */
+    fmi3UInt32 formatVersion;                                 /**< Always \ref FMI3_LS_BUS_MANIFEST_CACHE_FORMAT_VERSION. */
+    fmi3UInt64 contentHash;                                   /**< Hash of the FMU content this entry belongs to. */
+    fmi3LsBusBoolean isBusSimulationFMU;                      /**< Value of the attribute `isBusSimulationFMU`. */
+    fmi3Char version[FMI3_LS_BUS_MANIFEST_MAX_VERSION_LENGTH]; /**< Null-terminated value of the attribute `fmi-ls:fmi-ls-version`. */
+    fmi3UInt8 reserved[15];                                   /**< Reserved, always zero. */
+} fmi3LsBusUtilManifest;
+
+#if FMI3_LS_BUS_CHECK_OPERATION_SIZE == 1
+/* Checks the size of 'fmi3LsBusUtilManifest' to make sure the instruction #pragma pack(1) is taken into account. */
+static_assert(sizeof(fmi3LsBusUtilManifest) == 64, "'fmi3LsBusUtilManifest' does not match the expected data size");
+#endif
+
+#pragma pack()
+
+
+/**
+ * \brief Updates a 64-bit FNV-1a hash with the specified data.
+ *
+ * This macro can be used to compute the content hash of an FMU, which is used as key of the manifest cache.
+ * The hash must be initialized with \ref FMI3_LS_BUS_MANIFEST_HASH_INIT and can be updated several times,
+ * e.g. once for each file of the FMU.
+ *
+ * \param[in,out] Hash        Variable of type fmi3UInt64 holding the hash.
+ * \param[in]     Data        Pointer to the data.
+ * \param[in]     DataLength  Length of the data in bytes.
+ */
+#define FMI3_LS_BUS_MANIFEST_HASH(Hash, Data, DataLength)                     \
+    do                                                                        \
+    {                                                                         \
+        const fmi3UInt8* _hashData = (const fmi3UInt8*)(Data);                \
+        size_t _hashIndex;                                                    \
+        for (_hashIndex = 0; _hashIndex < (size_t)(DataLength); _hashIndex++) \
+        {                                                                     \
+            (Hash) ^= _hashData[_hashIndex];                                  \
+            (Hash) *= (fmi3UInt64)0x100000001B3ULL;                           \
+        }                                                                     \
+    }                                                                         \
+    while (0)
+
+/**
+ * \brief Parses and validates a FMI-LS-BUS manifest file.
+ *
+ * This macro parses the XML text of a manifest file and validates it against the rules of the schema
+ * `fmi3LayeredStandardBusManifest.xsd`:
+ * - The root element is `fmiLayeredStandardManifest` and has no content.
+ * - The attributes `fmi-ls:fmi-ls-name` and `fmi-ls:fmi-ls-description` are present and have their fixed values.
+ * - The attribute `fmi-ls:fmi-ls-version` is present.
+ * - The optional attribute `isBusSimulationFMU` is a valid `xs:boolean` value (default: false).
+ * - No other attributes than namespace declarations and `xsi` attributes are present.
+ *
+ * No memory is allocated. If the manifest is valid, `Status` is set to fmi3True and all fields of `Manifest`
+ * are set, otherwise `Status` is set to fmi3False.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilManifest manifest;
+ * fmi3Boolean status;
+ * FMI3_LS_BUS_MANIFEST_PARSE(&manifest, xmlText, xmlTextLength, contentHash, status);
+ * \endcode
+ *
+ * \param[out] Manifest     Pointer to variable of type \ref fmi3LsBusUtilManifest.
+ * \param[in]  Xml          Pointer to the XML text of the manifest file.
+ * \param[in]  XmlLength    Length of the XML text in bytes.
+ * \param[in]  ContentHash  Hash of the FMU content stored as cache key (see \ref FMI3_LS_BUS_MANIFEST_HASH).
+ * \param[out] Status       Variable of type fmi3Boolean set to the validation result.
+ */
+#define FMI3_LS_BUS_MANIFEST_PARSE(Manifest, Xml, XmlLength, ContentHash, Status)                                       \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        fmi3LsBusUtilXmlReader _reader;                                                                                 \
+        fmi3Boolean _hasLsName = fmi3False;                                                                             \
+        fmi3Boolean _hasLsVersion = fmi3False;                                                                          \
+        fmi3Boolean _hasLsDescription = fmi3False;                                                                      \
+        memset((Manifest), 0, sizeof(fmi3LsBusUtilManifest));                                                           \
+        (Manifest)->isBusSimulationFMU = FMI3_LS_BUS_FALSE;                                                             \
+        (Status) = fmi3False;                                                                                           \
+                                                                                                                        \
+        FMI3_LS_BUS_XML_READER_INIT(&_reader, (Xml), (XmlLength));                                                      \
+        FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&_reader);                                                                    \
+        if (_reader.status && !_reader.isEndTag &&                                                                      \
+            FMI3_LS_BUS_XML_ELEMENT_IS(&_reader, "fmiLayeredStandardManifest"))                                         \
+        {                                                                                                               \
+            (Status) = fmi3True;                                                                                        \
+            FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                              \
+            while (_reader.status && (Status))                                                                          \
+            {                                                                                                           \
+                if (FMI3_LS_BUS_XML_EQUALS_QUALIFIED(_reader.attributeName, _reader.attributeNameLength,                \
+                                                     "fmi-ls-name"))                                                    \
+                {                                                                                                       \
+                    _hasLsName = fmi3True;                                                                              \
+                    (Status) = FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, FMI3_LS_BUS_MANIFEST_LS_NAME);              \
+                }                                                                                                       \
+                else if (FMI3_LS_BUS_XML_EQUALS_QUALIFIED(_reader.attributeName, _reader.attributeNameLength,           \
+                                                          "fmi-ls-version"))                                            \
+                {                                                                                                       \
+                    _hasLsVersion = fmi3True;                                                                           \
+                    if (_reader.attributeValueLength > 0 &&                                                             \
+                        _reader.attributeValueLength < FMI3_LS_BUS_MANIFEST_MAX_VERSION_LENGTH)                         \
+                    {                                                                                                   \
+                        memcpy((Manifest)->version, _reader.attributeValue, _reader.attributeValueLength);              \
+                    }                                                                                                   \
+                    else                                                                                                \
+                    {                                                                                                   \
+                        (Status) = fmi3False;                                                                           \
+                    }                                                                                                   \
+                }                                                                                                       \
+                else if (FMI3_LS_BUS_XML_EQUALS_QUALIFIED(_reader.attributeName, _reader.attributeNameLength,           \
+                                                          "fmi-ls-description"))                                        \
+                {                                                                                                       \
+                    _hasLsDescription = fmi3True;                                                                       \
+                    (Status) = FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, FMI3_LS_BUS_MANIFEST_LS_DESCRIPTION);       \
+                }                                                                                                       \
+                else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "isBusSimulationFMU"))                                  \
+                {                                                                                                       \
+                    if (FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "true") ||                                         \
+                        FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "1"))                                              \
+                    {                                                                                                   \
+                        (Manifest)->isBusSimulationFMU = FMI3_LS_BUS_TRUE;                                              \
+                    }                                                                                                   \
+                    else if (!FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "false") &&                                  \
+                             !FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "0"))                                        \
+                    {                                                                                                   \
+                        (Status) = fmi3False;                                                                           \
+                    }                                                                                                   \
+                }                                                                                                       \
+                else if (!FMI3_LS_BUS_XML_ATTRIBUTE_IS_SCHEMA_INFO(&_reader))                                           \
+                {                                                                                                       \
+                    (Status) = fmi3False;                                                                               \
+                }                                                                                                       \
+                FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                          \
+            }                                                                                                           \
+                                                                                                                        \
+            if (!FMI3_LS_BUS_XML_ATTRIBUTES_COMPLETE(&_reader) || !_hasLsName || !_hasLsVersion ||                      \
+                !_hasLsDescription)                                                                                     \
+            {                                                                                                           \
+                (Status) = fmi3False;                                                                                   \
+            }                                                                                                           \
+            else if ((Status) && !_reader.isEmptyElement)                                                               \
+            {                                                                                                           \
+                /* The root element must not have any child elements. */                                                \
+                FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&_reader);                                                            \
+                (Status) = (_reader.status && _reader.isEndTag &&                                                       \
+                            FMI3_LS_BUS_XML_ELEMENT_IS(&_reader, "fmiLayeredStandardManifest")) ? fmi3True : fmi3False; \
+            }                                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        if (Status)                                                                                                     \
+        {                                                                                                               \
+            (Manifest)->magic = FMI3_LS_BUS_MANIFEST_CACHE_MAGIC;                                                       \
+            (Manifest)->formatVersion = FMI3_LS_BUS_MANIFEST_CACHE_FORMAT_VERSION;                                      \
+            (Manifest)->contentHash = (ContentHash);                                                                    \
+        }                                                                                                               \
+    }                                                                                                                   \
+    while (0)
+
+/**
+ * \brief Looks up a parsed manifest in a cache of type \ref fmi3LsBusUtilManifest[].
+ *
+ * The cache is an array of \ref fmi3LsBusUtilManifest entries created with \ref FMI3_LS_BUS_MANIFEST_PARSE,
+ * e.g. a memory-mapped file. Entries with another magic number or format version are ignored.
+ *
+ * Example:
+ * \code
+ * const fmi3LsBusUtilManifest* manifest;
+ * FMI3_LS_BUS_MANIFEST_CACHE_FIND(cacheStart, cacheSize, contentHash, manifest);
+ * if (manifest == NULL)
+ * {
+ *     // Parse manifest file and append result to the cache
+ * }
+ * \endcode
+ *
+ * \param[in]  Cache        Pointer to the start of the cache.
+ * \param[in]  CacheSize    Size of the cache in bytes.
+ * \param[in]  ContentHash  Hash of the FMU content (see \ref FMI3_LS_BUS_MANIFEST_HASH).
+ * \param[out] Manifest     Variable of type const \ref fmi3LsBusUtilManifest* set to the matching entry or NULL.
+ */
+#define FMI3_LS_BUS_MANIFEST_CACHE_FIND(Cache, CacheSize, ContentHash, Manifest)                    \
+    do                                                                                              \
+    {                                                                                               \
+        const fmi3LsBusUtilManifest* _entries = (const fmi3LsBusUtilManifest*)(Cache);              \
+        size_t _entryCount = (size_t)(CacheSize) / sizeof(fmi3LsBusUtilManifest);                   \
+        size_t _entryIndex;                                                                         \
+        (Manifest) = NULL;                                                                          \
+        for (_entryIndex = 0; _entryIndex < _entryCount; _entryIndex++)                             \
+        {                                                                                           \
+            if (_entries[_entryIndex].magic == FMI3_LS_BUS_MANIFEST_CACHE_MAGIC &&                  \
+                _entries[_entryIndex].formatVersion == FMI3_LS_BUS_MANIFEST_CACHE_FORMAT_VERSION && \
+                _entries[_entryIndex].contentHash == (ContentHash))                                 \
+            {                                                                                       \
+                (Manifest) = &_entries[_entryIndex];                                                \
+                break;                                                                              \
+            }                                                                                       \
+        }                                                                                           \
+    }                                                                                               \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilManifest_h */
@@ -0,0 +1,290 @@
+#ifndef fmi3LsBusUtilOnChange_h
+#define fmi3LsBusUtilOnChange_h
+
+/*
+This header file contains utility macros to suppress the transmission of cyclic frames whose payload
+did not change since their last transmission. A shadow copy of the last submitted payload is kept per
+CAN ID or FlexRay slot and compared with the new payload before the operation is submitted.
+
+This header can be used by FMUs whose receivers only need to process changed frames.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+#include "fmi3LsBusUtilFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Maximum payload length kept in the shadow copy. Longer payloads are never suppressed.
+ */
+#ifndef FMI3_LS_BUS_ON_CHANGE_MAX_DATA_LENGTH
+#define FMI3_LS_BUS_ON_CHANGE_MAX_DATA_LENGTH 64
+#endif
+
+/**
+ * \brief Shadow copy of the last submitted payload of a CAN ID or FlexRay slot.
+ */
+typedef struct
+{
+    fmi3UInt32 key;                                           /**< CAN ID or FlexRay slot and channel. */
+    fmi3Boolean used;                                         /**< Whether the entry holds a payload. */
+    fmi3UInt16 dataLength;                                    /**< Length of the payload. */
+    fmi3UInt32 suppressed;                                    /**< Consecutive suppressed transmissions. */
+    fmi3UInt8 data[FMI3_LS_BUS_ON_CHANGE_MAX_DATA_LENGTH];    /**< Last submitted payload. */
+} fmi3LsBusUtilOnChangeEntry;
+
+/**
+ * \brief This data type holds the state of an on-change filter.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_ON_CHANGE_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusUtilOnChangeEntry* entries; /**< Hash table of shadow copies, provided by the caller. */
+    size_t capacity;                     /**< Number of entries, a power of 2. */
+    fmi3UInt32 maxSuppressed;            /**< Maximum consecutive suppressed transmissions, 0 for no limit. */
+    fmi3UInt64 submitted;                /**< Number of submitted transmissions of filtered frames. */
+    fmi3UInt64 suppressed;               /**< Number of suppressed transmissions. */
+} fmi3LsBusUtilOnChange;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilOnChange.
+ *
+ * If `MaxSuppressed` is not 0, an unchanged frame is submitted anyway after `MaxSuppressed` consecutive
+ * transmissions were suppressed, e.g. to keep timeout monitoring of receivers satisfied.
+ *
+ * \param[in] Filter         Pointer to \ref fmi3LsBusUtilOnChange.
+ * \param[in] Entries        Array of \ref fmi3LsBusUtilOnChangeEntry.
+ * \param[in] Capacity       Number of elements of `Entries`, a power of 2 greater than the number of filtered
+ *                           CAN IDs or FlexRay slots. Frames not fitting into the table are never suppressed.
+ * \param[in] MaxSuppressed  Maximum number of consecutive suppressed transmissions, 0 for no limit.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_INIT(Filter, Entries, Capacity, MaxSuppressed)           \
+    do                                                                                 \
+    {                                                                                  \
+        memset((Entries), 0, sizeof(fmi3LsBusUtilOnChangeEntry) * (size_t)(Capacity)); \
+        (Filter)->entries = (Entries);                                                 \
+        (Filter)->capacity = (size_t)(Capacity);                                       \
+        (Filter)->maxSuppressed = (MaxSuppressed);                                     \
+        (Filter)->submitted = 0;                                                       \
+        (Filter)->suppressed = 0;                                                      \
+    }                                                                                  \
+    while (0)
+
+/**
+ * \brief Looks up the entry of `Key` using linear probing, claiming a free entry if `Key` is not present.
+ *        `Entry` is set to NULL if the table is full.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_LOOKUP_INTERNAL(Filter, Key, Entry)                   \
+    do                                                                              \
+    {                                                                               \
+        fmi3UInt32 _hash = (fmi3UInt32)(Key) * 0x9E3779B1U;                         \
+        size_t _probe;                                                              \
+        size_t _index = (size_t)(_hash ^ (_hash >> 16)) & ((Filter)->capacity - 1); \
+        (Entry) = NULL;                                                             \
+        for (_probe = 0; _probe < (Filter)->capacity; _probe++)                     \
+        {                                                                           \
+            fmi3LsBusUtilOnChangeEntry* _candidate = &(Filter)->entries[_index];    \
+            if (!_candidate->used || _candidate->key == (fmi3UInt32)(Key))          \
+            {                                                                       \
+                (Entry) = _candidate;                                               \
+                break;                                                              \
+            }                                                                       \
+            _index = (_index + 1) & ((Filter)->capacity - 1);                       \
+        }                                                                           \
+    }                                                                               \
+    while (0)
+
+/**
+ * \brief Determines whether a payload has to be submitted.
+ *
+ * The shadow copy is not updated; call \ref FMI3_LS_BUS_ON_CHANGE_UPDATE after the operation was submitted.
+ *
+ * \param[in] Filter      Pointer to \ref fmi3LsBusUtilOnChange.
+ * \param[in] Key         CAN ID or FlexRay slot identifying the frame.
+ * \param[in] DataLength  Length of the payload.
+ * \param[in] Data        Pointer to the payload.
+ * \param[out] Entry      Variable of type pointer to \ref fmi3LsBusUtilOnChangeEntry receiving the shadow copy
+ *                        to pass to \ref FMI3_LS_BUS_ON_CHANGE_UPDATE, or NULL if the frame is not filtered.
+ * \param[out] Changed    Variable of type fmi3Boolean set to fmi3True if the payload has to be submitted.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_CHECK(Filter, Key, DataLength, Data, Entry, Changed)           \
+    do                                                                                       \
+    {                                                                                        \
+        (Entry) = NULL;                                                                      \
+        (Changed) = fmi3True;                                                                \
+        if ((size_t)(DataLength) <= FMI3_LS_BUS_ON_CHANGE_MAX_DATA_LENGTH)                   \
+        {                                                                                    \
+            FMI3_LS_BUS_ON_CHANGE_LOOKUP_INTERNAL((Filter), (Key), (Entry));                 \
+        }                                                                                    \
+        if ((Entry) != NULL && (Entry)->used && (Entry)->dataLength == (DataLength) &&       \
+            memcmp((Entry)->data, (Data), (size_t)(DataLength)) == 0 &&                      \
+            ((Filter)->maxSuppressed == 0 || (Entry)->suppressed < (Filter)->maxSuppressed)) \
+        {                                                                                    \
+            (Changed) = fmi3False;                                                           \
+            (Entry)->suppressed++;                                                           \
+            (Filter)->suppressed++;                                                          \
+        }                                                                                    \
+    }                                                                                        \
+    while (0)
+
+/**
+ * \brief Updates the shadow copy after the payload was submitted.
+ *
+ * \param[in] Filter      Pointer to \ref fmi3LsBusUtilOnChange.
+ * \param[in] Key         CAN ID or FlexRay slot identifying the frame.
+ * \param[in] DataLength  Length of the payload.
+ * \param[in] Data        Pointer to the payload.
+ * \param[in] Entry       Shadow copy returned by \ref FMI3_LS_BUS_ON_CHANGE_CHECK, may be NULL.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_UPDATE(Filter, Key, DataLength, Data, Entry) \
+    do                                                                     \
+    {                                                                      \
+        (Filter)->submitted++;                                             \
+        if ((Entry) != NULL)                                               \
+        {                                                                  \
+            (Entry)->key = (fmi3UInt32)(Key);                              \
+            (Entry)->used = fmi3True;                                      \
+            (Entry)->dataLength = (fmi3UInt16)(DataLength);                \
+            (Entry)->suppressed = 0;                                       \
+            memcpy((Entry)->data, (Data), (size_t)(DataLength));           \
+        }                                                                  \
+    }                                                                      \
+    while (0)
+
+/**
+ * \brief Creates a CAN transmit operation unless its payload did not change since its last transmission.
+ *
+ * Takes the same arguments as \ref FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT. A suppressed operation is
+ * not an error, `BufferInfo->status` is set to `fmi3True` in this case.
+ *
+ * \param[in] Filter  Pointer to \ref fmi3LsBusUtilOnChange.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(Filter, BufferInfo, ID, Ide, Rtr, DataLength, Data)              \
+    do                                                                                                      \
+    {                                                                                                       \
+        fmi3LsBusUtilOnChangeEntry* _entry;                                                                 \
+        fmi3Boolean _changed;                                                                               \
+        const fmi3UInt32 _key = (fmi3UInt32)(ID) | ((Ide) ? 0x80000000U : 0);                               \
+        FMI3_LS_BUS_ON_CHANGE_CHECK((Filter), _key, (DataLength), (Data), _entry, _changed);                \
+        (BufferInfo)->status = fmi3True;                                                                    \
+        if (_changed)                                                                                       \
+        {                                                                                                   \
+            FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT((BufferInfo), (ID), (Ide), (Rtr), (DataLength), (Data)); \
+            if ((BufferInfo)->status)                                                                       \
+            {                                                                                               \
+                FMI3_LS_BUS_ON_CHANGE_UPDATE((Filter), _key, (DataLength), (Data), _entry);                 \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+    while (0)
+
+/**
+ * \brief Creates a CAN FD transmit operation unless its payload did not change since its last transmission.
+ *
+ * Takes the same arguments as \ref FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT. A suppressed operation is
+ * not an error, `BufferInfo->status` is set to `fmi3True` in this case.
+ *
+ * \param[in] Filter  Pointer to \ref fmi3LsBusUtilOnChange.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_CAN_FD_TRANSMIT(Filter, BufferInfo, ID, Ide, Brs, Esi, DataLength, Data)                \
+    do                                                                                                                \
+    {                                                                                                                 \
+        fmi3LsBusUtilOnChangeEntry* _entry;                                                                           \
+        fmi3Boolean _changed;                                                                                         \
+        const fmi3UInt32 _key = (fmi3UInt32)(ID) | ((Ide) ? 0x80000000U : 0);                                         \
+        FMI3_LS_BUS_ON_CHANGE_CHECK((Filter), _key, (DataLength), (Data), _entry, _changed);                          \
+        (BufferInfo)->status = fmi3True;                                                                              \
+        if (_changed)                                                                                                 \
+        {                                                                                                             \
+            FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT((BufferInfo), (ID), (Ide), (Brs), (Esi), (DataLength), (Data)); \
+            if ((BufferInfo)->status)                                                                                 \
+            {                                                                                                         \
+                FMI3_LS_BUS_ON_CHANGE_UPDATE((Filter), _key, (DataLength), (Data), _entry);                           \
+            }                                                                                                         \
+        }                                                                                                             \
+    }                                                                                                                 \
+    while (0)
+
+/**
+ * \brief Creates a FlexRay transmit operation unless its payload did not change since its last transmission
+ *        in the same slot and channel.
+ *
+ * Takes the same arguments as \ref FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT. Null frames are always submitted.
+ * A suppressed operation is not an error, `BufferInfo->status` is set to `fmi3True` in this case.
+ *
+ * \param[in] Filter  Pointer to \ref fmi3LsBusUtilOnChange.
+ */
+#define FMI3_LS_BUS_ON_CHANGE_FLEXRAY_TRANSMIT(Filter, BufferInfo, CycleId, SlotId, Channel, StartupFrameIndicator, \
+                                               SyncFrameIndicator, NullFrameIndicator, PayloadPreambleIndicator,    \
+                                               DataLength, Data)                                                    \
+    do                                                                                                              \
+    {                                                                                                               \
+        fmi3LsBusUtilOnChangeEntry* _entry = NULL;                                                                  \
+        fmi3Boolean _changed = fmi3True;                                                                            \
+        const fmi3UInt32 _key = (fmi3UInt32)(SlotId) | ((fmi3UInt32)(Channel) << 16);                               \
+        if (!(NullFrameIndicator))                                                                                  \
+        {                                                                                                           \
+            FMI3_LS_BUS_ON_CHANGE_CHECK((Filter), _key, (DataLength), (Data), _entry, _changed);                    \
+        }                                                                                                           \
+        (BufferInfo)->status = fmi3True;                                                                            \
+        if (_changed)                                                                                               \
+        {                                                                                                           \
+            FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT((BufferInfo), (CycleId), (SlotId), (Channel),                    \
+                                                   (StartupFrameIndicator), (SyncFrameIndicator),                   \
+                                                   (NullFrameIndicator), (PayloadPreambleIndicator), (DataLength),  \
+                                                   (Data));                                                         \
+            if ((BufferInfo)->status && !(NullFrameIndicator))                                                      \
+            {                                                                                                       \
+                FMI3_LS_BUS_ON_CHANGE_UPDATE((Filter), _key, (DataLength), (Data), _entry);                         \
+            }                                                                                                       \
+        }                                                                                                           \
+    }                                                                                                               \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilOnChange_h */
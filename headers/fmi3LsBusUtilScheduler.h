@@ -0,0 +1,424 @@
+#ifndef fmi3LsBusUtilScheduler_h
+#define fmi3LsBusUtilScheduler_h
+
+/*
+This header file contains utility macros to schedule the ticks of time-based and
+triggered Tx Clocks of Network FMUs, allowing importers to use event-driven
+stepping instead of polling.
+
+This header can be used when creating importers.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Constant returned by \ref FMI3_LS_BUS_SCHEDULER_NEXT_TIME if no Clock tick is scheduled.
+ */
+#define FMI3_LS_BUS_SCHEDULER_TIME_NONE ((fmi3UInt64)0xFFFFFFFFFFFFFFFFULL)
+
+/**
+ * \brief Scheduled Clock tick.
+ */
+typedef struct
+{
+    fmi3UInt64 time;     /**< Time of the Clock tick in nanoseconds. */
+    fmi3UInt64 interval; /**< Interval of periodic Clocks in nanoseconds, 0 for single ticks. */
+    fmi3UInt32 clock;    /**< Index of the Clock, e.g. the index of a \ref fmi3LsBusUtilBusRoute. */
+} fmi3LsBusUtilSchedulerEntry;
+
+/**
+ * \brief This data type holds the state of a Clock scheduler.
+ *
+ * The scheduler keeps the next tick of every Clock in a binary min-heap stored in a caller-provided array.
+ * Time-based Clocks with `constant`, `fixed` or `tunable` intervals are scheduled periodically by
+ * \ref FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC. Ticks of `countdown` Clocks and detected ticks of `triggered` Clocks
+ * are scheduled once by \ref FMI3_LS_BUS_SCHEDULER_ADD_TICK. While all buses are idle, periodic ticks can be
+ * skipped by \ref FMI3_LS_BUS_SCHEDULER_FAST_FORWARD.
+ */
+typedef struct
+{
+    fmi3LsBusUtilSchedulerEntry* entries; /**< Array holding the min-heap of scheduled Clock ticks. */
+    size_t capacity;                      /**< Number of elements of the array `entries`. */
+    size_t size;                          /**< Number of scheduled Clock ticks. */
+    fmi3UInt64 time;                      /**< Time of the last batch of Clock ticks in nanoseconds. */
+    fmi3UInt64 ticks;                     /**< Total number of Clock ticks returned. */
+    fmi3UInt64 batches;                   /**< Total number of batches of simultaneous Clock ticks returned. */
+    fmi3UInt64 skipped;                   /**< Total number of periodic Clock ticks skipped by \ref FMI3_LS_BUS_SCHEDULER_FAST_FORWARD. */
+    fmi3Boolean status;                   /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+} fmi3LsBusUtilScheduler;
+
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilScheduler.
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] Entries    Array of \ref fmi3LsBusUtilSchedulerEntry used to store the scheduled Clock ticks.
+ * \param[in] Capacity   Number of elements of the array `Entries`.
+ */
+#define FMI3_LS_BUS_SCHEDULER_INIT(Scheduler, Entries, Capacity) \
+    do                                                           \
+    {                                                            \
+        memset((Scheduler), 0, sizeof(fmi3LsBusUtilScheduler));  \
+        (Scheduler)->entries = (Entries);                        \
+        (Scheduler)->capacity = (Capacity);                      \
+        (Scheduler)->status = fmi3True;                          \
+    }                                                            \
+    while (0)
+
+/**
+ * \brief Checks whether entry `A` of the scheduler is due before entry `B`.
+ *
+ * Entries with the same time are ordered by Clock index to get a deterministic order within a batch.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SCHEDULER_BEFORE_INTERNAL(Scheduler, A, B)            \
+    ((Scheduler)->entries[(A)].time < (Scheduler)->entries[(B)].time ||   \
+     ((Scheduler)->entries[(A)].time == (Scheduler)->entries[(B)].time && \
+      (Scheduler)->entries[(A)].clock < (Scheduler)->entries[(B)].clock))
+
+/**
+ * \brief Restores the heap property after the entry at `Index` was decreased or appended.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SCHEDULER_SIFT_UP_INTERNAL(Scheduler, Index)                      \
+    do                                                                                \
+    {                                                                                 \
+        size_t _child = (Index);                                                      \
+        while (_child > 0)                                                            \
+        {                                                                             \
+            size_t _parent = (_child - 1) / 2;                                        \
+            fmi3LsBusUtilSchedulerEntry _swap;                                        \
+            if (!FMI3_LS_BUS_SCHEDULER_BEFORE_INTERNAL((Scheduler), _child, _parent)) \
+            {                                                                         \
+                break;                                                                \
+            }                                                                         \
+            _swap = (Scheduler)->entries[_parent];                                    \
+            (Scheduler)->entries[_parent] = (Scheduler)->entries[_child];             \
+            (Scheduler)->entries[_child] = _swap;                                     \
+            _child = _parent;                                                         \
+        }                                                                             \
+    }                                                                                 \
+    while (0)
+
+/**
+ * \brief Restores the heap property after the entry at `Index` was increased.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SCHEDULER_SIFT_DOWN_INTERNAL(Scheduler, Index)                                                   \
+    do                                                                                                               \
+    {                                                                                                                \
+        size_t _parent = (Index);                                                                                    \
+        for (;;)                                                                                                     \
+        {                                                                                                            \
+            size_t _first = 2 * _parent + 1;                                                                         \
+            size_t _smallest = _parent;                                                                              \
+            fmi3LsBusUtilSchedulerEntry _swap;                                                                       \
+            if (_first < (Scheduler)->size && FMI3_LS_BUS_SCHEDULER_BEFORE_INTERNAL((Scheduler), _first, _smallest)) \
+            {                                                                                                        \
+                _smallest = _first;                                                                                  \
+            }                                                                                                        \
+            if (_first + 1 < (Scheduler)->size &&                                                                    \
+                FMI3_LS_BUS_SCHEDULER_BEFORE_INTERNAL((Scheduler), _first + 1, _smallest))                           \
+            {                                                                                                        \
+                _smallest = _first + 1;                                                                              \
+            }                                                                                                        \
+            if (_smallest == _parent)                                                                                \
+            {                                                                                                        \
+                break;                                                                                               \
+            }                                                                                                        \
+            _swap = (Scheduler)->entries[_parent];                                                                   \
+            (Scheduler)->entries[_parent] = (Scheduler)->entries[_smallest];                                         \
+            (Scheduler)->entries[_smallest] = _swap;                                                                 \
+            _parent = _smallest;                                                                                     \
+        }                                                                                                            \
+    }                                                                                                                \
+    while (0)
+
+/**
+ * \brief Adds an entry to the scheduler.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SCHEDULER_PUSH_INTERNAL(Scheduler, Clock, Time, Interval)               \
+    do                                                                                      \
+    {                                                                                       \
+        if ((Scheduler)->size < (Scheduler)->capacity)                                      \
+        {                                                                                   \
+            fmi3LsBusUtilSchedulerEntry* _entry = &(Scheduler)->entries[(Scheduler)->size]; \
+            _entry->time = (Time);                                                          \
+            _entry->interval = (Interval);                                                  \
+            _entry->clock = (fmi3UInt32)(Clock);                                            \
+            (Scheduler)->size++;                                                            \
+            FMI3_LS_BUS_SCHEDULER_SIFT_UP_INTERNAL((Scheduler), (Scheduler)->size - 1);     \
+            (Scheduler)->status = fmi3True;                                                 \
+        }                                                                                   \
+        else                                                                                \
+        {                                                                                   \
+            (Scheduler)->status = fmi3False;                                                \
+        }                                                                                   \
+    }                                                                                       \
+    while (0)
+
+/**
+ * \brief Schedules a time-based Clock ticking periodically.
+ *
+ * This macro is intended for Tx Clocks with the interval variability `constant`, `fixed` or `tunable`.
+ * If the scheduler is full, the 'status' variable of the argument 'Scheduler' is set to fmi3False.
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] Clock      Index of the Clock.
+ * \param[in] Start      Time of the first Clock tick in nanoseconds.
+ * \param[in] Interval   Interval of the Clock in nanoseconds, must be greater than 0.
+ */
+#define FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(Scheduler, Clock, Start, Interval)                              \
+    FMI3_LS_BUS_SCHEDULER_PUSH_INTERNAL((Scheduler), (Clock), (fmi3UInt64)(Start), (fmi3UInt64)(Interval))
+
+/**
+ * \brief Schedules a single Clock tick.
+ *
+ * This macro is intended for Tx Clocks with the interval variability `countdown`, using the interval
+ * reported by the FMU, and for Tx Clocks with the interval variability `triggered`, using the time the
+ * importer detected the Clock tick at (e.g. an early return of fmi3DoStep).
+ * If the scheduler is full, the 'status' variable of the argument 'Scheduler' is set to fmi3False.
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] Clock      Index of the Clock.
+ * \param[in] Time       Time of the Clock tick in nanoseconds.
+ */
+#define FMI3_LS_BUS_SCHEDULER_ADD_TICK(Scheduler, Clock, Time)                       \
+    FMI3_LS_BUS_SCHEDULER_PUSH_INTERNAL((Scheduler), (Clock), (fmi3UInt64)(Time), 0)
+
+/**
+ * \brief Removes all scheduled ticks of a Clock, e.g. to change the interval of a `tunable` Clock.
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] Clock      Index of the Clock.
+ */
+#define FMI3_LS_BUS_SCHEDULER_REMOVE(Scheduler, Clock)                                  \
+    do                                                                                  \
+    {                                                                                   \
+        size_t _readIndex;                                                              \
+        size_t _writeIndex = 0;                                                         \
+        for (_readIndex = 0; _readIndex < (Scheduler)->size; _readIndex++)              \
+        {                                                                               \
+            if ((Scheduler)->entries[_readIndex].clock != (fmi3UInt32)(Clock))          \
+            {                                                                           \
+                (Scheduler)->entries[_writeIndex++] = (Scheduler)->entries[_readIndex]; \
+            }                                                                           \
+        }                                                                               \
+        (Scheduler)->size = _writeIndex;                                                \
+        for (_readIndex = (Scheduler)->size / 2; _readIndex > 0; _readIndex--)          \
+        {                                                                               \
+            FMI3_LS_BUS_SCHEDULER_SIFT_DOWN_INTERNAL((Scheduler), _readIndex - 1);      \
+        }                                                                               \
+    }                                                                                   \
+    while (0)
+
+/**
+ * \brief Returns the time of the next scheduled Clock tick in nanoseconds.
+ *
+ * The importer can step all FMUs up to this time without calling fmi3UpdateDiscreteStates or fmi3GetBinary.
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \return               The time of the next Clock tick or \ref FMI3_LS_BUS_SCHEDULER_TIME_NONE.
+ */
+#define FMI3_LS_BUS_SCHEDULER_NEXT_TIME(Scheduler)                                           \
+    ((Scheduler)->size > 0 ? (Scheduler)->entries[0].time : FMI3_LS_BUS_SCHEDULER_TIME_NONE)
+
+/**
+ * \brief Removes all Clock ticks due at the next scheduled time and returns their Clock indices.
+ *
+ * Periodic Clocks are rescheduled automatically. The `time` field of the scheduler is set to the time of the batch.
+ * If more Clocks tick simultaneously than `Capacity`, the remaining ticks are returned by the next call using
+ * the same time. If no Clock tick is scheduled, `Count` is set to 0.
+ *
+ * Example:
+ * \code
+ * while (FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler) <= stopTime)
+ * {
+ *     FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 16, count);
+ *     // Step all FMUs to scheduler.time and activate the Clocks clocks[0] ... clocks[count - 1]
+ * }
+ * \endcode
+ *
+ * \param[in]  Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[out] Clocks     Array of fmi3UInt32 receiving the Clock indices.
+ * \param[in]  Capacity   Number of elements of the array `Clocks`.
+ * \param[out] Count      Variable of type size_t set to the number of Clock indices returned.
+ */
+#define FMI3_LS_BUS_SCHEDULER_POP_BATCH(Scheduler, Clocks, Capacity, Count)                                 \
+    do                                                                                                      \
+    {                                                                                                       \
+        (Count) = 0;                                                                                        \
+        if ((Scheduler)->size > 0)                                                                          \
+        {                                                                                                   \
+            const fmi3UInt64 _batchTime = (Scheduler)->entries[0].time;                                     \
+            while ((Scheduler)->size > 0 && (Scheduler)->entries[0].time == _batchTime &&                   \
+                   (Count) < (size_t)(Capacity))                                                            \
+            {                                                                                               \
+                (Clocks)[(Count)++] = (Scheduler)->entries[0].clock;                                        \
+                if ((Scheduler)->entries[0].interval > 0)                                                   \
+                {                                                                                           \
+                    (Scheduler)->entries[0].time += (Scheduler)->entries[0].interval;                       \
+                }                                                                                           \
+                else                                                                                        \
+                {                                                                                           \
+                    (Scheduler)->size--;                                                                    \
+                    (Scheduler)->entries[0] = (Scheduler)->entries[(Scheduler)->size];                      \
+                }                                                                                           \
+                FMI3_LS_BUS_SCHEDULER_SIFT_DOWN_INTERNAL((Scheduler), 0);                                   \
+            }                                                                                               \
+            (Scheduler)->batches += ((Scheduler)->time != _batchTime || (Scheduler)->batches == 0) ? 1 : 0; \
+            (Scheduler)->time = _batchTime;                                                                 \
+            (Scheduler)->ticks += (Count);                                                                  \
+        }                                                                                                   \
+    }                                                                                                       \
+    while (0)
+
+/**
+ * \brief Returns the number of fmi3UpdateDiscreteStates/fmi3GetBinary call pairs saved compared to polling.
+ *
+ * The value is the number of calls a polling importer would have issued for `ClockCount` Clocks using a fixed
+ * `PollingStep` up to the time of the last batch, minus the number of Clock ticks returned by the scheduler.
+ *
+ * \param[in] Scheduler    Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] ClockCount   Number of Clocks handled by the scheduler.
+ * \param[in] PollingStep  Step size of the polling importer in nanoseconds.
+ * \return                 The number of saved call pairs as fmi3UInt64.
+ */
+#define FMI3_LS_BUS_SCHEDULER_SAVED_CALLS(Scheduler, ClockCount, PollingStep)                                  \
+    (((Scheduler)->time / (fmi3UInt64)(PollingStep) + 1) * (fmi3UInt64)(ClockCount) > (Scheduler)->ticks       \
+         ? ((Scheduler)->time / (fmi3UInt64)(PollingStep) + 1) * (fmi3UInt64)(ClockCount) - (Scheduler)->ticks \
+         : (fmi3UInt64)0)
+
+/**
+ * \brief Checks whether all given buffers are idle, i.e. hold no unread operations.
+ *
+ * This macro is intended for the Tx buffers of all bus routes after the importer retrieved and forwarded
+ * the operations of a communication point.
+ *
+ * \param[in]  BufferInfos  Array of \ref fmi3LsBusUtilBufferInfo.
+ * \param[in]  Count        Number of elements of the array `BufferInfos`.
+ * \param[out] Idle         Variable of type fmi3Boolean set to `fmi3True` if no buffer holds unread operations.
+ */
+#define FMI3_LS_BUS_SCHEDULER_BUSES_IDLE(BufferInfos, Count, Idle)                           \
+    do                                                                                       \
+    {                                                                                        \
+        size_t _bufferIndex;                                                                 \
+        (Idle) = fmi3True;                                                                   \
+        for (_bufferIndex = 0; _bufferIndex < (size_t)(Count); _bufferIndex++)               \
+        {                                                                                    \
+            if ((BufferInfos)[_bufferIndex].readPos != (BufferInfos)[_bufferIndex].writePos) \
+            {                                                                                \
+                (Idle) = fmi3False;                                                          \
+                break;                                                                       \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+    while (0)
+
+/**
+ * \brief Skips periodic Clock ticks up to the earliest time an event can occur on an idle bus simulation.
+ *
+ * If all buses are idle (see \ref FMI3_LS_BUS_SCHEDULER_BUSES_IDLE) and all nodes are sleeping, e.g. CAN nodes
+ * waiting for a Wakeup operation or FlexRay nodes before the Start Communication operation, the ticks of
+ * periodic Tx Clocks cannot produce any operation. A sleeping node only leaves this state as the result of an
+ * internal event of its FMU, which the importer knows from the `nextEventTime` returned by
+ * fmi3UpdateDiscreteStates, from `countdown` Clocks or from an early return of fmi3DoStep.
+ *
+ * The earliest time an event can occur is the minimum of `Time` and the next single Clock tick. All periodic
+ * Clock ticks before that time are skipped, the next tick of each periodic Clock stays aligned to its interval.
+ * Afterwards the importer can step all FMUs to the minimum of `Time` and \ref FMI3_LS_BUS_SCHEDULER_NEXT_TIME
+ * in a single step.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_SCHEDULER_BUSES_IDLE(txBufferInfos, routeCount, idle);
+ * if (idle && allNodesSleeping)
+ * {
+ *     FMI3_LS_BUS_SCHEDULER_FAST_FORWARD(&scheduler, nextEventTime < stopTime ? nextEventTime : stopTime);
+ * }
+ * \endcode
+ *
+ * \param[in] Scheduler  Pointer to variable of type \ref fmi3LsBusUtilScheduler.
+ * \param[in] Time       Earliest time an FMU reported an internal event at in nanoseconds.
+ */
+#define FMI3_LS_BUS_SCHEDULER_FAST_FORWARD(Scheduler, Time)                                                         \
+    do                                                                                                              \
+    {                                                                                                               \
+        fmi3UInt64 _limit = (fmi3UInt64)(Time);                                                                     \
+        size_t _entryIndex;                                                                                         \
+        for (_entryIndex = 0; _entryIndex < (Scheduler)->size; _entryIndex++)                                       \
+        {                                                                                                           \
+            if ((Scheduler)->entries[_entryIndex].interval == 0 && (Scheduler)->entries[_entryIndex].time < _limit) \
+            {                                                                                                       \
+                _limit = (Scheduler)->entries[_entryIndex].time;                                                    \
+            }                                                                                                       \
+        }                                                                                                           \
+        for (_entryIndex = 0; _entryIndex < (Scheduler)->size; _entryIndex++)                                       \
+        {                                                                                                           \
+            fmi3LsBusUtilSchedulerEntry* _entry = &(Scheduler)->entries[_entryIndex];                               \
+            if (_entry->interval > 0 && _entry->time < _limit)                                                      \
+            {                                                                                                       \
+                const fmi3UInt64 _skip = (_limit - _entry->time + _entry->interval - 1) / _entry->interval;         \
+                _entry->time += _skip * _entry->interval;                                                           \
+                (Scheduler)->skipped += _skip;                                                                      \
+            }                                                                                                       \
+        }                                                                                                           \
+        for (_entryIndex = (Scheduler)->size / 2; _entryIndex > 0; _entryIndex--)                                   \
+        {                                                                                                           \
+            FMI3_LS_BUS_SCHEDULER_SIFT_DOWN_INTERNAL((Scheduler), _entryIndex - 1);                                 \
+        }                                                                                                           \
+    }                                                                                                               \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilScheduler_h */
@@ -0,0 +1,293 @@
+#ifndef fmi3LsBusUtilShared_h
+#define fmi3LsBusUtilShared_h
+
+/*
+This header file contains utility macros to exchange FMI-LS-BUS operations
+between processes using a shared memory region. The Tx buffer written by one
+process is directly readable as the Rx buffer of another process. Each hand-off
+is protected by a sequence lock.
+
+This header can be used when creating importers that run FMUs in separate processes.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtil.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Magic number identifying an initialized shared channel.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_MAGIC 0x4853424CU
+
+/**
+ * \brief Header of a shared channel placed at the start of a shared memory region.
+ *
+ * The header is followed by `capacity` bytes holding the bus operations of the last hand-off.
+ * Its size is a multiple of 64 bytes, so the data starts on a cache line boundary if the mapping does.
+ * The fields `sequence` and `length` must only be accessed by the macros of this header.
+ */
+typedef struct
+{
+    fmi3UInt32 magic;         /**< Set to \ref FMI3_LS_BUS_SHARED_CHANNEL_MAGIC by \ref FMI3_LS_BUS_SHARED_CHANNEL_INIT. */
+    fmi3UInt32 capacity;      /**< Number of bytes available for bus operations. */
+    fmi3UInt32 sequence;      /**< Sequence number, odd while a hand-off is written. */
+    fmi3UInt32 length;        /**< Number of bytes of bus operations of the last hand-off. */
+    fmi3UInt8 reserved[48];   /**< Reserved, pads the header to 64 bytes. */
+} fmi3LsBusUtilSharedChannel;
+
+#if FMI3_LS_BUS_CHECK_OPERATION_SIZE == 1
+static_assert(sizeof(fmi3LsBusUtilSharedChannel) == 64, "'fmi3LsBusUtilSharedChannel' does not match the expected data size");
+#endif
+
+/**
+ * \brief Atomic accesses to the sequence number of a shared channel.
+ *
+ * \note These macros are reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+/* Interlocked functions act as full memory barriers. */
+#define FMI3_LS_BUS_SHARED_LOAD_INTERNAL(Address) ((fmi3UInt32)_InterlockedCompareExchange((volatile long*)(Address), 0, 0))
+#define FMI3_LS_BUS_SHARED_STORE_INTERNAL(Address, Value) ((void)_InterlockedExchange((volatile long*)(Address), (long)(Value)))
+#define FMI3_LS_BUS_SHARED_FENCE_INTERNAL() _ReadWriteBarrier()
+#else
+#define FMI3_LS_BUS_SHARED_LOAD_INTERNAL(Address) __atomic_load_n((Address), __ATOMIC_ACQUIRE)
+#define FMI3_LS_BUS_SHARED_STORE_INTERNAL(Address, Value) __atomic_store_n((Address), (Value), __ATOMIC_RELEASE)
+#define FMI3_LS_BUS_SHARED_FENCE_INTERNAL() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/**
+ * \brief Returns the number of bytes of a shared memory region holding a channel with the specified capacity.
+ *
+ * \param[in] Capacity  Number of bytes available for bus operations.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_SIZE(Capacity)             \
+    (sizeof(fmi3LsBusUtilSharedChannel) + (size_t)(Capacity))
+
+/**
+ * \brief Returns the address of the bus operations of a shared channel.
+ *
+ * \param[in] Channel  Pointer to \ref fmi3LsBusUtilSharedChannel at the start of the shared memory region.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_DATA(Channel)                 \
+    ((fmi3UInt8*)(Channel) + sizeof(fmi3LsBusUtilSharedChannel))
+
+/**
+ * \brief Initializes a shared channel. This macro must be called by the process creating the shared memory region.
+ *
+ * Example:
+ * \code
+ * int fd = shm_open("/powertrain", O_CREAT | O_RDWR, 0600);
+ * ftruncate(fd, FMI3_LS_BUS_SHARED_CHANNEL_SIZE(4096));
+ * fmi3LsBusUtilSharedChannel* channel =
+ *     mmap(NULL, FMI3_LS_BUS_SHARED_CHANNEL_SIZE(4096), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+ * FMI3_LS_BUS_SHARED_CHANNEL_INIT(channel, 4096);
+ * \endcode
+ *
+ * \param[in] Channel   Pointer to \ref fmi3LsBusUtilSharedChannel at the start of the shared memory region.
+ * \param[in] Capacity  Number of bytes available for bus operations.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_INIT(Channel, Capacity)                                      \
+    do                                                                                          \
+    {                                                                                           \
+        memset((Channel), 0, sizeof(fmi3LsBusUtilSharedChannel));                               \
+        (Channel)->capacity = (fmi3UInt32)(Capacity);                                           \
+        FMI3_LS_BUS_SHARED_STORE_INTERNAL(&(Channel)->magic, FMI3_LS_BUS_SHARED_CHANNEL_MAGIC); \
+    }                                                                                           \
+    while (0)
+
+/**
+ * \brief Checks whether a mapped shared memory region contains an initialized shared channel.
+ *
+ * \param[in] Channel     Pointer to \ref fmi3LsBusUtilSharedChannel at the start of the shared memory region.
+ * \param[in] MappedSize  Number of bytes mapped.
+ * \return                fmi3True if the channel is initialized and fits into the mapped region, otherwise fmi3False.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_IS_VALID(Channel, MappedSize)                                          \
+    ((MappedSize) >= sizeof(fmi3LsBusUtilSharedChannel) &&                                                \
+     FMI3_LS_BUS_SHARED_LOAD_INTERNAL(&(Channel)->magic) == FMI3_LS_BUS_SHARED_CHANNEL_MAGIC &&           \
+     FMI3_LS_BUS_SHARED_CHANNEL_SIZE((Channel)->capacity) <= (size_t)(MappedSize) ? fmi3True : fmi3False)
+
+/**
+ * \brief Returns the current sequence number of a shared channel.
+ *
+ * The sequence number is incremented by 2 with every hand-off. It can be compared with the value
+ * returned by \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ to check for a new hand-off without reading the data.
+ *
+ * \param[in] Channel  Pointer to \ref fmi3LsBusUtilSharedChannel.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_SEQUENCE(Channel)       \
+    FMI3_LS_BUS_SHARED_LOAD_INTERNAL(&(Channel)->sequence)
+
+/**
+ * \brief Starts writing a hand-off to a shared channel.
+ *
+ * `BufferInfo` is initialized to the data area of the shared channel, so that the operations created
+ * using the CREATE_OP macros are written directly to the shared memory region without further copies.
+ * Only one process may write to a shared channel.
+ *
+ * \param[in] Channel     Pointer to \ref fmi3LsBusUtilSharedChannel.
+ * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(Channel, BufferInfo)                                                \
+    do                                                                                                             \
+    {                                                                                                              \
+        FMI3_LS_BUS_SHARED_STORE_INTERNAL(&(Channel)->sequence, (Channel)->sequence | 1U);                         \
+        FMI3_LS_BUS_SHARED_FENCE_INTERNAL();                                                                       \
+        FMI3_LS_BUS_BUFFER_INFO_INIT((BufferInfo), FMI3_LS_BUS_SHARED_CHANNEL_DATA(Channel), (Channel)->capacity); \
+    }                                                                                                              \
+    while (0)
+
+/**
+ * \brief Publishes the operations written to a shared channel since \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE.
+ *
+ * \param[in] Channel     Pointer to \ref fmi3LsBusUtilSharedChannel.
+ * \param[in] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo passed to the begin macro.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(Channel, BufferInfo)                          \
+    do                                                                                     \
+    {                                                                                      \
+        (Channel)->length = (fmi3UInt32)FMI3_LS_BUS_BUFFER_LENGTH(BufferInfo);             \
+        FMI3_LS_BUS_SHARED_STORE_INTERNAL(&(Channel)->sequence, (Channel)->sequence + 1U); \
+    }                                                                                      \
+    while (0)
+
+/**
+ * \brief Starts reading the last hand-off of a shared channel.
+ *
+ * `BufferInfo` is set to the data area of the shared channel without copying, so the operations can be read
+ * using \ref FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT. If a hand-off is being written, the 'status' variable of the
+ * argument 'BufferInfo' is set to fmi3False. After reading, the operations must be checked with
+ * \ref FMI3_LS_BUS_SHARED_CHANNEL_END_READ.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+ * if (rxBufferInfo.status)
+ * {
+ *     FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+ *     while (available)
+ *     {
+ *         ...
+ *         FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+ *     }
+ *     if (!rxBufferInfo.status || !FMI3_LS_BUS_SHARED_CHANNEL_END_READ(channel, sequence))
+ *     {
+ *         // The hand-off was overwritten while reading, discard the results and retry
+ *     }
+ * }
+ * \endcode
+ *
+ * \param[in]  Channel     Pointer to \ref fmi3LsBusUtilSharedChannel.
+ * \param[out] BufferInfo  Pointer to variable of type \ref fmi3LsBusUtilBufferInfo.
+ * \param[out] Sequence    Variable of type fmi3UInt32 receiving the sequence number of the hand-off.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(Channel, BufferInfo, Sequence)                                       \
+    do                                                                                                             \
+    {                                                                                                              \
+        (Sequence) = FMI3_LS_BUS_SHARED_LOAD_INTERNAL(&(Channel)->sequence);                                       \
+        FMI3_LS_BUS_BUFFER_INFO_INIT((BufferInfo), FMI3_LS_BUS_SHARED_CHANNEL_DATA(Channel), (Channel)->capacity); \
+        if (((Sequence) & 1U) == 0 && (Channel)->length <= (Channel)->capacity)                                    \
+        {                                                                                                          \
+            (BufferInfo)->writePos = (BufferInfo)->start + (Channel)->length;                                      \
+        }                                                                                                          \
+        else                                                                                                       \
+        {                                                                                                          \
+            (BufferInfo)->status = fmi3False;                                                                      \
+        }                                                                                                          \
+    }                                                                                                              \
+    while (0)
+
+/**
+ * \brief Reads the next operation of a hand-off started by \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ.
+ *
+ * Unlike \ref FMI3_LS_BUS_READ_NEXT_OPERATION, the length of each operation is loaded once and validated, since
+ * a concurrent writer may tear the data. A length shorter than the operation header, a length exceeding the
+ * remaining data or a trailing fragment of an operation sets the 'status' variable of the argument 'BufferInfo'
+ * to fmi3False and ends the hand-off, so that the read is retried.
+ *
+ * \param[in]  BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo set by \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ.
+ * \param[out] Operation   Pointer of type \ref fmi3LsBusOperationHeader* set to the next operation.
+ * \param[out] Available   Variable of type fmi3Boolean set to fmi3True if an operation was read.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(BufferInfo, Operation, Available)                       \
+    do                                                                                               \
+    {                                                                                                \
+        const fmi3UInt32 _remaining = (fmi3UInt32)((BufferInfo)->writePos - (BufferInfo)->readPos);  \
+        fmi3UInt32 _length = 0;                                                                      \
+        (Available) = fmi3False;                                                                     \
+        if (_remaining >= sizeof(fmi3LsBusOperationHeader))                                          \
+        {                                                                                            \
+            _length = FMI3_LS_BUS_LOAD_LE32((BufferInfo)->readPos + sizeof(fmi3LsBusOperationCode)); \
+        }                                                                                            \
+        if (_length >= sizeof(fmi3LsBusOperationHeader) && _length <= _remaining)                    \
+        {                                                                                            \
+            (Operation) = (fmi3LsBusOperationHeader*)(BufferInfo)->readPos;                          \
+            (BufferInfo)->readPos += _length;                                                        \
+            (Available) = fmi3True;                                                                  \
+        }                                                                                            \
+        else if (_remaining != 0)                                                                    \
+        {                                                                                            \
+            (BufferInfo)->readPos = (BufferInfo)->writePos;                                          \
+            (BufferInfo)->status = fmi3False;                                                        \
+        }                                                                                            \
+    }                                                                                                \
+    while (0)
+
+/**
+ * \brief Checks whether the hand-off read since \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ was not overwritten.
+ *
+ * \param[in] Channel   Pointer to \ref fmi3LsBusUtilSharedChannel.
+ * \param[in] Sequence  Sequence number returned by \ref FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ.
+ * \return              fmi3True if the operations read are consistent, otherwise fmi3False.
+ */
+#define FMI3_LS_BUS_SHARED_CHANNEL_END_READ(Channel, Sequence)                                    \
+    (FMI3_LS_BUS_SHARED_FENCE_INTERNAL(),                                                         \
+     FMI3_LS_BUS_SHARED_LOAD_INTERNAL(&(Channel)->sequence) == (Sequence) ? fmi3True : fmi3False)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilShared_h */
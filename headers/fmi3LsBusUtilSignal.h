@@ -0,0 +1,308 @@
+#ifndef fmi3LsBusUtilSignal_h
+#define fmi3LsBusUtilSignal_h
+
+/*
+This header file contains utility macros to pack physical signal values into the payload of frames
+and PDUs and to unpack them, as needed by FMUs implementing the Physical Signal Abstraction with
+network description files (e.g. DBC or ARXML) defining the layout of the signals.
+
+The layout of the signals of a PDU can be given as a list, from which packing and unpacking
+functions specialized for this PDU are generated at compile time.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include "fmi3LsBus.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \defgroup SIGNAL_BYTE_ORDER Signal byte order
+ * \brief Byte orders of signals.
+ * \{
+ */
+#define FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN 0 /**< Little endian (Intel), the start bit is the least significant bit. */
+#define FMI3_LS_BUS_SIGNAL_BIG_ENDIAN    1 /**< Big endian (Motorola), the start bit is the most significant bit. */
+/** \} */
+
+/**
+ * \brief Specifier of the generated functions.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL static __inline
+#else
+#define FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL static inline
+#endif
+
+/**
+ * \brief Returns the mask of a raw value with `Length` bits.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SIGNAL_MASK_INTERNAL(Length) (~(fmi3UInt64)0 >> (64 - (Length)))
+
+/**
+ * \brief Returns the position of the least significant bit of a signal, counting the bits of the payload from the
+ *        most significant bit of the first byte for big endian signals and from the least significant bit of the
+ *        first byte for little endian signals.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SIGNAL_LAST_BIT_INTERNAL(ByteOrder, StartBit, Length)                                         \
+    ((ByteOrder) == FMI3_LS_BUS_SIGNAL_BIG_ENDIAN ? (int)((StartBit) / 8 * 8 + 7 - (StartBit) % 8 + (Length) - 1) \
+                                                  : (int)((StartBit) + (Length) - 1))
+
+/**
+ * \brief Returns the position of bit 0 of byte `Index` of the payload within the raw value of a signal.
+ *        Negative values denote the number of bits the raw value is shifted left in this byte.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SIGNAL_SHIFT_INTERNAL(ByteOrder, StartBit, LastBit, Index)                                   \
+    ((ByteOrder) == FMI3_LS_BUS_SIGNAL_BIG_ENDIAN ? (LastBit) - 8 * (Index) - 7 : 8 * (Index) - (int)(StartBit))
+
+/**
+ * \brief Writes the raw value of a signal into the payload.
+ *
+ * All other bits of the payload remain unchanged.
+ * If the arguments are constant, the compiler reduces this macro to a fixed sequence of shift and mask operations.
+ *
+ * \param[in] Data       Pointer to the payload.
+ * \param[in] ByteOrder  Byte order of the signal, see \ref SIGNAL_BYTE_ORDER.
+ * \param[in] StartBit   Start bit of the signal as defined in DBC files.
+ * \param[in] Length     Length of the signal in bits, 1 to 64.
+ * \param[in] Raw        Raw value of type fmi3UInt64, bits beyond `Length` are ignored.
+ */
+#define FMI3_LS_BUS_SIGNAL_INSERT_RAW(Data, ByteOrder, StartBit, Length, Raw)                                     \
+    do                                                                                                            \
+    {                                                                                                             \
+        fmi3UInt8* _insertData = (fmi3UInt8*)(Data);                                                              \
+        const fmi3UInt64 _insertMask = FMI3_LS_BUS_SIGNAL_MASK_INTERNAL(Length);                                  \
+        const fmi3UInt64 _insertRaw = (fmi3UInt64)(Raw) & _insertMask;                                            \
+        const int _insertLast = FMI3_LS_BUS_SIGNAL_LAST_BIT_INTERNAL((ByteOrder), (StartBit), (Length));          \
+        int _insertIndex;                                                                                         \
+        for (_insertIndex = (int)(StartBit) / 8; _insertIndex <= _insertLast / 8; _insertIndex++)                 \
+        {                                                                                                         \
+            const int _shift =                                                                                    \
+                FMI3_LS_BUS_SIGNAL_SHIFT_INTERNAL((ByteOrder), (StartBit), _insertLast, _insertIndex);            \
+            const fmi3UInt8 _bits = (fmi3UInt8)(_shift >= 0 ? _insertRaw >> _shift : _insertRaw << -_shift);      \
+            const fmi3UInt8 _bitMask = (fmi3UInt8)(_shift >= 0 ? _insertMask >> _shift : _insertMask << -_shift); \
+            _insertData[_insertIndex] = (fmi3UInt8)((_insertData[_insertIndex] & ~_bitMask) | _bits);             \
+        }                                                                                                         \
+    }                                                                                                             \
+    while (0)
+
+/**
+ * \brief Reads the raw value of a signal from the payload.
+ *
+ * If the arguments are constant, the compiler reduces this macro to a fixed sequence of shift and mask operations.
+ *
+ * \param[in] Data       Pointer to the payload.
+ * \param[in] ByteOrder  Byte order of the signal, see \ref SIGNAL_BYTE_ORDER.
+ * \param[in] StartBit   Start bit of the signal as defined in DBC files.
+ * \param[in] Length     Length of the signal in bits, 1 to 64.
+ * \param[out] Raw       Variable of type fmi3UInt64 receiving the raw value.
+ */
+#define FMI3_LS_BUS_SIGNAL_EXTRACT_RAW(Data, ByteOrder, StartBit, Length, Raw)                            \
+    do                                                                                                    \
+    {                                                                                                     \
+        const fmi3UInt8* _extractData = (const fmi3UInt8*)(Data);                                         \
+        const int _extractLast = FMI3_LS_BUS_SIGNAL_LAST_BIT_INTERNAL((ByteOrder), (StartBit), (Length)); \
+        fmi3UInt64 _extractRaw = 0;                                                                       \
+        int _extractIndex;                                                                                \
+        for (_extractIndex = (int)(StartBit) / 8; _extractIndex <= _extractLast / 8; _extractIndex++)     \
+        {                                                                                                 \
+            const int _shift =                                                                            \
+                FMI3_LS_BUS_SIGNAL_SHIFT_INTERNAL((ByteOrder), (StartBit), _extractLast, _extractIndex);  \
+            const fmi3UInt64 _byte = _extractData[_extractIndex];                                         \
+            _extractRaw |= _shift >= 0 ? _byte << _shift : _byte >> -_shift;                              \
+        }                                                                                                 \
+        (Raw) = _extractRaw & FMI3_LS_BUS_SIGNAL_MASK_INTERNAL(Length);                                   \
+    }                                                                                                     \
+    while (0)
+
+/**
+ * \brief Converts the physical value of a signal to its raw value and writes it into the payload.
+ *
+ * The raw value is `(Value - Offset) / Factor`, rounded to the nearest integer. Values not fitting into
+ * `Length` bits are truncated, raw values of unsigned signals must be less than 2^63.
+ *
+ * \param[in] Data       Pointer to the payload.
+ * \param[in] ByteOrder  Byte order of the signal, see \ref SIGNAL_BYTE_ORDER.
+ * \param[in] StartBit   Start bit of the signal as defined in DBC files.
+ * \param[in] Length     Length of the signal in bits, 1 to 64.
+ * \param[in] Factor     Factor of the signal.
+ * \param[in] Offset     Offset of the signal.
+ * \param[in] Value      Physical value of type fmi3Float64.
+ */
+#define FMI3_LS_BUS_SIGNAL_PACK(Data, ByteOrder, StartBit, Length, Factor, Offset, Value)   \
+    do                                                                                      \
+    {                                                                                       \
+        const fmi3Float64 _scaled = ((fmi3Float64)(Value) - (Offset)) / (Factor);           \
+        const fmi3UInt64 _packRaw = (fmi3UInt64)(fmi3Int64)(_scaled + 0.5 - (_scaled < 0)); \
+        FMI3_LS_BUS_SIGNAL_INSERT_RAW((Data), (ByteOrder), (StartBit), (Length), _packRaw); \
+    }                                                                                       \
+    while (0)
+
+/**
+ * \brief Reads the raw value of a signal from the payload and converts it to its physical value.
+ *
+ * The physical value is `Raw * Factor + Offset`.
+ *
+ * \param[in] Data       Pointer to the payload.
+ * \param[in] ByteOrder  Byte order of the signal, see \ref SIGNAL_BYTE_ORDER.
+ * \param[in] StartBit   Start bit of the signal as defined in DBC files.
+ * \param[in] Length     Length of the signal in bits, 1 to 64.
+ * \param[in] Signed     Whether the raw value is a two's complement signed integer.
+ * \param[in] Factor     Factor of the signal.
+ * \param[in] Offset     Offset of the signal.
+ * \param[out] Value     Variable of type fmi3Float64 receiving the physical value.
+ */
+#define FMI3_LS_BUS_SIGNAL_UNPACK(Data, ByteOrder, StartBit, Length, Signed, Factor, Offset, Value)               \
+    do                                                                                                            \
+    {                                                                                                             \
+        fmi3UInt64 _unpackRaw;                                                                                    \
+        FMI3_LS_BUS_SIGNAL_EXTRACT_RAW((Data), (ByteOrder), (StartBit), (Length), _unpackRaw);                    \
+        if (Signed)                                                                                               \
+        {                                                                                                         \
+            const fmi3UInt64 _signBit = (fmi3UInt64)1 << ((Length) - 1);                                          \
+            (Value) = (fmi3Float64)(fmi3Int64)((_unpackRaw ^ _signBit) - _signBit) * (Factor) + (Offset);         \
+        }                                                                                                         \
+        else                                                                                                      \
+        {                                                                                                         \
+            (Value) = ((Length) < 64 ? (fmi3Float64)(fmi3Int64)_unpackRaw : (fmi3Float64)_unpackRaw) * (Factor) + \
+                      (Offset);                                                                                   \
+        }                                                                                                         \
+    }                                                                                                             \
+    while (0)
+
+/**
+ * \brief Function type packing the signals of a PDU into its payload.
+ *
+ * \param[in] signals  Pointer to the structure holding the physical values of the signals.
+ * \param[out] data    Pointer to the payload.
+ */
+typedef void (*fmi3LsBusUtilSignalPackFunction)(const void* signals, fmi3UInt8* data);
+
+/**
+ * \brief Function type unpacking the signals of a PDU from its payload.
+ *
+ * \param[in] data      Pointer to the payload.
+ * \param[out] signals  Pointer to the structure receiving the physical values of the signals.
+ */
+typedef void (*fmi3LsBusUtilSignalUnpackFunction)(const fmi3UInt8* data, void* signals);
+
+/**
+ * \brief Generators for the members and statements of a PDU definition.
+ *
+ * \note These macros are reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_SIGNAL_MEMBER_INTERNAL(Name, ByteOrder, StartBit, Length, Signed, Factor, Offset) fmi3Float64 Name;
+#define FMI3_LS_BUS_SIGNAL_PACK_INTERNAL(Name, ByteOrder, StartBit, Length, Signed, Factor, Offset) \
+    FMI3_LS_BUS_SIGNAL_PACK(data, ByteOrder, StartBit, Length, Factor, Offset, signals->Name);
+#define FMI3_LS_BUS_SIGNAL_UNPACK_INTERNAL(Name, ByteOrder, StartBit, Length, Signed, Factor, Offset)    \
+    FMI3_LS_BUS_SIGNAL_UNPACK(data, ByteOrder, StartBit, Length, Signed, Factor, Offset, signals->Name);
+
+/**
+ * \brief Defines a structure holding the physical values of the signals of a PDU and functions to pack and
+ *        unpack them.
+ *
+ * The signals are given by a macro `Signals(X)` which expands `X(Name, ByteOrder, StartBit, Length, Signed,
+ * Factor, Offset)` for each signal, with the arguments as in \ref FMI3_LS_BUS_SIGNAL_UNPACK. Since the layout
+ * of all signals is constant, the generated functions consist of fixed shift and mask operations without
+ * branches or lookup tables.
+ *
+ * The following functions are generated:
+ *  - `void Name_Pack(const Name* signals, fmi3UInt8* data)` writes all signals into the payload `data`,
+ *    leaving bits not covered by a signal unchanged.
+ *  - `void Name_Unpack(const fmi3UInt8* data, Name* signals)` reads all signals from the payload `data`.
+ *  - `Name_PackGeneric` and `Name_UnpackGeneric` do the same for an untyped pointer to `Name`, matching
+ *    \ref fmi3LsBusUtilSignalPackFunction and \ref fmi3LsBusUtilSignalUnpackFunction.
+ *
+ * Example for a DBC message with the signals
+ * `SG_ vCar : 0|16@1+ (0.01,0)` and `SG_ gear : 23|4@0- (1,0)`:
+ * \code
+ * #define TCU_SENSORS_SIGNALS(X)                                                   \
+ *     X(vCar, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 0, 16, fmi3False, 0.01, 0.0)   \
+ *     X(gear, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 23, 4, fmi3True, 1.0, 0.0)
+ *
+ * FMI3_LS_BUS_SIGNAL_DEFINE_PDU(TcuSensors, TCU_SENSORS_SIGNALS)
+ *
+ * TcuSensors signals = { 27.5, -1.0 };
+ * fmi3UInt8 data[8] = { 0 };
+ * TcuSensors_Pack(&signals, data);
+ * \endcode
+ *
+ * \param[in] Name     Name of the generated structure and prefix of the generated functions.
+ * \param[in] Signals  Macro listing the signals of the PDU.
+ */
+#define FMI3_LS_BUS_SIGNAL_DEFINE_PDU(Name, Signals)                                                   \
+    typedef struct                                                                                     \
+    {                                                                                                  \
+        Signals(FMI3_LS_BUS_SIGNAL_MEMBER_INTERNAL)                                                    \
+    } Name;                                                                                            \
+                                                                                                       \
+    FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL void Name##_Pack(const Name* signals, fmi3UInt8* data)          \
+    {                                                                                                  \
+        Signals(FMI3_LS_BUS_SIGNAL_PACK_INTERNAL)                                                      \
+    }                                                                                                  \
+                                                                                                       \
+    FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL void Name##_Unpack(const fmi3UInt8* data, Name* signals)        \
+    {                                                                                                  \
+        Signals(FMI3_LS_BUS_SIGNAL_UNPACK_INTERNAL)                                                    \
+    }                                                                                                  \
+                                                                                                       \
+    FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL void Name##_PackGeneric(const void* signals, fmi3UInt8* data)   \
+    {                                                                                                  \
+        Name##_Pack((const Name*)signals, data);                                                       \
+    }                                                                                                  \
+                                                                                                       \
+    FMI3_LS_BUS_SIGNAL_INLINE_INTERNAL void Name##_UnpackGeneric(const fmi3UInt8* data, void* signals) \
+    {                                                                                                  \
+        Name##_Unpack(data, (Name*)signals);                                                           \
+    }
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilSignal_h */
@@ -0,0 +1,336 @@
+#ifndef fmi3LsBusUtilSignalCan_h
+#define fmi3LsBusUtilSignalCan_h
+
+/*
+This header file contains utility macros to convert between the signals of the Physical Signal
+Abstraction and CAN Transmit or CAN FD Transmit operations of the Network Abstraction, e.g. for
+components connecting high-cut and low-cut FMUs.
+
+Frames are only packed and transmitted if one of their signals was marked as changed.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilCan.h"
+#include "fmi3LsBusUtilSignal.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief A CAN frame carrying the signals of a PDU.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusCanId id;                          /**< CAN message ID. */
+    fmi3LsBusCanIde ide;                        /**< Standard (11-bit) or Extended (29-bit) message identifier. */
+    fmi3Boolean fd;                             /**< Whether the frame is transmitted as CAN FD frame. */
+    fmi3LsBusCanBrs brs;                        /**< Bit Rate Switch of CAN FD frames. */
+    fmi3LsBusCanDataLength dataLength;          /**< Data length, at most 8 for CAN frames and 64 for CAN FD frames. */
+    void* signals;                              /**< Structure holding the physical values of the signals. */
+    fmi3LsBusUtilSignalPackFunction pack;       /**< Function packing the signals. */
+    fmi3LsBusUtilSignalUnpackFunction unpack;   /**< Function unpacking the signals. */
+    fmi3UInt8 data[64];                         /**< Last packed or received payload. */
+} fmi3LsBusUtilSignalCanFrame;
+
+/**
+ * \brief This data type holds the state of a converter between signals and CAN operations.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_SIGNAL_CAN_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusUtilSignalCanFrame* frames; /**< Frames sorted by \ref FMI3_LS_BUS_SIGNAL_CAN_KEY, provided by the caller. */
+    size_t frameCount;                   /**< Number of frames. */
+    fmi3UInt32* dirty;                   /**< Bit set of frames with changed signals, provided by the caller. */
+} fmi3LsBusUtilSignalCan;
+
+/**
+ * \brief Returns the number of elements of the bit set needed for `FrameCount` frames.
+ *
+ * \param[in] FrameCount  Number of frames.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS(FrameCount) (((FrameCount) + 31) / 32)
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilSignalCanFrame.
+ *
+ * The payload is initialized with zeros.
+ *
+ * \param[in] Frame       Pointer to \ref fmi3LsBusUtilSignalCanFrame.
+ * \param[in] Id          CAN message ID.
+ * \param[in] Ide         Standard (11-bit) or Extended (29-bit) message identifier.
+ * \param[in] Fd          Whether the frame is transmitted as CAN FD frame.
+ * \param[in] DataLength  Data length of the frame.
+ * \param[in] Pdu         Name of the PDU defined by \ref FMI3_LS_BUS_SIGNAL_DEFINE_PDU.
+ * \param[in] Signals     Pointer to the variable of type `Pdu` holding the signals.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(Frame, Id, Ide, Fd, DataLength, Pdu, Signals) \
+    do                                                                                  \
+    {                                                                                   \
+        memset((Frame), 0, sizeof(fmi3LsBusUtilSignalCanFrame));                        \
+        (Frame)->id = (Id);                                                             \
+        (Frame)->ide = (Ide);                                                           \
+        (Frame)->fd = (Fd);                                                             \
+        (Frame)->brs = (Fd) ? FMI3_LS_BUS_TRUE : FMI3_LS_BUS_FALSE;                     \
+        (Frame)->dataLength = (DataLength);                                             \
+        (Frame)->signals = (Signals);                                                   \
+        (Frame)->pack = Pdu##_PackGeneric;                                              \
+        (Frame)->unpack = Pdu##_UnpackGeneric;                                          \
+    }                                                                                   \
+    while (0)
+
+/**
+ * \brief Returns the key frames are sorted and looked up by.
+ *
+ * Frames are ordered by ascending ID, a standard frame before an extended frame with the same ID value.
+ *
+ * \param[in] Id   CAN message ID.
+ * \param[in] Ide  Standard (11-bit) or Extended (29-bit) message identifier.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_KEY(Id, Ide) ((((fmi3UInt64)(Id)) << 1) | ((Ide) ? 1U : 0U))
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilSignalCan with all frames marked as changed.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilSignalCanFrame frames[2];
+ * fmi3UInt32 dirty[FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS(2)];
+ * fmi3LsBusUtilSignalCan converter;
+ *
+ * FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[0], 0x100, FMI3_LS_BUS_FALSE, fmi3False, 8, TcuSensors, &tcuSensors);
+ * FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[1], 0x200, FMI3_LS_BUS_FALSE, fmi3True, 16, EcuStatus, &ecuStatus);
+ * FMI3_LS_BUS_SIGNAL_CAN_INIT(&converter, frames, 2, dirty);
+ * \endcode
+ *
+ * \param[in] Converter   Pointer to \ref fmi3LsBusUtilSignalCan.
+ * \param[in] Frames      Array of \ref fmi3LsBusUtilSignalCanFrame sorted by ascending \ref FMI3_LS_BUS_SIGNAL_CAN_KEY.
+ * \param[in] FrameCount  Number of frames.
+ * \param[in] Dirty       Array of fmi3UInt32 with \ref FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS elements.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_INIT(Converter, Frames, FrameCount, Dirty)                             \
+    do                                                                                                \
+    {                                                                                                 \
+        size_t _word;                                                                                 \
+        (Converter)->frames = (Frames);                                                               \
+        (Converter)->frameCount = (size_t)(FrameCount);                                               \
+        (Converter)->dirty = (Dirty);                                                                 \
+        for (_word = 0; _word < FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS((Converter)->frameCount); _word++) \
+        {                                                                                             \
+            (Converter)->dirty[_word] = 0xFFFFFFFFU;                                                  \
+        }                                                                                             \
+        if ((Converter)->frameCount % 32 != 0)                                                        \
+        {                                                                                             \
+            (Converter)->dirty[_word - 1] = (1U << ((Converter)->frameCount % 32)) - 1;               \
+        }                                                                                             \
+    }                                                                                                 \
+    while (0)
+
+/**
+ * \brief Marks the frame at position `Index` as changed, e.g. after one of its signal variables was set.
+ *
+ * \param[in] Converter  Pointer to \ref fmi3LsBusUtilSignalCan.
+ * \param[in] Index      Position of the frame.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_MARK_DIRTY(Converter, Index)                    \
+    ((Converter)->dirty[(size_t)(Index) / 32] |= 1U << ((size_t)(Index) % 32))
+
+/**
+ * \brief Returns whether the frame at position `Index` is marked as changed.
+ *
+ * \param[in] Converter  Pointer to \ref fmi3LsBusUtilSignalCan.
+ * \param[in] Index      Position of the frame.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(Converter, Index)                              \
+    ((((Converter)->dirty[(size_t)(Index) / 32] >> ((size_t)(Index) % 32)) & 1U) != 0)
+
+/**
+ * \brief Returns the position of the lowest bit set in a non-zero word.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define FMI3_LS_BUS_SIGNAL_CAN_LOWEST_BIT_INTERNAL(Word, Bit) \
+    do                                                        \
+    {                                                         \
+        (Bit) = (size_t)__builtin_ctz(Word);                  \
+    }                                                         \
+    while (0)
+#else
+#define FMI3_LS_BUS_SIGNAL_CAN_LOWEST_BIT_INTERNAL(Word, Bit) \
+    do                                                        \
+    {                                                         \
+        fmi3UInt32 _lowest = (Word);                          \
+        (Bit) = 0;                                            \
+        while ((_lowest & 1U) == 0)                           \
+        {                                                     \
+            _lowest >>= 1;                                    \
+            (Bit)++;                                          \
+        }                                                     \
+    }                                                         \
+    while (0)
+#endif
+
+/**
+ * \brief Packs all frames marked as changed and creates a CAN Transmit or CAN FD Transmit operation for each.
+ *
+ * Frames not marked as changed are skipped without being packed. The mark of a frame is cleared once its
+ * operation was submitted. If there is not enough buffer space available, `BufferInfo->status` is set to
+ * `fmi3False` and the remaining frames stay marked, so that they can be transmitted by a later call.
+ *
+ * \param[in] Converter   Pointer to \ref fmi3LsBusUtilSignalCan.
+ * \param[in] BufferInfo  Pointer to \ref fmi3LsBusUtilBufferInfo.
+ * \param[out] Count      Variable of type size_t receiving the number of operations created.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(Converter, BufferInfo, Count)                                                \
+    do                                                                                                               \
+    {                                                                                                                \
+        size_t _word;                                                                                                \
+        (Count) = 0;                                                                                                 \
+        (BufferInfo)->status = fmi3True;                                                                             \
+        for (_word = 0; _word < FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS((Converter)->frameCount) && (BufferInfo)->status; \
+             _word++)                                                                                                \
+        {                                                                                                            \
+            while ((Converter)->dirty[_word] != 0)                                                                   \
+            {                                                                                                        \
+                fmi3LsBusUtilSignalCanFrame* _frame;                                                                 \
+                size_t _bit;                                                                                         \
+                FMI3_LS_BUS_SIGNAL_CAN_LOWEST_BIT_INTERNAL((Converter)->dirty[_word], _bit);                         \
+                _frame = &(Converter)->frames[_word * 32 + _bit];                                                    \
+                _frame->pack(_frame->signals, _frame->data);                                                         \
+                if (_frame->fd)                                                                                      \
+                {                                                                                                    \
+                    FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT((BufferInfo), _frame->id, _frame->ide, _frame->brs,    \
+                                                              FMI3_LS_BUS_FALSE, _frame->dataLength, _frame->data);  \
+                }                                                                                                    \
+                else                                                                                                 \
+                {                                                                                                    \
+                    FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT((BufferInfo), _frame->id, _frame->ide, FMI3_LS_BUS_FALSE, \
+                                                           _frame->dataLength, _frame->data);                        \
+                }                                                                                                    \
+                if (!(BufferInfo)->status)                                                                           \
+                {                                                                                                    \
+                    break;                                                                                           \
+                }                                                                                                    \
+                (Converter)->dirty[_word] &= ~(1U << _bit);                                                          \
+                (Count)++;                                                                                           \
+            }                                                                                                        \
+        }                                                                                                            \
+    }                                                                                                                \
+    while (0)
+
+/**
+ * \brief Unpacks the signals of a received CAN Transmit or CAN FD Transmit operation.
+ *
+ * The frame is looked up by its ID and IDE using binary search. Received payloads shorter than the data length
+ * of the frame leave the remaining bytes of the last payload unchanged. Operations shorter than their fixed part
+ * or their data length are ignored.
+ *
+ * \param[in] Converter   Pointer to \ref fmi3LsBusUtilSignalCan.
+ * \param[in] Operation   Pointer to \ref fmi3LsBusOperationHeader of the received operation.
+ * \param[out] Frame      Variable of type pointer to \ref fmi3LsBusUtilSignalCanFrame receiving the frame whose
+ *                        signals were updated, or NULL if the operation is not a transmit operation of a known frame.
+ */
+#define FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(Converter, Operation, Frame)                                                       \
+    do                                                                                                                    \
+    {                                                                                                                     \
+        const fmi3LsBusOperationHeader* _header = (const fmi3LsBusOperationHeader*)(Operation);                           \
+        const fmi3LsBusOperationLength _opLength = (fmi3LsBusOperationLength)FMI3_LS_BUS_GET_LE(_header->length);         \
+        const fmi3UInt8* _data = NULL;                                                                                    \
+        fmi3UInt64 _key = 0;                                                                                              \
+        fmi3LsBusCanDataLength _length = 0;                                                                               \
+        (Frame) = NULL;                                                                                                   \
+        if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT &&                                     \
+            _opLength >= sizeof(fmi3LsBusCanOperationCanTransmit))                                                        \
+        {                                                                                                                 \
+            const fmi3LsBusCanOperationCanTransmit* _op = (const fmi3LsBusCanOperationCanTransmit*)_header;               \
+            _length = (fmi3LsBusCanDataLength)FMI3_LS_BUS_GET_LE(_op->dataLength);                                        \
+            if (_opLength >= sizeof(fmi3LsBusCanOperationCanTransmit) + _length)                                          \
+            {                                                                                                             \
+                _key = FMI3_LS_BUS_SIGNAL_CAN_KEY(FMI3_LS_BUS_GET_LE(_op->id), _op->ide);                                 \
+                _data = _op->data;                                                                                        \
+            }                                                                                                             \
+        }                                                                                                                 \
+        else if (FMI3_LS_BUS_GET_LE(_header->opCode) == FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT &&                              \
+                 _opLength >= sizeof(fmi3LsBusCanOperationCanFdTransmit))                                                 \
+        {                                                                                                                 \
+            const fmi3LsBusCanOperationCanFdTransmit* _op = (const fmi3LsBusCanOperationCanFdTransmit*)_header;           \
+            _length = (fmi3LsBusCanDataLength)FMI3_LS_BUS_GET_LE(_op->dataLength);                                        \
+            if (_opLength >= sizeof(fmi3LsBusCanOperationCanFdTransmit) + _length)                                        \
+            {                                                                                                             \
+                _key = FMI3_LS_BUS_SIGNAL_CAN_KEY(FMI3_LS_BUS_GET_LE(_op->id), _op->ide);                                 \
+                _data = _op->data;                                                                                        \
+            }                                                                                                             \
+        }                                                                                                                 \
+        if (_data != NULL)                                                                                                \
+        {                                                                                                                 \
+            size_t _low = 0;                                                                                              \
+            size_t _high = (Converter)->frameCount;                                                                       \
+            while (_low < _high)                                                                                          \
+            {                                                                                                             \
+                const size_t _middle = _low + (_high - _low) / 2;                                                         \
+                if (FMI3_LS_BUS_SIGNAL_CAN_KEY((Converter)->frames[_middle].id, (Converter)->frames[_middle].ide) < _key) \
+                {                                                                                                         \
+                    _low = _middle + 1;                                                                                   \
+                }                                                                                                         \
+                else                                                                                                      \
+                {                                                                                                         \
+                    _high = _middle;                                                                                      \
+                }                                                                                                         \
+            }                                                                                                             \
+            if (_low < (Converter)->frameCount &&                                                                         \
+                FMI3_LS_BUS_SIGNAL_CAN_KEY((Converter)->frames[_low].id, (Converter)->frames[_low].ide) == _key)          \
+            {                                                                                                             \
+                (Frame) = &(Converter)->frames[_low];                                                                     \
+                memcpy((Frame)->data, _data, _length < (Frame)->dataLength ? _length : (Frame)->dataLength);              \
+                (Frame)->unpack((Frame)->data, (Frame)->signals);                                                         \
+            }                                                                                                             \
+        }                                                                                                                 \
+    }                                                                                                                     \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilSignalCan_h */
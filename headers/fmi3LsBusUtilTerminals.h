@@ -0,0 +1,430 @@
+#ifndef fmi3LsBusUtilTerminals_h
+#define fmi3LsBusUtilTerminals_h
+
+/*
+This header file contains utility macros to read the Bus Terminals of FMUs from
+the terminalsAndIcons.xml and modelDescription.xml files and to build a routing
+table connecting the Tx/Rx variables of the FMUs to bus segments.
+
+This header can be used when creating importers.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtilXml.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \defgroup TERMINAL_MEMBERS Bus Terminal members
+ * \brief Indices of the member variables of a Bus Terminal.
+ * \{
+ */
+#define FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA  0 /**< Member variable `Tx_Data`. */
+#define FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK 1 /**< Member variable `Tx_Clock`. */
+#define FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA  2 /**< Member variable `Rx_Data`. */
+#define FMI3_LS_BUS_TERMINAL_MEMBER_RX_CLOCK 3 /**< Member variable `Rx_Clock`. */
+#define FMI3_LS_BUS_TERMINAL_MEMBER_COUNT    4 /**< Number of member variables of a Bus Terminal. */
+/** \} */
+
+/**
+ * \defgroup TERMINAL_CLOCK_TYPES Tx Clock types
+ * \brief Types of the `Tx_Clock` variable of a Bus Terminal as given by the attribute `intervalVariability`.
+ * \{
+ */
+/**
+ * \brief Data type representing the type of a Clock variable.
+ */
+typedef fmi3UInt8 fmi3LsBusUtilClockType;
+
+#define FMI3_LS_BUS_CLOCK_TYPE_UNKNOWN   ((fmi3LsBusUtilClockType)0x0) /**< Clock type not available. */
+#define FMI3_LS_BUS_CLOCK_TYPE_TRIGGERED ((fmi3LsBusUtilClockType)0x1) /**< `triggered` Clock. */
+#define FMI3_LS_BUS_CLOCK_TYPE_CONSTANT  ((fmi3LsBusUtilClockType)0x2) /**< `periodic` Clock with `constant` interval. */
+#define FMI3_LS_BUS_CLOCK_TYPE_FIXED     ((fmi3LsBusUtilClockType)0x3) /**< `periodic` Clock with `fixed` interval. */
+#define FMI3_LS_BUS_CLOCK_TYPE_TUNABLE   ((fmi3LsBusUtilClockType)0x4) /**< `periodic` Clock with `tunable` interval. */
+#define FMI3_LS_BUS_CLOCK_TYPE_CHANGING  ((fmi3LsBusUtilClockType)0x5) /**< `aperiodic` Clock with `changing` interval. */
+#define FMI3_LS_BUS_CLOCK_TYPE_COUNTDOWN ((fmi3LsBusUtilClockType)0x6) /**< `aperiodic` Clock with `countdown` interval. */
+/** \} */
+
+/**
+ * \brief Bus Terminal of an FMU as read from the terminalsAndIcons.xml file.
+ *
+ * Names refer to the XML text they were read from and are only valid as long as this text is valid.
+ */
+typedef struct
+{
+    const fmi3Char* name;                                                /**< Name of the terminal (network name). */
+    size_t nameLength;                                                   /**< Length of the name of the terminal. */
+    const fmi3Char* variableName[FMI3_LS_BUS_TERMINAL_MEMBER_COUNT];     /**< Variable names indexed by \ref TERMINAL_MEMBERS. */
+    size_t variableNameLength[FMI3_LS_BUS_TERMINAL_MEMBER_COUNT];        /**< Lengths of the variable names. */
+    fmi3ValueReference valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_COUNT]; /**< Value references indexed by \ref TERMINAL_MEMBERS. */
+    fmi3LsBusUtilClockType txClockType;                                  /**< Type of the `Tx_Clock` variable. */
+    fmi3UInt8 resolved;                                                  /**< Bitmask of members whose value reference is known. */
+} fmi3LsBusUtilBusTerminal;
+
+/**
+ * \brief Bus segment a Bus Terminal is connected to.
+ *
+ * Bus Terminals with the same name are connected to the same bus segment. The name refers to the XML
+ * text of the first FMU declaring the bus segment, which must stay valid as long as the segment is used.
+ */
+typedef struct
+{
+    const fmi3Char* name; /**< Name of the bus segment (not copied, see above). */
+    size_t nameLength;    /**< Length of the name of the bus segment. */
+} fmi3LsBusUtilBusSegment;
+
+/**
+ * \brief Entry of the routing table created by \ref FMI3_LS_BUS_TERMINALS_BUILD_ROUTES.
+ *
+ * The entry does not contain pointers and can be stored and loaded as it is.
+ */
+typedef struct
+{
+    fmi3UInt32 fmuIndex;                                                   /**< Index of the FMU the Bus Terminal belongs to. */
+    fmi3UInt32 busSegment;                                                 /**< Index of the bus segment the Bus Terminal is connected to. */
+    fmi3ValueReference valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_COUNT];  /**< Value references indexed by \ref TERMINAL_MEMBERS. */
+    fmi3LsBusUtilClockType txClockType;                                    /**< Type of the `Tx_Clock` variable. */
+} fmi3LsBusUtilBusRoute;
+
+
+/**
+ * \brief Reads the Bus Terminals of an FMU from the content of a terminalsAndIcons.xml file.
+ *
+ * The XML text is read in one pass without allocating memory. Every `<Terminal>` element with
+ * `terminalKind="org.fmi-ls-bus.network-terminal"` and `matchingRule="org.fmi-ls-bus.transceiver"`
+ * is stored as \ref fmi3LsBusUtilBusTerminal. Nested terminals, such as the Configuration Terminal,
+ * are skipped. `Status` is set to fmi3False if a Bus Terminal does not contain all four member variables,
+ * if `Capacity` is exceeded or if the XML text is malformed.
+ *
+ * \param[in]  Xml        Pointer to the XML text of the terminalsAndIcons.xml file.
+ * \param[in]  XmlLength  Length of the XML text in bytes.
+ * \param[out] Terminals  Array of \ref fmi3LsBusUtilBusTerminal.
+ * \param[in]  Capacity   Number of elements of the array `Terminals`.
+ * \param[out] Count      Variable of type size_t set to the number of Bus Terminals read.
+ * \param[out] Status     Variable of type fmi3Boolean set to the result.
+ */
+#define FMI3_LS_BUS_TERMINALS_READ(Xml, XmlLength, Terminals, Capacity, Count, Status)                                              \
+    do                                                                                                                              \
+    {                                                                                                                               \
+        fmi3LsBusUtilXmlReader _reader;                                                                                             \
+        fmi3LsBusUtilBusTerminal* _terminal = NULL;                                                                                 \
+        fmi3UInt32 _terminalLevel = 0;                                                                                              \
+        fmi3UInt8 _members = 0;                                                                                                     \
+        (Count) = 0;                                                                                                                \
+        (Status) = fmi3True;                                                                                                        \
+                                                                                                                                    \
+        FMI3_LS_BUS_XML_READER_INIT(&_reader, (Xml), (XmlLength));                                                                  \
+        while (Status)                                                                                                              \
+        {                                                                                                                           \
+            FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&_reader);                                                                            \
+            if (!_reader.status)                                                                                                    \
+            {                                                                                                                       \
+                break;                                                                                                              \
+            }                                                                                                                       \
+            if (_terminal == NULL && !_reader.isEndTag && FMI3_LS_BUS_XML_ELEMENT_IS(&_reader, "Terminal"))                         \
+            {                                                                                                                       \
+                fmi3Boolean _isNetworkTerminal = fmi3False;                                                                         \
+                fmi3Boolean _isTransceiver = fmi3False;                                                                             \
+                const fmi3Char* _name = NULL;                                                                                       \
+                size_t _nameLength = 0;                                                                                             \
+                FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                      \
+                while (_reader.status)                                                                                              \
+                {                                                                                                                   \
+                    if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "terminalKind"))                                                     \
+                    {                                                                                                               \
+                        _isNetworkTerminal =                                                                                        \
+                            FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "org.fmi-ls-bus.network-terminal");                        \
+                    }                                                                                                               \
+                    else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "matchingRule"))                                                \
+                    {                                                                                                               \
+                        _isTransceiver = FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "org.fmi-ls-bus.transceiver");                \
+                    }                                                                                                               \
+                    else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "name"))                                                        \
+                    {                                                                                                               \
+                        _name = _reader.attributeValue;                                                                             \
+                        _nameLength = _reader.attributeValueLength;                                                                 \
+                    }                                                                                                               \
+                    FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                  \
+                }                                                                                                                   \
+                if (_isNetworkTerminal && _isTransceiver)                                                                           \
+                {                                                                                                                   \
+                    if ((Count) < (size_t)(Capacity) && !_reader.isEmptyElement)                                                    \
+                    {                                                                                                               \
+                        _terminal = &(Terminals)[(Count)];                                                                          \
+                        memset(_terminal, 0, sizeof(fmi3LsBusUtilBusTerminal));                                                     \
+                        _terminal->name = _name;                                                                                    \
+                        _terminal->nameLength = _nameLength;                                                                        \
+                        _terminalLevel = _reader.level;                                                                             \
+                        _members = 0;                                                                                               \
+                    }                                                                                                               \
+                    else                                                                                                            \
+                    {                                                                                                               \
+                        (Status) = fmi3False;                                                                                       \
+                    }                                                                                                               \
+                }                                                                                                                   \
+            }                                                                                                                       \
+            else if (_terminal != NULL && _reader.isEndTag && _reader.level == _terminalLevel)                                      \
+            {                                                                                                                       \
+                (Status) = (_members == 0xF) ? fmi3True : fmi3False;                                                                \
+                (Count)++;                                                                                                          \
+                _terminal = NULL;                                                                                                   \
+            }                                                                                                                       \
+            else if (_terminal != NULL && !_reader.isEndTag && _reader.level == _terminalLevel + 1 &&                               \
+                     FMI3_LS_BUS_XML_ELEMENT_IS(&_reader, "TerminalMemberVariable"))                                                \
+            {                                                                                                                       \
+                const fmi3Char* _variableName = NULL;                                                                               \
+                size_t _variableNameLength = 0;                                                                                     \
+                int _member = -1;                                                                                                   \
+                FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                      \
+                while (_reader.status)                                                                                              \
+                {                                                                                                                   \
+                    if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "variableName"))                                                     \
+                    {                                                                                                               \
+                        _variableName = _reader.attributeValue;                                                                     \
+                        _variableNameLength = _reader.attributeValueLength;                                                         \
+                    }                                                                                                               \
+                    else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "memberName"))                                                  \
+                    {                                                                                                               \
+                        _member = FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "Tx_Data")  ? FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA :  \
+                                  FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "Tx_Clock") ? FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK : \
+                                  FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "Rx_Data")  ? FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA :  \
+                                  FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "Rx_Clock") ? FMI3_LS_BUS_TERMINAL_MEMBER_RX_CLOCK : \
+                                  -1;                                                                                               \
+                    }                                                                                                               \
+                    FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                  \
+                }                                                                                                                   \
+                if (_member >= 0 && _variableName != NULL)                                                                          \
+                {                                                                                                                   \
+                    _terminal->variableName[_member] = _variableName;                                                               \
+                    _terminal->variableNameLength[_member] = _variableNameLength;                                                   \
+                    _members |= (fmi3UInt8)(1u << _member);                                                                         \
+                }                                                                                                                   \
+            }                                                                                                                       \
+        }                                                                                                                           \
+                                                                                                                                    \
+        if (_terminal != NULL || _reader.pos != _reader.end || _reader.openElements != 0)                                           \
+        {                                                                                                                           \
+            /* Unterminated Bus Terminal or malformed XML text. */                                                                  \
+            (Status) = fmi3False;                                                                                                   \
+        }                                                                                                                           \
+    }                                                                                                                               \
+    while (0)
+
+/**
+ * \brief Resolves the value references and the Tx Clock type of Bus Terminals using the content of
+ *  the modelDescription.xml file of the same FMU.
+ *
+ * The XML text is read in one pass without allocating memory. `Status` is set to fmi3False if a variable
+ * referenced by one of the Bus Terminals is not found.
+ *
+ * \param[in]     Xml        Pointer to the XML text of the modelDescription.xml file.
+ * \param[in]     XmlLength  Length of the XML text in bytes.
+ * \param[in,out] Terminals  Array of \ref fmi3LsBusUtilBusTerminal read by \ref FMI3_LS_BUS_TERMINALS_READ.
+ * \param[in]     Count      Number of Bus Terminals.
+ * \param[out]    Status     Variable of type fmi3Boolean set to the result.
+ */
+#define FMI3_LS_BUS_TERMINALS_RESOLVE(Xml, XmlLength, Terminals, Count, Status)                                                 \
+    do                                                                                                                          \
+    {                                                                                                                           \
+        fmi3LsBusUtilXmlReader _reader;                                                                                         \
+        size_t _terminalIndex;                                                                                                  \
+        int _member;                                                                                                            \
+        FMI3_LS_BUS_XML_READER_INIT(&_reader, (Xml), (XmlLength));                                                              \
+        for (;;)                                                                                                                \
+        {                                                                                                                       \
+            const fmi3Char* _name = NULL;                                                                                       \
+            size_t _nameLength = 0;                                                                                             \
+            fmi3ValueReference _valueReference = 0;                                                                             \
+            fmi3Boolean _hasValueReference = fmi3False;                                                                         \
+            fmi3LsBusUtilClockType _clockType = FMI3_LS_BUS_CLOCK_TYPE_UNKNOWN;                                                 \
+            FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&_reader);                                                                        \
+            if (!_reader.status)                                                                                                \
+            {                                                                                                                   \
+                break;                                                                                                          \
+            }                                                                                                                   \
+            FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                      \
+            while (_reader.status && !_reader.isEndTag)                                                                         \
+            {                                                                                                                   \
+                if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "name"))                                                             \
+                {                                                                                                               \
+                    _name = _reader.attributeValue;                                                                             \
+                    _nameLength = _reader.attributeValueLength;                                                                 \
+                }                                                                                                               \
+                else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "valueReference"))                                              \
+                {                                                                                                               \
+                    size_t _digit;                                                                                              \
+                    _hasValueReference = (_reader.attributeValueLength > 0) ? fmi3True : fmi3False;                             \
+                    for (_digit = 0; _hasValueReference && _digit < _reader.attributeValueLength; _digit++)                     \
+                    {                                                                                                           \
+                        const fmi3ValueReference _value = (fmi3ValueReference)(_reader.attributeValue[_digit] - '0');           \
+                        if (_reader.attributeValue[_digit] < '0' || _reader.attributeValue[_digit] > '9' ||                     \
+                            _valueReference > (0xFFFFFFFFU - _value) / 10)                                                      \
+                        {                                                                                                       \
+                            _hasValueReference = fmi3False;                                                                     \
+                        }                                                                                                       \
+                        else                                                                                                    \
+                        {                                                                                                       \
+                            _valueReference = _valueReference * 10 + _value;                                                    \
+                        }                                                                                                       \
+                    }                                                                                                           \
+                }                                                                                                               \
+                else if (FMI3_LS_BUS_XML_ATTRIBUTE_IS(&_reader, "intervalVariability"))                                         \
+                {                                                                                                               \
+                    _clockType = FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "triggered") ? FMI3_LS_BUS_CLOCK_TYPE_TRIGGERED : \
+                                 FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "constant")  ? FMI3_LS_BUS_CLOCK_TYPE_CONSTANT :  \
+                                 FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "fixed")     ? FMI3_LS_BUS_CLOCK_TYPE_FIXED :     \
+                                 FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "tunable")   ? FMI3_LS_BUS_CLOCK_TYPE_TUNABLE :   \
+                                 FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "changing")  ? FMI3_LS_BUS_CLOCK_TYPE_CHANGING :  \
+                                 FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(&_reader, "countdown") ? FMI3_LS_BUS_CLOCK_TYPE_COUNTDOWN : \
+                                 FMI3_LS_BUS_CLOCK_TYPE_UNKNOWN;                                                                \
+                }                                                                                                               \
+                FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(&_reader);                                                                  \
+            }                                                                                                                   \
+            if (_name != NULL && _hasValueReference)                                                                            \
+            {                                                                                                                   \
+                for (_terminalIndex = 0; _terminalIndex < (size_t)(Count); _terminalIndex++)                                    \
+                {                                                                                                               \
+                    fmi3LsBusUtilBusTerminal* _terminal = &(Terminals)[_terminalIndex];                                         \
+                    for (_member = 0; _member < FMI3_LS_BUS_TERMINAL_MEMBER_COUNT; _member++)                                   \
+                    {                                                                                                           \
+                        if (_terminal->variableNameLength[_member] == _nameLength &&                                            \
+                            memcmp(_terminal->variableName[_member], _name, _nameLength) == 0)                                  \
+                        {                                                                                                       \
+                            _terminal->valueReference[_member] = _valueReference;                                               \
+                            _terminal->resolved |= (fmi3UInt8)(1u << _member);                                                  \
+                            if (_member == FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK)                                                \
+                            {                                                                                                   \
+                                _terminal->txClockType = _clockType;                                                            \
+                            }                                                                                                   \
+                        }                                                                                                       \
+                    }                                                                                                           \
+                }                                                                                                               \
+            }                                                                                                                   \
+        }                                                                                                                       \
+                                                                                                                                \
+        (Status) = (_reader.pos == _reader.end && _reader.openElements == 0) ? fmi3True : fmi3False;                            \
+        for (_terminalIndex = 0; _terminalIndex < (size_t)(Count); _terminalIndex++)                                            \
+        {                                                                                                                       \
+            if ((Terminals)[_terminalIndex].resolved != 0xF)                                                                    \
+            {                                                                                                                   \
+                (Status) = fmi3False;                                                                                           \
+            }                                                                                                                   \
+        }                                                                                                                       \
+    }                                                                                                                           \
+    while (0)
+
+/**
+ * \brief Appends the routes of the Bus Terminals of one FMU to a routing table.
+ *
+ * Each Bus Terminal is assigned to the bus segment with the same name. If no such segment exists yet,
+ * it is appended to `Segments`. The resulting \ref fmi3LsBusUtilBusRoute entries only contain value
+ * references and indices and can be stored by the importer to connect all FMUs in O(terminals) on the
+ * next start. `Status` is set to fmi3False if `SegmentCapacity` is exceeded.
+ *
+ * The names of appended segments are not copied but refer to the name of the first Bus Terminal
+ * connected to them. The XML text of this FMU must therefore not be released or reused while
+ * `Segments` is passed to further calls, e.g. for the remaining FMUs. The routes do not depend on it.
+ *
+ * Example:
+ * \code
+ * for (fmu = 0; fmu < fmuCount; fmu++)
+ * {
+ *     FMI3_LS_BUS_TERMINALS_READ(terminalsXml[fmu], ..., terminals, 16, terminalCount, status);
+ *     FMI3_LS_BUS_TERMINALS_RESOLVE(modelDescriptionXml[fmu], ..., terminals, terminalCount, status);
+ *     FMI3_LS_BUS_TERMINALS_BUILD_ROUTES(terminals, terminalCount, fmu, segments, 64, segmentCount,
+ *                                        &routes[routeCount], status);
+ *     routeCount += terminalCount;
+ * }
+ * \endcode
+ *
+ * \param[in]     Terminals        Array of resolved \ref fmi3LsBusUtilBusTerminal.
+ * \param[in]     Count            Number of Bus Terminals.
+ * \param[in]     FmuIndex         Index of the FMU the Bus Terminals belong to.
+ * \param[in,out] Segments         Array of \ref fmi3LsBusUtilBusSegment.
+ * \param[in]     SegmentCapacity  Number of elements of the array `Segments`.
+ * \param[in,out] SegmentCount     Variable of type size_t holding the number of bus segments.
+ * \param[out]    Routes           Array of \ref fmi3LsBusUtilBusRoute with at least `Count` elements.
+ * \param[out]    Status           Variable of type fmi3Boolean set to the result.
+ */
+#define FMI3_LS_BUS_TERMINALS_BUILD_ROUTES(Terminals, Count, FmuIndex, Segments, SegmentCapacity, SegmentCount, \
+                                           Routes, Status)                                                      \
+    do                                                                                                          \
+    {                                                                                                           \
+        size_t _terminalIndex;                                                                                  \
+        size_t _segmentIndex;                                                                                   \
+        (Status) = fmi3True;                                                                                    \
+        for (_terminalIndex = 0; _terminalIndex < (size_t)(Count) && (Status); _terminalIndex++)                \
+        {                                                                                                       \
+            const fmi3LsBusUtilBusTerminal* _terminal = &(Terminals)[_terminalIndex];                           \
+            fmi3LsBusUtilBusRoute* _route = &(Routes)[_terminalIndex];                                          \
+            for (_segmentIndex = 0; _segmentIndex < (SegmentCount); _segmentIndex++)                            \
+            {                                                                                                   \
+                if ((Segments)[_segmentIndex].nameLength == _terminal->nameLength &&                            \
+                    memcmp((Segments)[_segmentIndex].name, _terminal->name, _terminal->nameLength) == 0)        \
+                {                                                                                               \
+                    break;                                                                                      \
+                }                                                                                               \
+            }                                                                                                   \
+            if (_segmentIndex == (SegmentCount))                                                                \
+            {                                                                                                   \
+                if ((SegmentCount) < (size_t)(SegmentCapacity))                                                 \
+                {                                                                                               \
+                    (Segments)[_segmentIndex].name = _terminal->name;                                           \
+                    (Segments)[_segmentIndex].nameLength = _terminal->nameLength;                               \
+                    (SegmentCount)++;                                                                           \
+                }                                                                                               \
+                else                                                                                            \
+                {                                                                                               \
+                    (Status) = fmi3False;                                                                       \
+                    break;                                                                                      \
+                }                                                                                               \
+            }                                                                                                   \
+            _route->fmuIndex = (fmi3UInt32)(FmuIndex);                                                          \
+            _route->busSegment = (fmi3UInt32)_segmentIndex;                                                     \
+            memcpy(_route->valueReference, _terminal->valueReference, sizeof(_route->valueReference));          \
+            _route->txClockType = _terminal->txClockType;                                                       \
+        }                                                                                                       \
+    }                                                                                                           \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilTerminals_h */
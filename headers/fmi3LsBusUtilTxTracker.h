@@ -0,0 +1,344 @@
+#ifndef fmi3LsBusUtilTxTracker_h
+#define fmi3LsBusUtilTxTracker_h
+
+/*
+This header file contains utility macros to track the outstanding transmissions of sending nodes, matching
+received CAN and FlexRay Confirm operations to their transmissions in constant time, detecting timeouts and
+measuring the latency between the submission and the confirmation of a frame.
+
+This header can be used when creating Network FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+#include "fmi3LsBusCan.h"
+#include "fmi3LsBusFlexRay.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief Returns the key of a FlexRay transmission in a \ref fmi3LsBusUtilTxTracker.
+ *
+ * \param[in] CycleId  Cycle of the transmission.
+ * \param[in] SlotId   Slot of the transmission.
+ * \param[in] Channel  Channel(s) of the transmission.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY(CycleId, SlotId, Channel)                      \
+    (((fmi3UInt32)(CycleId) << 24) | ((fmi3UInt32)(SlotId) << 8) | (fmi3UInt32)(Channel))
+
+/**
+ * \brief Outstanding transmission.
+ */
+typedef struct
+{
+    fmi3UInt32 key;     /**< CAN ID or FlexRay key, see \ref FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY. */
+    fmi3Boolean used;   /**< Whether the entry holds an outstanding transmission. */
+    fmi3UInt64 time;    /**< Time of the submission in nanoseconds. */
+    void* context;      /**< Application data of the transmission, e.g. a PDU handle. */
+} fmi3LsBusUtilTxTrackerEntry;
+
+/**
+ * \brief This data type holds the state of a tracker of outstanding transmissions.
+ *
+ * The outstanding transmissions are kept in a hash table with linear probing stored in a caller-provided array.
+ * A key can only have one outstanding transmission at a time.
+ *
+ * Variables of this type must be initialized using \ref FMI3_LS_BUS_TX_TRACKER_INIT.
+ */
+typedef struct
+{
+    fmi3LsBusUtilTxTrackerEntry* entries; /**< Hash table of outstanding transmissions, provided by the caller. */
+    size_t capacity;                      /**< Number of entries, a power of 2. */
+    size_t size;                          /**< Number of outstanding transmissions. */
+    fmi3UInt64 timeout;                   /**< Time after which a transmission expires in nanoseconds, 0 for none. */
+    fmi3UInt64 confirms;                  /**< Number of matched Confirm operations. */
+    fmi3UInt64 unmatched;                 /**< Number of Confirm operations without outstanding transmission. */
+    fmi3UInt64 timeouts;                  /**< Number of expired transmissions. */
+    fmi3UInt64 latencySum;                /**< Sum of the latencies of confirmed transmissions in nanoseconds. */
+    fmi3UInt64 latencyMin;                /**< Minimum latency of confirmed transmissions in nanoseconds. */
+    fmi3UInt64 latencyMax;                /**< Maximum latency of confirmed transmissions in nanoseconds. */
+    fmi3Boolean status;                   /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+} fmi3LsBusUtilTxTracker;
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilTxTracker.
+ *
+ * \param[in] Tracker   Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in] Entries   Array of \ref fmi3LsBusUtilTxTrackerEntry.
+ * \param[in] Capacity  Number of elements of `Entries`, a power of 2 greater than the maximum number of
+ *                      outstanding transmissions.
+ * \param[in] Timeout   Time after which a transmission expires in nanoseconds, 0 for none.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_INIT(Tracker, Entries, Capacity, Timeout)                \
+    do                                                                                  \
+    {                                                                                   \
+        memset((Entries), 0, sizeof(fmi3LsBusUtilTxTrackerEntry) * (size_t)(Capacity)); \
+        memset((Tracker), 0, sizeof(fmi3LsBusUtilTxTracker));                           \
+        (Tracker)->entries = (Entries);                                                 \
+        (Tracker)->capacity = (size_t)(Capacity);                                       \
+        (Tracker)->timeout = (fmi3UInt64)(Timeout);                                     \
+        (Tracker)->latencyMin = (fmi3UInt64)0xFFFFFFFFFFFFFFFFULL;                      \
+        (Tracker)->status = fmi3True;                                                   \
+    }                                                                                   \
+    while (0)
+
+/**
+ * \brief Returns the home index of `Key` in the hash table.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_HASH_INTERNAL(Tracker, Key)                                                                \
+    ((size_t)(((fmi3UInt32)(Key) * 0x9E3779B1U) ^ (((fmi3UInt32)(Key) * 0x9E3779B1U) >> 16)) & ((Tracker)->capacity - 1))
+
+/**
+ * \brief Looks up `Key` using linear probing. `Index` is set to the entry holding `Key` or to the free entry
+ *        ending the probe sequence, `Index` is set to `Tracker->capacity` if the table is full.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_FIND_INTERNAL(Tracker, Key, Index)                                      \
+    do                                                                                                 \
+    {                                                                                                  \
+        size_t _probe;                                                                                 \
+        size_t _slot = FMI3_LS_BUS_TX_TRACKER_HASH_INTERNAL((Tracker), (Key));                         \
+        (Index) = (Tracker)->capacity;                                                                 \
+        for (_probe = 0; _probe < (Tracker)->capacity; _probe++)                                       \
+        {                                                                                              \
+            if (!(Tracker)->entries[_slot].used || (Tracker)->entries[_slot].key == (fmi3UInt32)(Key)) \
+            {                                                                                          \
+                (Index) = _slot;                                                                       \
+                break;                                                                                 \
+            }                                                                                          \
+            _slot = (_slot + 1) & ((Tracker)->capacity - 1);                                           \
+        }                                                                                              \
+    }                                                                                                  \
+    while (0)
+
+/**
+ * \brief Removes the entry at `Index`, moving following entries of the probe sequence back instead of leaving
+ *        a deleted marker.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_REMOVE_INTERNAL(Tracker, Index)                                                   \
+    do                                                                                                           \
+    {                                                                                                            \
+        const size_t _mask = (Tracker)->capacity - 1;                                                            \
+        size_t _hole = (Index);                                                                                  \
+        size_t _next = (_hole + 1) & _mask;                                                                      \
+        while ((Tracker)->entries[_next].used)                                                                   \
+        {                                                                                                        \
+            const size_t _home = FMI3_LS_BUS_TX_TRACKER_HASH_INTERNAL((Tracker), (Tracker)->entries[_next].key); \
+            if (((_next - _home) & _mask) >= ((_next - _hole) & _mask))                                          \
+            {                                                                                                    \
+                (Tracker)->entries[_hole] = (Tracker)->entries[_next];                                           \
+                _hole = _next;                                                                                   \
+            }                                                                                                    \
+            _next = (_next + 1) & _mask;                                                                         \
+        }                                                                                                        \
+        (Tracker)->entries[_hole].used = fmi3False;                                                              \
+        (Tracker)->size--;                                                                                       \
+    }                                                                                                            \
+    while (0)
+
+/**
+ * \brief Registers a submitted transmission.
+ *
+ * If the key already has an outstanding transmission or the table is full, the 'status' variable of the
+ * argument 'Tracker' is set to fmi3False and the transmission is not tracked.
+ *
+ * \param[in] Tracker  Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in] Key      CAN ID or FlexRay key, see \ref FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY.
+ * \param[in] Time     Time of the submission in nanoseconds.
+ * \param[in] Context  Application data returned when the transmission is confirmed or expires.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_SUBMIT(Tracker, Key, Time, Context)                \
+    do                                                                            \
+    {                                                                             \
+        size_t _index;                                                            \
+        (Tracker)->status = fmi3False;                                            \
+        if ((Tracker)->size + 1 < (Tracker)->capacity)                            \
+        {                                                                         \
+            FMI3_LS_BUS_TX_TRACKER_FIND_INTERNAL((Tracker), (Key), _index);       \
+            if (_index < (Tracker)->capacity && !(Tracker)->entries[_index].used) \
+            {                                                                     \
+                (Tracker)->entries[_index].key = (fmi3UInt32)(Key);               \
+                (Tracker)->entries[_index].used = fmi3True;                       \
+                (Tracker)->entries[_index].time = (fmi3UInt64)(Time);             \
+                (Tracker)->entries[_index].context = (Context);                   \
+                (Tracker)->size++;                                                \
+                (Tracker)->status = fmi3True;                                     \
+            }                                                                     \
+        }                                                                         \
+    }                                                                             \
+    while (0)
+
+/**
+ * \brief Matches a confirmation to its outstanding transmission and removes the transmission.
+ *
+ * If no transmission of the key is outstanding, `Context` is set to NULL, `Latency` to 0 and the
+ * 'status' variable of the argument 'Tracker' is set to fmi3False.
+ *
+ * \param[in]  Tracker  Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in]  Key      CAN ID or FlexRay key, see \ref FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY.
+ * \param[in]  Time     Time of the confirmation in nanoseconds.
+ * \param[out] Context  Variable of type void* set to the application data of the transmission.
+ * \param[out] Latency  Variable of type fmi3UInt64 set to the time from submission to confirmation.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_CONFIRM(Tracker, Key, Time, Context, Latency)                               \
+    do                                                                                                     \
+    {                                                                                                      \
+        size_t _index;                                                                                     \
+        FMI3_LS_BUS_TX_TRACKER_FIND_INTERNAL((Tracker), (Key), _index);                                    \
+        (Context) = NULL;                                                                                  \
+        (Latency) = 0;                                                                                     \
+        (Tracker)->status = fmi3False;                                                                     \
+        if (_index < (Tracker)->capacity && (Tracker)->entries[_index].used)                               \
+        {                                                                                                  \
+            (Context) = (Tracker)->entries[_index].context;                                                \
+            (Latency) = (fmi3UInt64)(Time) - (Tracker)->entries[_index].time;                              \
+            (Tracker)->confirms++;                                                                         \
+            (Tracker)->latencySum += (Latency);                                                            \
+            (Tracker)->latencyMin = (Latency) < (Tracker)->latencyMin ? (Latency) : (Tracker)->latencyMin; \
+            (Tracker)->latencyMax = (Latency) > (Tracker)->latencyMax ? (Latency) : (Tracker)->latencyMax; \
+            (Tracker)->status = fmi3True;                                                                  \
+            FMI3_LS_BUS_TX_TRACKER_REMOVE_INTERNAL((Tracker), _index);                                     \
+        }                                                                                                  \
+        else                                                                                               \
+        {                                                                                                  \
+            (Tracker)->unmatched++;                                                                        \
+        }                                                                                                  \
+    }                                                                                                      \
+    while (0)
+
+/**
+ * \brief Matches a received CAN Confirm operation, see \ref FMI3_LS_BUS_TX_TRACKER_CONFIRM.
+ *
+ * \param[in]  Tracker    Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in]  Operation  Pointer to \ref fmi3LsBusCanOperationConfirm.
+ * \param[in]  Time       Time of the confirmation in nanoseconds.
+ * \param[out] Context    Variable of type void* set to the application data of the transmission.
+ * \param[out] Latency    Variable of type fmi3UInt64 set to the time from submission to confirmation.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_CAN_CONFIRM(Tracker, Operation, Time, Context, Latency)                           \
+    FMI3_LS_BUS_TX_TRACKER_CONFIRM((Tracker), FMI3_LS_BUS_GET_LE((Operation)->id), (Time), (Context), (Latency))
+
+/**
+ * \brief Matches a received FlexRay Confirm operation, see \ref FMI3_LS_BUS_TX_TRACKER_CONFIRM.
+ *
+ * \param[in]  Tracker    Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in]  Operation  Pointer to \ref fmi3LsBusFlexRayOperationConfirm.
+ * \param[in]  Time       Time of the confirmation in nanoseconds.
+ * \param[out] Context    Variable of type void* set to the application data of the transmission.
+ * \param[out] Latency    Variable of type fmi3UInt64 set to the time from submission to confirmation.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_FLEXRAY_CONFIRM(Tracker, Operation, Time, Context, Latency)                     \
+    FMI3_LS_BUS_TX_TRACKER_CONFIRM((Tracker),                                                                  \
+                                   FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY((Operation)->cycleId,                    \
+                                                                      FMI3_LS_BUS_GET_LE((Operation)->slotId), \
+                                                                      (Operation)->channel),                   \
+                                   (Time), (Context), (Latency))
+
+/**
+ * \brief Removes an outstanding transmission without confirmation, e.g. after a FlexRay Cancel operation.
+ *
+ * If no transmission of the key is outstanding, the 'status' variable of the argument 'Tracker' is set to fmi3False.
+ *
+ * \param[in]  Tracker  Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in]  Key      CAN ID or FlexRay key, see \ref FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY.
+ * \param[out] Context  Variable of type void* set to the application data of the transmission or NULL.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_CANCEL(Tracker, Key, Context)                 \
+    do                                                                       \
+    {                                                                        \
+        size_t _index;                                                       \
+        FMI3_LS_BUS_TX_TRACKER_FIND_INTERNAL((Tracker), (Key), _index);      \
+        (Context) = NULL;                                                    \
+        (Tracker)->status = fmi3False;                                       \
+        if (_index < (Tracker)->capacity && (Tracker)->entries[_index].used) \
+        {                                                                    \
+            (Context) = (Tracker)->entries[_index].context;                  \
+            (Tracker)->status = fmi3True;                                    \
+            FMI3_LS_BUS_TX_TRACKER_REMOVE_INTERNAL((Tracker), _index);       \
+        }                                                                    \
+    }                                                                        \
+    while (0)
+
+/**
+ * \brief Removes the transmissions submitted more than the timeout of the tracker before `Time` and returns
+ *        their application data.
+ *
+ * The whole table is scanned, so this macro is intended to be called once per communication point rather than
+ * per operation. If more transmissions expired than `Capacity`, the remaining ones are returned by the next call.
+ *
+ * \param[in]  Tracker   Pointer to \ref fmi3LsBusUtilTxTracker.
+ * \param[in]  Time      Current time in nanoseconds.
+ * \param[out] Contexts  Array of void* receiving the application data of the expired transmissions.
+ * \param[in]  Capacity  Number of elements of the array `Contexts`.
+ * \param[out] Count     Variable of type size_t set to the number of expired transmissions returned.
+ */
+#define FMI3_LS_BUS_TX_TRACKER_EXPIRE(Tracker, Time, Contexts, Capacity, Count)                             \
+    do                                                                                                      \
+    {                                                                                                       \
+        size_t _entryIndex = 0;                                                                             \
+        (Count) = 0;                                                                                        \
+        while ((Tracker)->timeout > 0 && _entryIndex < (Tracker)->capacity && (Count) < (size_t)(Capacity)) \
+        {                                                                                                   \
+            if ((Tracker)->entries[_entryIndex].used &&                                                     \
+                (fmi3UInt64)(Time) - (Tracker)->entries[_entryIndex].time > (Tracker)->timeout)             \
+            {                                                                                               \
+                (Contexts)[(Count)++] = (Tracker)->entries[_entryIndex].context;                            \
+                (Tracker)->timeouts++;                                                                      \
+                FMI3_LS_BUS_TX_TRACKER_REMOVE_INTERNAL((Tracker), _entryIndex);                             \
+            }                                                                                               \
+            else                                                                                            \
+            {                                                                                               \
+                _entryIndex++;                                                                              \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+    while (0)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilTxTracker_h */
@@ -0,0 +1,380 @@
+#ifndef fmi3LsBusUtilXml_h
+#define fmi3LsBusUtilXml_h
+
+/*
+This header file contains utility macros to read XML documents of the FMI-LS-BUS,
+such as the layered standard manifest file or the terminalsAndIcons.xml file,
+without allocating memory.
+
+This header can be used when creating importers or Bus Simulation FMUs.
+
+Copyright (C) 2023-2025 Modelica Association Project "FMI"
+              All rights reserved.
+
+This file is licensed by the copyright holders under the 2-Clause BSD License
+(https://opensource.org/licenses/BSD-2-Clause):
+
+----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+- Redistributions of source code must retain the above copyright notice,
+ this list of conditions and the following disclaimer.
+
+- Redistributions in binary form must reproduce the above copyright notice,
+ this list of conditions and the following disclaimer in the documentation
+ and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+----------------------------------------------------------------------------
+*/
+
+#include <string.h>
+
+#include "fmi3LsBus.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * \brief This data type holds the state of a forward-only XML reader used by the utility macros
+ *  \ref FMI3_LS_BUS_XML_READ_NEXT_ELEMENT and \ref FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE.
+ *
+ * The reader works directly on the XML text passed to \ref FMI3_LS_BUS_XML_READER_INIT and does not
+ * allocate memory. Names and values are provided as pointer/length pairs referring to this text and are
+ * therefore only valid as long as the text is valid. Entity references are not resolved.
+ */
+typedef struct
+{
+    const fmi3Char* pos;             /**< The current read position. */
+    const fmi3Char* end;             /**< The end address of the XML text. */
+    const fmi3Char* name;            /**< Name of the current element. */
+    size_t nameLength;               /**< Length of the name of the current element. */
+    fmi3Boolean isEndTag;            /**< Whether the current element is an end tag (e.g. `</Terminal>`). */
+    fmi3Boolean isEmptyElement;      /**< Whether the current element is an empty-element tag (e.g. `<Terminal/>`). */
+    fmi3UInt32 level;                /**< Nesting level of the current element, beginning with 1 for the root element. */
+    fmi3UInt32 openElements;         /**< Number of elements opened but not yet closed. */
+    const fmi3Char* attributePos;    /**< The current read position within the attributes of the current element. */
+    const fmi3Char* attributesEnd;   /**< The end address of the attributes of the current element. */
+    const fmi3Char* attributeName;   /**< Name of the current attribute. */
+    size_t attributeNameLength;      /**< Length of the name of the current attribute. */
+    const fmi3Char* attributeValue;  /**< Value of the current attribute. */
+    size_t attributeValueLength;     /**< Length of the value of the current attribute. */
+    fmi3Boolean status;              /**< Holds the status (`fmi3True` or `fmi3False`) of the last macro call. */
+} fmi3LsBusUtilXmlReader;
+
+
+/**
+ * \brief Initializes a variable of type \ref fmi3LsBusUtilXmlReader.
+ *
+ * Example:
+ * \code
+ * fmi3LsBusUtilXmlReader reader;
+ * FMI3_LS_BUS_XML_READER_INIT(&reader, xmlText, xmlTextLength);
+ * \endcode
+ *
+ * \param[in] Reader     Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ * \param[in] Xml        Pointer to the XML text.
+ * \param[in] XmlLength  Length of the XML text in bytes.
+ */
+#define FMI3_LS_BUS_XML_READER_INIT(Reader, Xml, XmlLength)  \
+    do                                                       \
+    {                                                        \
+        memset((Reader), 0, sizeof(fmi3LsBusUtilXmlReader)); \
+        (Reader)->pos = (const fmi3Char*)(Xml);              \
+        (Reader)->end = (Reader)->pos + (XmlLength);         \
+        (Reader)->attributePos = (Reader)->pos;              \
+        (Reader)->attributesEnd = (Reader)->pos;             \
+        (Reader)->status = fmi3True;                         \
+    }                                                        \
+    while (0)
+
+/**
+ * \brief Checks whether a character is an XML white space character.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(Char)                           \
+    ((Char) == ' ' || (Char) == '\t' || (Char) == '\r' || (Char) == '\n')
+
+/**
+ * \brief Advances `Pos` behind the next occurrence of the string literal `Pattern` or to `End` if it does not occur.
+ *
+ * \note This macro is reserved for internal use in the definition of other macros and it not considered
+ *       a part of the public interface of the headers and may change without notice.
+ */
+#define FMI3_LS_BUS_XML_SKIP_BEHIND_INTERNAL(Pos, End, Pattern)                                         \
+    do                                                                                                  \
+    {                                                                                                   \
+        while ((size_t)((End) - (Pos)) >= sizeof(Pattern) - 1 &&                                        \
+               memcmp((Pos), (Pattern), sizeof(Pattern) - 1) != 0)                                      \
+        {                                                                                               \
+            (Pos)++;                                                                                    \
+        }                                                                                               \
+        (Pos) = ((size_t)((End) - (Pos)) >= sizeof(Pattern) - 1) ? (Pos) + sizeof(Pattern) - 1 : (End); \
+    }                                                                                                   \
+    while (0)
+
+/**
+ * \brief Reads the next element tag from the XML text.
+ *
+ * XML declarations, processing instructions, comments, CDATA sections, document type declarations
+ * and character data are skipped. Start tags, end tags and empty-element tags are reported by setting
+ * the fields `name`, `nameLength`, `isEndTag`, `isEmptyElement` and `level` of the reader. The attributes
+ * of the reported tag can be read afterwards using \ref FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE.
+ * If no further element is available or the XML text is malformed, the 'status' variable of the
+ * argument 'Reader' is set to fmi3False.
+ *
+ * Example:
+ * \code
+ * FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&reader);
+ * while (reader.status)
+ * {
+ *     ...
+ *     FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(&reader);
+ * }
+ * \endcode
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ */
+#define FMI3_LS_BUS_XML_READ_NEXT_ELEMENT(Reader)                                                          \
+    do                                                                                                     \
+    {                                                                                                      \
+        const fmi3Char* _xmlPos = (Reader)->pos;                                                           \
+        const fmi3Char* _xmlEnd = (Reader)->end;                                                           \
+        (Reader)->status = fmi3False;                                                                      \
+        while (_xmlPos < _xmlEnd)                                                                          \
+        {                                                                                                  \
+            if (*_xmlPos != '<')                                                                           \
+            {                                                                                              \
+                _xmlPos++;                                                                                 \
+            }                                                                                              \
+            else if (_xmlEnd - _xmlPos >= 2 && _xmlPos[1] == '?')                                          \
+            {                                                                                              \
+                FMI3_LS_BUS_XML_SKIP_BEHIND_INTERNAL(_xmlPos, _xmlEnd, "?>");                              \
+            }                                                                                              \
+            else if (_xmlEnd - _xmlPos >= 4 && memcmp(_xmlPos, "<!--", 4) == 0)                            \
+            {                                                                                              \
+                FMI3_LS_BUS_XML_SKIP_BEHIND_INTERNAL(_xmlPos, _xmlEnd, "-->");                             \
+            }                                                                                              \
+            else if (_xmlEnd - _xmlPos >= 9 && memcmp(_xmlPos, "<![CDATA[", 9) == 0)                       \
+            {                                                                                              \
+                FMI3_LS_BUS_XML_SKIP_BEHIND_INTERNAL(_xmlPos, _xmlEnd, "]]>");                             \
+            }                                                                                              \
+            else if (_xmlEnd - _xmlPos >= 2 && _xmlPos[1] == '!')                                          \
+            {                                                                                              \
+                FMI3_LS_BUS_XML_SKIP_BEHIND_INTERNAL(_xmlPos, _xmlEnd, ">");                               \
+            }                                                                                              \
+            else                                                                                           \
+            {                                                                                              \
+                const fmi3Char* _xmlTagEnd;                                                                \
+                fmi3Char _xmlQuote = 0;                                                                    \
+                (Reader)->isEndTag = (_xmlEnd - _xmlPos >= 2 && _xmlPos[1] == '/') ? fmi3True : fmi3False; \
+                (Reader)->name = _xmlPos + ((Reader)->isEndTag ? 2 : 1);                                   \
+                _xmlTagEnd = (Reader)->name;                                                               \
+                while (_xmlTagEnd < _xmlEnd && (_xmlQuote != 0 || *_xmlTagEnd != '>'))                     \
+                {                                                                                          \
+                    if (_xmlQuote == 0 && (*_xmlTagEnd == '"' || *_xmlTagEnd == '\''))                     \
+                    {                                                                                      \
+                        _xmlQuote = *_xmlTagEnd;                                                           \
+                    }                                                                                      \
+                    else if (_xmlQuote == *_xmlTagEnd)                                                     \
+                    {                                                                                      \
+                        _xmlQuote = 0;                                                                     \
+                    }                                                                                      \
+                    _xmlTagEnd++;                                                                          \
+                }                                                                                          \
+                if (_xmlTagEnd >= _xmlEnd)                                                                 \
+                {                                                                                          \
+                    _xmlPos = _xmlEnd;                                                                     \
+                    break;                                                                                 \
+                }                                                                                          \
+                (Reader)->attributePos = (Reader)->name;                                                   \
+                while ((Reader)->attributePos < _xmlTagEnd &&                                              \
+                       !FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(*(Reader)->attributePos) &&                      \
+                       *(Reader)->attributePos != '/')                                                     \
+                {                                                                                          \
+                    (Reader)->attributePos++;                                                              \
+                }                                                                                          \
+                (Reader)->nameLength = (size_t)((Reader)->attributePos - (Reader)->name);                  \
+                (Reader)->isEmptyElement =                                                                 \
+                    (!(Reader)->isEndTag && _xmlTagEnd[-1] == '/') ? fmi3True : fmi3False;                 \
+                (Reader)->attributesEnd = (Reader)->isEmptyElement ? _xmlTagEnd - 1 : _xmlTagEnd;          \
+                if ((Reader)->isEndTag)                                                                    \
+                {                                                                                          \
+                    (Reader)->level = (Reader)->openElements;                                              \
+                    (Reader)->openElements -= ((Reader)->openElements > 0) ? 1 : 0;                        \
+                }                                                                                          \
+                else                                                                                       \
+                {                                                                                          \
+                    (Reader)->level = (Reader)->openElements + 1;                                          \
+                    (Reader)->openElements += (Reader)->isEmptyElement ? 0 : 1;                            \
+                }                                                                                          \
+                _xmlPos = _xmlTagEnd + 1;                                                                  \
+                (Reader)->status = ((Reader)->nameLength > 0) ? fmi3True : fmi3False;                      \
+                break;                                                                                     \
+            }                                                                                              \
+        }                                                                                                  \
+        (Reader)->pos = _xmlPos;                                                                           \
+    }                                                                                                      \
+    while (0)
+
+/**
+ * \brief Reads the next attribute of the element tag read last by \ref FMI3_LS_BUS_XML_READ_NEXT_ELEMENT.
+ *
+ * The fields `attributeName`, `attributeNameLength`, `attributeValue` and `attributeValueLength` of the reader
+ * are set to the next attribute. If no further attribute is available or the attribute is malformed, the 'status'
+ * variable of the argument 'Reader' is set to fmi3False. Use \ref FMI3_LS_BUS_XML_ATTRIBUTES_COMPLETE to
+ * distinguish both cases.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ */
+#define FMI3_LS_BUS_XML_READ_NEXT_ATTRIBUTE(Reader)                                                                  \
+    do                                                                                                               \
+    {                                                                                                                \
+        const fmi3Char* _xmlAttributePos = (Reader)->attributePos;                                                   \
+        const fmi3Char* _xmlAttributesEnd = (Reader)->attributesEnd;                                                 \
+        (Reader)->status = fmi3False;                                                                                \
+        while (_xmlAttributePos < _xmlAttributesEnd && FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(*_xmlAttributePos))         \
+        {                                                                                                            \
+            _xmlAttributePos++;                                                                                      \
+        }                                                                                                            \
+        if (_xmlAttributePos < _xmlAttributesEnd)                                                                    \
+        {                                                                                                            \
+            (Reader)->attributeName = _xmlAttributePos;                                                              \
+            while (_xmlAttributePos < _xmlAttributesEnd && *_xmlAttributePos != '=' &&                               \
+                   !FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(*_xmlAttributePos))                                            \
+            {                                                                                                        \
+                _xmlAttributePos++;                                                                                  \
+            }                                                                                                        \
+            (Reader)->attributeNameLength = (size_t)(_xmlAttributePos - (Reader)->attributeName);                    \
+            while (_xmlAttributePos < _xmlAttributesEnd && FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(*_xmlAttributePos))     \
+            {                                                                                                        \
+                _xmlAttributePos++;                                                                                  \
+            }                                                                                                        \
+            if (_xmlAttributePos < _xmlAttributesEnd && *_xmlAttributePos == '=')                                    \
+            {                                                                                                        \
+                _xmlAttributePos++;                                                                                  \
+                while (_xmlAttributePos < _xmlAttributesEnd && FMI3_LS_BUS_XML_IS_SPACE_INTERNAL(*_xmlAttributePos)) \
+                {                                                                                                    \
+                    _xmlAttributePos++;                                                                              \
+                }                                                                                                    \
+                if (_xmlAttributePos < _xmlAttributesEnd && (*_xmlAttributePos == '"' || *_xmlAttributePos == '\'')) \
+                {                                                                                                    \
+                    const fmi3Char _xmlAttributeQuote = *_xmlAttributePos++;                                         \
+                    (Reader)->attributeValue = _xmlAttributePos;                                                     \
+                    while (_xmlAttributePos < _xmlAttributesEnd && *_xmlAttributePos != _xmlAttributeQuote)          \
+                    {                                                                                                \
+                        _xmlAttributePos++;                                                                          \
+                    }                                                                                                \
+                    if (_xmlAttributePos < _xmlAttributesEnd && (Reader)->attributeNameLength > 0)                   \
+                    {                                                                                                \
+                        (Reader)->attributeValueLength = (size_t)(_xmlAttributePos - (Reader)->attributeValue);      \
+                        _xmlAttributePos++;                                                                          \
+                        (Reader)->status = fmi3True;                                                                 \
+                    }                                                                                                \
+                }                                                                                                    \
+            }                                                                                                        \
+            if (!(Reader)->status)                                                                                   \
+            {                                                                                                        \
+                _xmlAttributePos = (Reader)->attributeName;                                                          \
+            }                                                                                                        \
+        }                                                                                                            \
+        (Reader)->attributePos = _xmlAttributePos;                                                                   \
+    }                                                                                                                \
+    while (0)
+
+/**
+ * \brief Checks whether all attributes of the current element tag were read successfully.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ * \return            fmi3True if all attributes were read, fmi3False if a malformed attribute was encountered.
+ */
+#define FMI3_LS_BUS_XML_ATTRIBUTES_COMPLETE(Reader)                            \
+    ((Reader)->attributePos == (Reader)->attributesEnd ? fmi3True : fmi3False)
+
+/**
+ * \brief Compares a name or value given as pointer/length pair with a string literal.
+ *
+ * \param[in] Name        Pointer to the name.
+ * \param[in] NameLength  Length of the name.
+ * \param[in] Literal     The string literal to compare with.
+ * \return                fmi3True if both are equal, otherwise fmi3False.
+ */
+#define FMI3_LS_BUS_XML_EQUALS(Name, NameLength, Literal)                                           \
+    (((NameLength) == sizeof(Literal) - 1 && memcmp((Name), (Literal), sizeof(Literal) - 1) == 0) ? \
+        fmi3True : fmi3False)
+
+/**
+ * \brief Checks whether a name given as pointer/length pair is a qualified name (`prefix:LocalName`)
+ *  with a non-empty prefix and the specified local name.
+ *
+ * \param[in] Name        Pointer to the name.
+ * \param[in] NameLength  Length of the name.
+ * \param[in] LocalName   The local name as string literal.
+ * \return                fmi3True if the name matches, otherwise fmi3False.
+ */
+#define FMI3_LS_BUS_XML_EQUALS_QUALIFIED(Name, NameLength, LocalName)                                     \
+    (((NameLength) > sizeof(LocalName) &&                                                                 \
+      (Name)[(NameLength) - sizeof(LocalName)] == ':' &&                                                  \
+      memcmp((Name) + (NameLength) - (sizeof(LocalName) - 1), (LocalName), sizeof(LocalName) - 1) == 0) ? \
+        fmi3True : fmi3False)
+
+/**
+ * \brief Checks whether the name of the current element is equal to the specified string literal.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ * \param[in] Name    The element name as string literal.
+ */
+#define FMI3_LS_BUS_XML_ELEMENT_IS(Reader, Name)                       \
+    FMI3_LS_BUS_XML_EQUALS((Reader)->name, (Reader)->nameLength, Name)
+
+/**
+ * \brief Checks whether the name of the current attribute is equal to the specified string literal.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ * \param[in] Name    The attribute name as string literal.
+ */
+#define FMI3_LS_BUS_XML_ATTRIBUTE_IS(Reader, Name)                                       \
+    FMI3_LS_BUS_XML_EQUALS((Reader)->attributeName, (Reader)->attributeNameLength, Name)
+
+/**
+ * \brief Checks whether the value of the current attribute is equal to the specified string literal.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ * \param[in] Value   The attribute value as string literal.
+ */
+#define FMI3_LS_BUS_XML_ATTRIBUTE_VALUE_IS(Reader, Value)                                   \
+    FMI3_LS_BUS_XML_EQUALS((Reader)->attributeValue, (Reader)->attributeValueLength, Value)
+
+/**
+ * \brief Checks whether the current attribute is a namespace declaration or belongs to the
+ *  XML Schema instance namespace (prefix `xsi`). Such attributes are allowed on every element.
+ *
+ * \param[in] Reader  Pointer to variable of type \ref fmi3LsBusUtilXmlReader.
+ */
+#define FMI3_LS_BUS_XML_ATTRIBUTE_IS_SCHEMA_INFO(Reader)                                          \
+    ((FMI3_LS_BUS_XML_ATTRIBUTE_IS((Reader), "xmlns") ||                                          \
+      ((Reader)->attributeNameLength > 6 && memcmp((Reader)->attributeName, "xmlns:", 6) == 0) || \
+      ((Reader)->attributeNameLength > 4 && memcmp((Reader)->attributeName, "xsi:", 4) == 0)) ?   \
+        fmi3True : fmi3False)
+
+#ifdef __cplusplus
+} /* end of extern "C" { */
+#endif
+
+#endif /* fmi3LsBusUtilXml_h */
@@ -1,6 +1,13 @@
 #include "fmi3LsBusCan.h"
 #include "fmi3LsBusUtil.h"
 #include "fmi3LsBusUtilCan.h"
+#include "fmi3LsBusUtilCan.hpp"
+#include "fmi3LsBusUtilCanFault.h"
+#include "fmi3LsBusUtilCanTelemetry.h"
+#include "fmi3LsBusUtilInject.h"
+#include "fmi3LsBusUtilOnChange.h"
+#include "fmi3LsBusUtilSignalCan.h"
+#include "fmi3LsBusUtilTxTracker.h"
 #include <iostream>
 
 
@@ -1,6 +1,15 @@
 #include "fmi3LsBusFlexRay.h"
 #include "fmi3LsBusUtil.h"
 #include "fmi3LsBusUtilFlexRay.h"
+#include "fmi3LsBusUtilFlexRayAnalyzer.h"
+#include "fmi3LsBusUtilFlexRayBoundary.h"
+#include "fmi3LsBusUtilFlexRayDynamic.h"
+#include "fmi3LsBusUtilFlexRayMerge.h"
+#include "fmi3LsBusUtilFlexRayPending.h"
+#include "fmi3LsBusUtilFlexRayTiming.h"
+#include "fmi3LsBusUtilInject.h"
+#include "fmi3LsBusUtilOnChange.h"
+#include "fmi3LsBusUtilTxTracker.h"
 #include <iostream>
 
 /**
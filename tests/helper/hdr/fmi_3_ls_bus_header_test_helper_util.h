@@ -0,0 +1,66 @@
+#include "fmi3LsBus.h"
+#include "fmi3LsBusUtil.h"
+#include "fmi3LsBusUtilBridge.h"
+#include "fmi3LsBusUtilCan.h"
+#include "fmi3LsBusUtilCan.hpp"
+#include "fmi3LsBusUtilCodec.h"
+#include "fmi3LsBusUtilDispatch.h"
+#include "fmi3LsBusUtilManifest.h"
+#include "fmi3LsBusUtilScheduler.h"
+#include "fmi3LsBusUtilShared.h"
+#include "fmi3LsBusUtilSignal.h"
+#include "fmi3LsBusUtilTerminals.h"
+#include <string>
+
+/**
+ * \brief Manifest file content as provided by the example 'fmi_ls_bus_manifest_example.xml'.
+ */
+extern const std::string ManifestExample;
+
+/**
+ * \brief Parses the given manifest file content.
+ *
+ * \param[in]  xml       The content of the manifest file.
+ * \param[out] manifest  The parsed manifest.
+ * \return               The validation result returned by the parsing macro.
+ */
+fmi3Boolean ParseManifest(const std::string& xml, fmi3LsBusUtilManifest* manifest);
+
+/**
+ * \brief Returns the example manifest file content with the value of the given attribute replaced.
+ *
+ * \param[in] attribute  The name of the attribute as written in the example (e.g. 'isBusSimulationFMU').
+ * \param[in] value      The new attribute value.
+ */
+std::string ReplaceManifestAttribute(const std::string& attribute, const std::string& value);
+
+/**
+ * \brief Terminals and icons file content as provided by the example 'X_network4FMI_terminalsAndIcons_lowCut.xml'.
+ */
+extern const std::string TerminalsExample;
+
+/**
+ * \brief Model description file content as provided by the example 'X_network4FMI_modelDescription_lowCut.xml'.
+ */
+extern const std::string ModelDescriptionExample;
+
+/**
+ * \brief Reads the Bus Terminals from the given terminals and icons file content.
+ *
+ * \param[in]  xml        The content of the terminals and icons file.
+ * \param[out] terminals  The Bus Terminals read.
+ * \param[in]  capacity   The number of elements of 'terminals'.
+ * \param[out] count      The number of Bus Terminals read.
+ * \return                The result returned by the reading macro.
+ */
+fmi3Boolean ReadTerminals(const std::string& xml, fmi3LsBusUtilBusTerminal* terminals, size_t capacity, size_t* count);
+
+/**
+ * \brief Resolves the value references of the Bus Terminals using the given model description file content.
+ *
+ * \param[in]     xml        The content of the model description file.
+ * \param[in,out] terminals  The Bus Terminals to resolve.
+ * \param[in]     count      The number of Bus Terminals.
+ * \return                   The result returned by the resolving macro.
+ */
+fmi3Boolean ResolveTerminals(const std::string& xml, fmi3LsBusUtilBusTerminal* terminals, size_t count);
@@ -0,0 +1,93 @@
+#include "fmi_3_ls_bus_header_test_helper_util.h"
+#include <gtest/gtest.h>
+
+const std::string ManifestExample =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<fmiLayeredStandardManifest\n"
+	"    xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\"\n"
+	"    xsi:noNamespaceSchemaLocation=\"../../schema/fmi3LayeredStandardBusManifest.xsd\"\n"
+	"    xmlns:fmi-ls=\"http://fmi-standard.org/fmi-ls-manifest\"\n"
+	"    fmi-ls:fmi-ls-name=\"org.fmi-standard.fmi-ls-bus\"\n"
+	"    fmi-ls:fmi-ls-version=\"1.1.0-alpha.1\"\n"
+	"    fmi-ls:fmi-ls-description=\"Layered Standard for the simulation of bus communication on a Physical Signal Abstraction or Network Abstraction based level.\"\n"
+	"    isBusSimulationFMU=\"false\"/>";
+
+fmi3Boolean ParseManifest(const std::string& xml, fmi3LsBusUtilManifest* manifest)
+{
+	fmi3Boolean status;
+
+	FMI3_LS_BUS_MANIFEST_PARSE(manifest, xml.c_str(), xml.size(), 0x1234, status);
+
+	return status;
+}
+
+std::string ReplaceManifestAttribute(const std::string& attribute, const std::string& value)
+{
+	std::string xml = ManifestExample;
+
+	// Replace the value enclosed in quotes behind the attribute name.
+	size_t valueStart = xml.find(attribute + "=\"") + attribute.size() + 2;
+	size_t valueEnd = xml.find('"', valueStart);
+	xml.replace(valueStart, valueEnd - valueStart, value);
+
+	return xml;
+}
+
+const std::string TerminalsExample =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<fmiTerminalsAndIcons fmiVersion=\"3.0\">\n"
+	"  <Terminals>\n"
+	"    <Terminal terminalKind=\"org.fmi-ls-bus.network-terminal\" name=\"Powertrain\" matchingRule=\"org.fmi-ls-bus.transceiver\"\n"
+	"        description=\"Powertrain CAN Bus Terminal definition\">\n"
+	"      <TerminalMemberVariable variableKind=\"signal\"\n"
+	"        variableName=\"Powertrain.Rx_Clock\" memberName=\"Rx_Clock\" />\n"
+	"      <TerminalMemberVariable variableKind=\"signal\"\n"
+	"        variableName=\"Powertrain.Rx_Data\" memberName=\"Rx_Data\" />\n"
+	"      <TerminalMemberVariable variableKind=\"signal\"\n"
+	"        variableName=\"Powertrain.Tx_Clock\" memberName=\"Tx_Clock\" />\n"
+	"      <TerminalMemberVariable variableKind=\"signal\"\n"
+	"        variableName=\"Powertrain.Tx_Data\" memberName=\"Tx_Data\" />\n"
+	"      <Terminal terminalKind=\"org.fmi-ls-bus.configuration\" name=\"Configuration\" matchingRule=\"bus\">\n"
+	"        <TerminalMemberVariable variableKind=\"signal\"\n"
+	"          variableName=\"BusNotification\" memberName=\"BusNotification\" />\n"
+	"      </Terminal>\n"
+	"    </Terminal>\n"
+	"  </Terminals>\n"
+	"</fmiTerminalsAndIcons>\n";
+
+const std::string ModelDescriptionExample =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<fmiModelDescription fmiVersion=\"3.0\" modelName=\"Network4FMI\"\n"
+	"    instantiationToken=\"Network4FMI\">\n"
+	"  <ModelVariables>\n"
+	"    <Clock name=\"Powertrain.Rx_Clock\" valueReference=\"1002\"\n"
+	"        causality=\"input\" variability=\"discrete\" intervalVariability=\"triggered\"/>\n"
+	"    <Binary name=\"Powertrain.Rx_Data\" valueReference=\"1001\" causality=\"input\"\n"
+	"        mimeType=\"application/org.fmi-standard.fmi-ls-bus.can; version=&quot;1.0.0-rc.1&quot;\" variability=\"discrete\" clocks=\"1002\"/>\n"
+	"    <Clock name=\"Powertrain.Tx_Clock\" valueReference=\"1004\"\n"
+	"        causality=\"input\" variability=\"discrete\" intervalVariability=\"changing\"/>\n"
+	"    <Binary name=\"Powertrain.Tx_Data\" valueReference=\"1003\" causality=\"output\"\n"
+	"        mimeType=\"application/org.fmi-standard.fmi-ls-bus.can; version=&quot;1.0.0-rc.1&quot;\" variability=\"discrete\" clocks=\"1004\"/>\n"
+	"    <Boolean name=\"BusNotification\" valueReference=\"1005\" causality=\"parameter\" variability=\"fixed\" start=\"false\"/>\n"
+	"  </ModelVariables>\n"
+	"  <ModelStructure>\n"
+	"  </ModelStructure>\n"
+	"</fmiModelDescription>\n";
+
+fmi3Boolean ReadTerminals(const std::string& xml, fmi3LsBusUtilBusTerminal* terminals, size_t capacity, size_t* count)
+{
+	fmi3Boolean status;
+
+	FMI3_LS_BUS_TERMINALS_READ(xml.c_str(), xml.size(), terminals, capacity, *count, status);
+
+	return status;
+}
+
+fmi3Boolean ResolveTerminals(const std::string& xml, fmi3LsBusUtilBusTerminal* terminals, size_t count)
+{
+	fmi3Boolean status;
+
+	FMI3_LS_BUS_TERMINALS_RESOLVE(xml.c_str(), xml.size(), terminals, count, status);
+
+	return status;
+}
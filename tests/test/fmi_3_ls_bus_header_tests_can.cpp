@@ -1324,3 +1324,841 @@ TEST(Fmi3LsBusCombinationTest, resetBuffer) {
 	FMI3_LS_BUS_BUFFER_INFO_RESET(&secondBufferInfo);
 	EXPECT_EQ(secondBufferInfo.readPos, secondBufferInfo.writePos);
 }
+
+/**
+ * \brief Test for the C++ transmit functions creating the same operations as the macros.
+ */
+TEST(Fmi3LsBusCanTemplates, identicalToMacros) {
+
+	fmi3LsBusUtilBufferInfo macroBufferInfo;
+	fmi3LsBusUtilBufferInfo templateBufferInfo;
+	fmi3UInt8 macroData[256];
+	fmi3UInt8 templateData[256];
+	fmi3UInt8 data[64];
+
+	for (size_t i = 0; i < sizeof(data); i++)
+	{
+		data[i] = (fmi3UInt8)i;
+	}
+	memset(macroData, 0, sizeof(macroData));
+	memset(templateData, 0, sizeof(templateData));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&macroBufferInfo, macroData, sizeof(macroData));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&templateBufferInfo, templateData, sizeof(templateData));
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&macroBufferInfo, 0x123, 0, 1, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&macroBufferInfo, 0x7FF, 1, 0, 0, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT(&macroBufferInfo, 0x456, 1, 1, 0, 64, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_XL_TRANSMIT(&macroBufferInfo, 0x789, 0, 1, 2, 3, 4, 12, data);
+
+	fmi3LsBusUtil::CanCreateOpCanTransmit<8>(&templateBufferInfo, 0x123, 0, 1, data);
+	fmi3LsBusUtil::CanCreateOpCanTransmit<0>(&templateBufferInfo, 0x7FF, 1, 0, data);
+	fmi3LsBusUtil::CanCreateOpCanFdTransmit<64>(&templateBufferInfo, 0x456, 1, 1, 0, data);
+	fmi3LsBusUtil::CanCreateOpCanXlTransmit<12>(&templateBufferInfo, 0x789, 0, 1, 2, 3, 4, data);
+
+	EXPECT_EQ(templateBufferInfo.status, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&templateBufferInfo), FMI3_LS_BUS_BUFFER_LENGTH(&macroBufferInfo));
+	EXPECT_EQ(memcmp(macroData, templateData, sizeof(macroData)), 0);
+}
+
+/**
+ * \brief Test for the C++ transmit functions with insufficient buffer space.
+ */
+TEST(Fmi3LsBusCanTemplates, bufferOverflow) {
+
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3UInt8 txData[20];
+	fmi3UInt8 data[] = { 'A', 'B', 'C', 'D', 'A', 'B', 'C', 'D' };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, txData, sizeof(txData));
+
+	fmi3LsBusUtil::CanCreateOpCanTransmit<2>(&bufferInfo, 0x123, 0, 0, data);
+	EXPECT_EQ(bufferInfo.status, fmi3True);
+	fmi3LsBusUtil::CanCreateOpCanTransmit<8>(&bufferInfo, 0x123, 0, 0, data);
+	EXPECT_EQ(bufferInfo.status, fmi3False);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfo), 18);
+}
+
+/**
+ * \brief Test for the little-endian byte order of created operations.
+ */
+TEST(Fmi3LsBusCanByteOrder, littleEndian) {
+
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3UInt8 txData[64];
+	fmi3UInt8 data[] = { 'A', 'B' };
+	const fmi3UInt8 expected[] = { 0x10, 0x00, 0x00, 0x00,    /* opCode */
+	                               0x12, 0x00, 0x00, 0x00,    /* length */
+	                               0x78, 0x56, 0x34, 0x12,    /* id */
+	                               0x01, 0x00,                /* ide, rtr */
+	                               0x02, 0x00,                /* dataLength */
+	                               'A', 'B' };
+	fmi3LsBusCanOperationCanTransmit* operation;
+	fmi3LsBusOperationHeader* operationHeader;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, txData, sizeof(txData));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x12345678, 1, 0, sizeof(data), data);
+
+	ASSERT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfo), sizeof(expected));
+	EXPECT_EQ(memcmp(txData, expected, sizeof(expected)), 0);
+
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operationHeader)), fmi3True);
+	operation = (fmi3LsBusCanOperationCanTransmit*)operationHeader;
+	EXPECT_EQ(FMI3_LS_BUS_GET_LE(operation->id), 0x12345678u);
+	EXPECT_EQ(FMI3_LS_BUS_GET_LE(operation->dataLength), 2u);
+}
+
+/**
+ * \brief Test for reading operations from addresses that are not aligned.
+ */
+TEST(Fmi3LsBusCanByteOrder, unalignedRead) {
+
+	fmi3UInt8 rxData[64];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operationHeader;
+	size_t readPos = 0;
+
+	// Place the operation at an odd address.
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, rxData + 1, sizeof(rxData) - 1);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x7FF);
+	FMI3_LS_BUS_CAN_CREATE_OP_WAKEUP(&bufferInfo);
+
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION_DIRECT(rxData + 1, (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfo), readPos, operationHeader)), fmi3True);
+	EXPECT_EQ(readPos, 12u);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION_DIRECT(rxData + 1, (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfo), readPos, operationHeader)), fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_GET_LE(operationHeader->opCode), FMI3_LS_BUS_CAN_OP_WAKEUP);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION_DIRECT(rxData + 1, (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfo), readPos, operationHeader)), fmi3False);
+}
+
+/**
+ * \brief Test for the telemetry collected from the operations of a bus simulation.
+ */
+TEST(Fmi3LsBusCanTelemetry, observe) {
+
+	fmi3UInt8 buffer[256];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 0 };
+	fmi3UInt64 times[] = { 0, 0, 1000, 500000, 1000000, 1000000 };
+	static fmi3LsBusUtilCanTelemetry telemetry;
+	size_t i = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIGURATION_CAN_BAUDRATE(&bufferInfo, 500000);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x100);
+	FMI3_LS_BUS_CAN_CREATE_OP_ARBITRATION_LOST(&bufferInfo, 0x100);
+	FMI3_LS_BUS_CAN_CREATE_OP_STATUS(&bufferInfo, FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x100);
+
+	FMI3_LS_BUS_CAN_TELEMETRY_INIT(&telemetry);
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(&telemetry, operation, times[i++]);
+	}
+
+	EXPECT_EQ(telemetry.baudrate, 500000u);
+	EXPECT_EQ(telemetry.frames, 2u);
+	EXPECT_EQ(telemetry.busyBits, 2u * FMI3_LS_BUS_CAN_TELEMETRY_FRAME_BITS(0, 0, 8));
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_CAN_TELEMETRY_UTILIZATION(&telemetry), 222.0 / 500.0);
+	EXPECT_EQ(telemetry.arbitrationLost, 1u);
+	EXPECT_EQ(telemetry.statusTransitions[FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE], 1u);
+
+	/* Only the first confirmation has a pending transmit operation */
+	EXPECT_EQ(telemetry.latencyCount, 1u);
+	EXPECT_EQ(telemetry.latency[35], 1u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_LIMIT(34), 895u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_TELEMETRY_BUCKET_LIMIT(35), 1023u);
+}
+
+/**
+ * \brief Test for merging telemetry variables and the Prometheus text format.
+ */
+TEST(Fmi3LsBusCanTelemetry, mergeAndFormat) {
+
+	fmi3LsBusCanOperationCanTransmit transmit = {};
+	fmi3LsBusCanOperationConfirm confirm = {};
+	static fmi3LsBusUtilCanTelemetry telemetry[2];
+	char text[4096];
+	size_t length;
+
+	transmit.header.opCode = FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT;
+	transmit.header.length = sizeof(transmit);
+	confirm.header.opCode = FMI3_LS_BUS_CAN_OP_CONFIRM;
+	confirm.header.length = sizeof(confirm);
+
+	for (fmi3UInt32 thread = 0; thread < 2; thread++) {
+		FMI3_LS_BUS_CAN_TELEMETRY_INIT(&telemetry[thread]);
+		transmit.id = confirm.id = 0x10 + thread;
+		FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(&telemetry[thread], &transmit, 1000 * thread);
+		FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(&telemetry[thread], &confirm, 1000 * thread + 2);
+	}
+	FMI3_LS_BUS_CAN_TELEMETRY_MERGE(&telemetry[0], &telemetry[1]);
+	EXPECT_EQ(telemetry[0].frames, 2u);
+
+	/* Bus Error operations with an unknown error code */
+	fmi3UInt8 buffer[64];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_BUS_ERROR(&bufferInfo, 0x10, 9, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_PRIMARY_ERROR_FLAG, FMI3_LS_BUS_FALSE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_CAN_TELEMETRY_OBSERVE(&telemetry[0], operation, 1002);
+	EXPECT_EQ(telemetry[0].latency[2], 2u);
+	EXPECT_EQ(telemetry[0].startTime, 0u);
+	EXPECT_EQ(telemetry[0].endTime, 1002u);
+
+	FMI3_LS_BUS_CAN_TELEMETRY_FORMAT_PROMETHEUS(&telemetry[0], "body", text, sizeof(text), length);
+	EXPECT_EQ(length, strlen(text));
+	std::string output(text);
+	EXPECT_NE(output.find("fmi3_ls_bus_can_frames_total{bus=\"body\"} 2\n"), std::string::npos);
+	EXPECT_NE(output.find("fmi3_ls_bus_can_id_frames_total{bus=\"body\",id=\"0x11\"} 1\n"), std::string::npos);
+	EXPECT_NE(output.find("fmi3_ls_bus_can_latency_seconds_bucket{bus=\"body\",le=\"2e-09\"} 2\n"), std::string::npos);
+	EXPECT_NE(output.find("fmi3_ls_bus_can_latency_seconds_count{bus=\"body\"} 2\n"), std::string::npos);
+	EXPECT_NE(output.find("fmi3_ls_bus_can_bus_errors_total{bus=\"body\",code=\"unknown\"} 1\n"), std::string::npos);
+
+	/* The length of the complete text is returned on truncation */
+	FMI3_LS_BUS_CAN_TELEMETRY_FORMAT_PROMETHEUS(&telemetry[0], "body", text, 16, length);
+	EXPECT_EQ(strlen(text), 15u);
+	EXPECT_EQ(length, output.size());
+}
+
+#define FMI3_LS_BUS_TEST_SPEED_SIGNALS(X)                                       \
+	X(speed, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 0, 16, fmi3False, 0.1, 0.0)
+
+FMI3_LS_BUS_SIGNAL_DEFINE_PDU(Fmi3LsBusTestSpeedPdu, FMI3_LS_BUS_TEST_SPEED_SIGNALS)
+
+#define FMI3_LS_BUS_TEST_STATUS_SIGNALS(X)                                      \
+	X(counter, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 64, 32, fmi3False, 1.0, 0.0)    \
+	X(mode, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 7, 4, fmi3False, 1.0, 0.0)
+
+FMI3_LS_BUS_SIGNAL_DEFINE_PDU(Fmi3LsBusTestStatusPdu, FMI3_LS_BUS_TEST_STATUS_SIGNALS)
+
+/**
+ * \brief Test for transmitting only frames with changed signals.
+ */
+TEST(Fmi3LsBusSignalCan, transmitChanged) {
+
+	fmi3UInt8 buffer[256];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	Fmi3LsBusTestSpeedPdu speed = { 12.3 };
+	Fmi3LsBusTestStatusPdu status = { 7.0, 5.0 };
+	fmi3LsBusUtilSignalCanFrame frames[2];
+	fmi3UInt32 dirty[FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS(2)];
+	fmi3LsBusUtilSignalCan converter;
+	size_t count;
+
+	FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[0], 0x100, FMI3_LS_BUS_FALSE, fmi3False, 8, Fmi3LsBusTestSpeedPdu, &speed);
+	FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[1], 0x200, FMI3_LS_BUS_TRUE, fmi3True, 16, Fmi3LsBusTestStatusPdu, &status);
+	FMI3_LS_BUS_SIGNAL_CAN_INIT(&converter, frames, 2, dirty);
+	EXPECT_TRUE(FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(&converter, 0));
+	EXPECT_TRUE(FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(&converter, 1));
+	EXPECT_EQ(dirty[0], 3u);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+	EXPECT_EQ(bufferInfo.status, fmi3True);
+	EXPECT_EQ(count, 2u);
+
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	ASSERT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT);
+	fmi3LsBusCanOperationCanTransmit* transmit = (fmi3LsBusCanOperationCanTransmit*)operation;
+	EXPECT_EQ(transmit->id, 0x100u);
+	EXPECT_EQ(transmit->dataLength, 8u);
+	EXPECT_EQ(transmit->data[0], 123);
+
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	ASSERT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT);
+	fmi3LsBusCanOperationCanFdTransmit* fdTransmit = (fmi3LsBusCanOperationCanFdTransmit*)operation;
+	EXPECT_EQ(fdTransmit->id, 0x200u);
+	EXPECT_EQ(fdTransmit->ide, FMI3_LS_BUS_TRUE);
+	EXPECT_EQ(fdTransmit->brs, FMI3_LS_BUS_TRUE);
+	EXPECT_EQ(fdTransmit->dataLength, 16u);
+	EXPECT_EQ(fdTransmit->data[0], 0x50);
+	EXPECT_EQ(fdTransmit->data[8], 7);
+
+	/* Unchanged frames are neither packed nor transmitted */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+	speed.speed = 99.9;
+	FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+	EXPECT_EQ(count, 0u);
+	EXPECT_EQ(frames[0].data[0], 123);
+
+	status.counter = 8.0;
+	FMI3_LS_BUS_SIGNAL_CAN_MARK_DIRTY(&converter, 1);
+	FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+	EXPECT_EQ(count, 1u);
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CANFD_TRANSMIT);
+	EXPECT_FALSE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+}
+
+/**
+ * \brief Test for keeping frames marked as changed if the buffer is full.
+ */
+TEST(Fmi3LsBusSignalCan, bufferFull) {
+
+	fmi3UInt8 buffer[40];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	Fmi3LsBusTestSpeedPdu speed = { 1.0 };
+	fmi3LsBusUtilSignalCanFrame frames[40];
+	fmi3UInt32 dirty[FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS(40)];
+	fmi3LsBusUtilSignalCan converter;
+	size_t count;
+
+	for (fmi3UInt32 i = 0; i < 40; i++) {
+		FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[i], 0x10 + i, FMI3_LS_BUS_FALSE, fmi3False, 8, Fmi3LsBusTestSpeedPdu, &speed);
+	}
+	FMI3_LS_BUS_SIGNAL_CAN_INIT(&converter, frames, 40, dirty);
+	EXPECT_EQ(dirty[1], 0xFFu);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+	EXPECT_EQ(bufferInfo.status, fmi3False);
+	EXPECT_EQ(count, 1u);
+	EXPECT_FALSE(FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(&converter, 0));
+	EXPECT_TRUE(FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(&converter, 1));
+	EXPECT_TRUE(FMI3_LS_BUS_SIGNAL_CAN_IS_DIRTY(&converter, 39));
+
+	for (int i = 0; i < 39; i++) {
+		FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+		FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+		EXPECT_EQ(count, 1u);
+	}
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+	FMI3_LS_BUS_SIGNAL_CAN_TRANSMIT(&converter, &bufferInfo, count);
+	EXPECT_EQ(bufferInfo.status, fmi3True);
+	EXPECT_EQ(count, 0u);
+}
+
+/**
+ * \brief Test for unpacking the signals of received operations.
+ */
+TEST(Fmi3LsBusSignalCan, receive) {
+
+	fmi3UInt8 buffer[256];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 speedData[2] = { 0xE8, 0x03 };
+	fmi3UInt8 statusData[12] = { 0x30, 0, 0, 0, 0, 0, 0, 0, 0x2A, 0, 0, 0 };
+	Fmi3LsBusTestSpeedPdu speed = { 0.0 };
+	Fmi3LsBusTestStatusPdu status = { 0.0, 0.0 };
+	fmi3LsBusUtilSignalCanFrame frames[2];
+	fmi3UInt32 dirty[FMI3_LS_BUS_SIGNAL_CAN_DIRTY_WORDS(2)];
+	fmi3LsBusUtilSignalCan converter;
+	fmi3LsBusUtilSignalCanFrame* frame;
+
+	FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[0], 0x100, FMI3_LS_BUS_FALSE, fmi3False, 8, Fmi3LsBusTestSpeedPdu, &speed);
+	FMI3_LS_BUS_SIGNAL_CAN_FRAME_INIT(&frames[1], 0x200, FMI3_LS_BUS_FALSE, fmi3True, 16, Fmi3LsBusTestStatusPdu, &status);
+	FMI3_LS_BUS_SIGNAL_CAN_INIT(&converter, frames, 2, dirty);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(speedData), speedData);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT(&bufferInfo, 0x200, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, sizeof(statusData), statusData);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x150, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(speedData), speedData);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x100);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x100, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, sizeof(speedData), speedData);
+
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, &frames[0]);
+	EXPECT_DOUBLE_EQ(speed.speed, 100.0);
+
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, &frames[1]);
+	EXPECT_DOUBLE_EQ(status.counter, 42.0);
+	EXPECT_DOUBLE_EQ(status.mode, 3.0);
+
+	/* Unknown IDs and other operations are ignored */
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, nullptr);
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, nullptr);
+
+	/* An extended ID with the same value as a standard frame is not matched */
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)));
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, nullptr);
+
+	/* Operations shorter than their fixed part or data length are ignored */
+	speed.speed = 0.0;
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(speedData), speedData);
+	operation = (fmi3LsBusOperationHeader*)buffer;
+	operation->length = sizeof(fmi3LsBusCanOperationCanTransmit) + 1;
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, nullptr);
+	operation->length = sizeof(fmi3LsBusOperationHeader);
+	FMI3_LS_BUS_SIGNAL_CAN_RECEIVE(&converter, operation, frame);
+	EXPECT_EQ(frame, nullptr);
+	EXPECT_DOUBLE_EQ(speed.speed, 0.0);
+}
+
+/**
+ * \brief Test for suppressing CAN transmit operations with unchanged payload.
+ */
+TEST(Fmi3LsBusOnChange, canTransmit) {
+
+	fmi3UInt8 buffer[256];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	fmi3UInt8 fdData[12] = { 0 };
+	fmi3LsBusUtilOnChangeEntry entries[16];
+	fmi3LsBusUtilOnChange filter;
+	size_t count = 0;
+
+	FMI3_LS_BUS_ON_CHANGE_INIT(&filter, entries, 16, 0);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	EXPECT_EQ(bufferInfo.status, fmi3True);
+
+	/* Same ID with extended identifier, shorter payload and changed payload are different */
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 7, data);
+	data[7] = 9;
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+
+	FMI3_LS_BUS_ON_CHANGE_CAN_FD_TRANSMIT(&filter, &bufferInfo, 0x200, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, 12, fdData);
+	FMI3_LS_BUS_ON_CHANGE_CAN_FD_TRANSMIT(&filter, &bufferInfo, 0x200, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, 12, fdData);
+
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		EXPECT_NE(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+		count++;
+	}
+	EXPECT_EQ(count, 5u);
+	EXPECT_EQ(filter.submitted, 5u);
+	EXPECT_EQ(filter.suppressed, 3u);
+}
+
+/**
+ * \brief Test for limiting consecutive suppressed transmissions and for a full buffer.
+ */
+TEST(Fmi3LsBusOnChange, maxSuppressedAndBufferFull) {
+
+	fmi3UInt8 buffer[24];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3UInt8 data[8] = { 0 };
+	fmi3LsBusUtilOnChangeEntry entries[4];
+	fmi3LsBusUtilOnChange filter;
+
+	FMI3_LS_BUS_ON_CHANGE_INIT(&filter, entries, 4, 2);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+
+	/* Every third unchanged transmission is submitted */
+	for (int i = 0; i < 7; i++) {
+		FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+		FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x10, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+		EXPECT_EQ(bufferInfo.writePos != bufferInfo.start, i % 3 == 0);
+	}
+
+	/* A payload not fitting into the buffer is not recorded as submitted */
+	data[0] = 1;
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x10, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	EXPECT_EQ(bufferInfo.status, fmi3False);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x10, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	EXPECT_EQ(bufferInfo.status, fmi3True);
+	EXPECT_NE(bufferInfo.writePos, bufferInfo.start);
+
+	/* Frames not fitting into the table are never suppressed */
+	for (fmi3UInt32 id = 0x20; id < 0x28; id++) {
+		FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+		FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, id, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	}
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+	FMI3_LS_BUS_ON_CHANGE_CAN_TRANSMIT(&filter, &bufferInfo, 0x27, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	EXPECT_NE(bufferInfo.writePos, bufferInfo.start);
+}
+
+/**
+ * \brief Test for the CAN node state transitions of a transmitting node.
+ */
+TEST(Fmi3LsBusCanFault, transitions) {
+
+	fmi3UInt8 buffer[256];
+	fmi3UInt8 rxBuffer[64];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusUtilBufferInfo rxBufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt16 tec[2];
+	fmi3UInt8 rec[2];
+	fmi3LsBusCanStatusKind states[2];
+	fmi3LsBusUtilCanFault fault;
+
+	FMI3_LS_BUS_CAN_FAULT_INIT(&fault, tec, rec, states, 2);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_BUS_ERROR(&rxBufferInfo, 0x100, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_BIT_ERROR,
+		FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_PRIMARY_ERROR_FLAG, FMI3_LS_BUS_TRUE);
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)));
+
+	/* 16 errors lead to TEC 128 and ERROR_PASSIVE */
+	for (int i = 0; i < 16; i++) {
+		FMI3_LS_BUS_CAN_FAULT_BUS_ERROR(&fault, 0, operation, &bufferInfo);
+	}
+	EXPECT_EQ(tec[0], 128u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 1), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE);
+
+	FMI3_LS_BUS_CAN_FAULT_TRANSMIT_SUCCESS(&fault, 0, &bufferInfo);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE);
+	FMI3_LS_BUS_CAN_FAULT_TRANSMIT_SUCCESS(&fault, 0, &bufferInfo);
+
+	/* 17 more errors lead to TEC 262 and BUS_OFF, further errors are ignored */
+	for (int i = 0; i < 20; i++) {
+		FMI3_LS_BUS_CAN_FAULT_BUS_ERROR(&fault, 0, operation, &bufferInfo);
+	}
+	EXPECT_EQ(tec[0], 262u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF);
+	EXPECT_EQ(fault.busErrors, 33u);
+
+	FMI3_LS_BUS_CAN_FAULT_RECOVER(&fault, 0, &bufferInfo);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE);
+	EXPECT_EQ(fault.transitions, 5u);
+
+	/* Status operations are only created on state changes */
+	fmi3LsBusCanStatusKind expected[] = { FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE,
+		FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE, FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE,
+		FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_BUS_OFF, FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE };
+	size_t count = 0;
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		ASSERT_LT(count, sizeof(expected) / sizeof(expected[0]));
+		EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_STATUS);
+		EXPECT_EQ(((fmi3LsBusCanOperationStatus*)operation)->status, expected[count++]);
+	}
+	EXPECT_EQ(count, 5u);
+}
+
+/**
+ * \brief Test for applying bus errors to many receiving nodes.
+ */
+TEST(Fmi3LsBusCanFault, receivers) {
+
+	const size_t nodeCount = 1000;
+	std::vector<fmi3UInt16> tec(nodeCount);
+	std::vector<fmi3UInt8> rec(nodeCount);
+	std::vector<fmi3LsBusCanStatusKind> states(nodeCount);
+	std::vector<fmi3UInt8> buffers(nodeCount * 16);
+	std::vector<fmi3LsBusUtilBufferInfo> bufferInfos(nodeCount);
+	fmi3LsBusUtilCanFault fault;
+
+	FMI3_LS_BUS_CAN_FAULT_INIT(&fault, tec.data(), rec.data(), states.data(), nodeCount);
+	for (size_t i = 0; i < nodeCount; i++) {
+		FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfos[i], &buffers[i * 16], 16);
+	}
+
+	/* ACK errors of an ERROR_PASSIVE sender do not increase its TEC */
+	for (int i = 0; i < 300; i++) {
+		FMI3_LS_BUS_CAN_FAULT_BUS_ERROR_ALL(&fault, 7, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_ACK_ERROR, bufferInfos.data());
+	}
+	EXPECT_EQ(tec[7], 128u);
+	EXPECT_EQ(rec[7], 0u);
+	EXPECT_EQ(rec[0], 255u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_PASSIVE);
+	EXPECT_EQ(fault.transitions, nodeCount);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&bufferInfos[999]), 9);
+
+	/* A successful reception sets a REC above 127 to 127 */
+	FMI3_LS_BUS_CAN_FAULT_RECEIVE_SUCCESS(&fault, 0, NULL);
+	EXPECT_EQ(rec[0], 127u);
+	EXPECT_EQ(FMI3_LS_BUS_CAN_FAULT_STATE(&fault, 0), FMI3_LS_BUS_CAN_STATUS_PARAM_STATUS_KIND_ERROR_ACTIVE);
+}
+
+/**
+ * \brief Test for replacing CAN transmit operations with bus errors.
+ */
+TEST(Fmi3LsBusInject, can) {
+
+	fmi3UInt8 in[512];
+	fmi3UInt8 out[512];
+	fmi3UInt8 sender[256];
+	fmi3LsBusUtilBufferInfo inInfo;
+	fmi3LsBusUtilBufferInfo outInfo;
+	fmi3LsBusUtilBufferInfo senderInfo;
+	fmi3LsBusUtilInjectRule rules[2];
+	fmi3LsBusUtilInjector injector;
+	const fmi3UInt8 data[4] = { 1, 2, 3, 4 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&outInfo, out, sizeof(out));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&senderInfo, sender, sizeof(sender));
+	for (fmi3UInt32 i = 0; i < 6; i++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, 0x200, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	}
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&inInfo, 0x300);
+
+	/* A burst of 3 starts with the first frame of ID 0x100, other IDs are never hit */
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rules[0], 0x100, FMI3_LS_BUS_INJECT_PROBABILITY(1.0), 3,
+	                             FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_ACK_ERROR);
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rules[1], FMI3_LS_BUS_INJECT_ANY, 0, 1,
+	                             FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_CRC_ERROR);
+	FMI3_LS_BUS_INJECT_INIT(&injector, rules, 2, 42);
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &outInfo, &senderInfo);
+	EXPECT_EQ(outInfo.status, fmi3True);
+	EXPECT_EQ(inInfo.readPos, inInfo.writePos);
+	EXPECT_EQ(injector.counter, 12u);
+	EXPECT_EQ(injector.injected, 6u);
+
+	fmi3LsBusOperationHeader* operation;
+	size_t busErrors = 0;
+	size_t transmits = 0;
+	size_t confirms = 0;
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&outInfo, operation)) {
+		if (operation->opCode == FMI3_LS_BUS_CAN_OP_BUS_ERROR) {
+			const fmi3LsBusCanOperationBusError* busError = (const fmi3LsBusCanOperationBusError*)operation;
+			EXPECT_EQ(busError->id, 0x100u);
+			EXPECT_EQ(busError->errorCode, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_ACK_ERROR);
+			EXPECT_EQ(busError->errorFlag, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_SECONDARY_ERROR_FLAG);
+			EXPECT_EQ(busError->isSender, FMI3_LS_BUS_FALSE);
+			busErrors++;
+		}
+		else if (operation->opCode == FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT) {
+			EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, 0x200u);
+			transmits++;
+		}
+		else if (operation->opCode == FMI3_LS_BUS_CAN_OP_CONFIRM) {
+			confirms++;
+		}
+	}
+	EXPECT_EQ(busErrors, 6u);
+	EXPECT_EQ(transmits, 6u);
+	EXPECT_EQ(confirms, 1u);
+
+	busErrors = 0;
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&senderInfo, operation)) {
+		ASSERT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_BUS_ERROR);
+		EXPECT_EQ(((fmi3LsBusCanOperationBusError*)operation)->errorFlag, FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_FLAG_PRIMARY_ERROR_FLAG);
+		EXPECT_EQ(((fmi3LsBusCanOperationBusError*)operation)->isSender, FMI3_LS_BUS_TRUE);
+		busErrors++;
+	}
+	EXPECT_EQ(busErrors, 6u);
+}
+
+/**
+ * \brief Test for injecting errors with a full sender buffer and an invalid operation length.
+ */
+TEST(Fmi3LsBusInject, canLimits) {
+
+	fmi3UInt8 in[256];
+	fmi3UInt8 out[256];
+	fmi3UInt8 sender[sizeof(fmi3LsBusCanOperationBusError) + 4];
+	fmi3LsBusUtilBufferInfo inInfo;
+	fmi3LsBusUtilBufferInfo outInfo;
+	fmi3LsBusUtilBufferInfo senderInfo;
+	fmi3LsBusUtilInjectRule rule;
+	fmi3LsBusUtilInjector injector;
+	fmi3LsBusOperationHeader zeroLength = { FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, 0 };
+	const fmi3UInt8 data[4] = { 1, 2, 3, 4 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&outInfo, out, sizeof(out));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&senderInfo, sender, sizeof(sender));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rule, FMI3_LS_BUS_INJECT_ANY, FMI3_LS_BUS_INJECT_PROBABILITY(1.0), 1,
+	                             FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_CRC_ERROR);
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 1);
+
+	/* The second Bus Error operation does not fit into the sender buffer, the operation stays in the input */
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &outInfo, &senderInfo);
+	EXPECT_EQ(outInfo.status, fmi3True);
+	EXPECT_EQ(senderInfo.status, fmi3False);
+	EXPECT_EQ(injector.injected, 1u);
+	EXPECT_EQ((size_t)FMI3_LS_BUS_BUFFER_LENGTH(&outInfo), sizeof(fmi3LsBusCanOperationBusError));
+	EXPECT_EQ((size_t)(inInfo.writePos - inInfo.readPos), sizeof(fmi3LsBusCanOperationCanTransmit) + sizeof(data));
+
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&senderInfo);
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &outInfo, &senderInfo);
+	EXPECT_EQ(senderInfo.status, fmi3True);
+	EXPECT_EQ(injector.injected, 2u);
+	EXPECT_EQ(inInfo.readPos, inInfo.writePos);
+
+	/* The data following an invalid operation length is discarded */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&inInfo);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&outInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&inInfo, 0x300);
+	memcpy(inInfo.writePos, &zeroLength, sizeof(zeroLength));
+	inInfo.writePos += sizeof(zeroLength);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&inInfo, 0x400);
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &outInfo, NULL);
+	EXPECT_EQ(outInfo.status, fmi3False);
+	EXPECT_EQ(inInfo.readPos, inInfo.writePos);
+	EXPECT_EQ((size_t)FMI3_LS_BUS_BUFFER_LENGTH(&outInfo), sizeof(fmi3LsBusCanOperationConfirm));
+}
+
+/**
+ * \brief Test for reproducing injected errors from the seed, also when the output buffer runs full.
+ */
+TEST(Fmi3LsBusInject, deterministic) {
+
+	fmi3UInt8 in[2048];
+	fmi3UInt8 reference[2048];
+	fmi3UInt8 out[2048];
+	fmi3UInt8 small[64];
+	size_t outLength = 0;
+	fmi3LsBusUtilBufferInfo inInfo;
+	fmi3LsBusUtilBufferInfo referenceInfo;
+	fmi3LsBusUtilBufferInfo outInfo;
+	fmi3LsBusUtilBufferInfo smallInfo;
+	fmi3LsBusUtilInjectRule rule;
+	fmi3LsBusUtilInjector injector;
+	const fmi3UInt8 data[8] = { 0 };
+
+	/* Reference run in one call */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&referenceInfo, reference, sizeof(reference));
+	for (fmi3UInt32 i = 0; i < 100; i++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, i % 8, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	}
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rule, FMI3_LS_BUS_INJECT_ANY, FMI3_LS_BUS_INJECT_PROBABILITY(0.2), 2,
+	                             FMI3_LS_BUS_CAN_BUSERROR_PARAM_ERROR_CODE_FORM_ERROR);
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 0x1234);
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &referenceInfo, NULL);
+	ASSERT_EQ(referenceInfo.status, fmi3True);
+	const fmi3UInt64 injected = injector.injected;
+	EXPECT_GT(injected, 0u);
+	EXPECT_LT(injected, 100u);
+
+	/* Same seed, but the output buffer only holds a few operations per call */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&smallInfo, small, sizeof(small));
+	for (fmi3UInt32 i = 0; i < 100; i++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, i % 8, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	}
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 0x1234);
+	do {
+		FMI3_LS_BUS_BUFFER_INFO_RESET(&smallInfo);
+		FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &smallInfo, NULL);
+		ASSERT_GT(FMI3_LS_BUS_BUFFER_LENGTH(&smallInfo), 0);
+		memcpy(out + outLength, small, (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&smallInfo));
+		outLength += (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&smallInfo);
+	} while (smallInfo.status == fmi3False);
+	EXPECT_EQ(injector.injected, injected);
+	ASSERT_EQ(outLength, (size_t)FMI3_LS_BUS_BUFFER_LENGTH(&referenceInfo));
+	EXPECT_EQ(memcmp(out, reference, outLength), 0);
+
+	/* A different seed gives a different stream */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&outInfo, out, sizeof(out));
+	for (fmi3UInt32 i = 0; i < 100; i++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&inInfo, i % 8, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	}
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 0x4321);
+	FMI3_LS_BUS_INJECT_CAN(&injector, &inInfo, &outInfo, NULL);
+	EXPECT_TRUE(FMI3_LS_BUS_BUFFER_LENGTH(&outInfo) != FMI3_LS_BUS_BUFFER_LENGTH(&referenceInfo) ||
+	            memcmp(out, reference, FMI3_LS_BUS_BUFFER_LENGTH(&referenceInfo)) != 0);
+}
+
+/**
+ * \brief Test for matching CAN Confirm operations to outstanding transmissions.
+ */
+TEST(Fmi3LsBusTxTracker, canConfirm) {
+
+	fmi3UInt8 buffer[128];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilTxTrackerEntry entries[8];
+	fmi3LsBusUtilTxTracker tracker;
+	int pdus[3] = { 0, 1, 2 };
+	void* expired[4];
+	void* context;
+	fmi3UInt64 latency;
+	size_t count;
+
+	FMI3_LS_BUS_TX_TRACKER_INIT(&tracker, entries, 8, 10000);
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, 0x100, 1000, &pdus[0]);
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, 0x200, 2000, &pdus[1]);
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, 0x300, 3000, &pdus[2]);
+	EXPECT_EQ(tracker.status, fmi3True);
+
+	// A key can only have one outstanding transmission.
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, 0x100, 4000, &pdus[0]);
+	EXPECT_EQ(tracker.status, fmi3False);
+	EXPECT_EQ(tracker.size, 3u);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x200);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x400);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_TX_TRACKER_CAN_CONFIRM(&tracker, (fmi3LsBusCanOperationConfirm*)operation, 2500, context, latency);
+	EXPECT_EQ(context, &pdus[1]);
+	EXPECT_EQ(latency, 500u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_TX_TRACKER_CAN_CONFIRM(&tracker, (fmi3LsBusCanOperationConfirm*)operation, 2600, context, latency);
+	EXPECT_EQ(tracker.status, fmi3False);
+	EXPECT_EQ(context, nullptr);
+	EXPECT_EQ(tracker.unmatched, 1u);
+
+	FMI3_LS_BUS_TX_TRACKER_CONFIRM(&tracker, 0x100, 1700, context, latency);
+	EXPECT_EQ(context, &pdus[0]);
+	EXPECT_EQ(tracker.confirms, 2u);
+	EXPECT_EQ(tracker.latencyMin, 500u);
+	EXPECT_EQ(tracker.latencyMax, 700u);
+	EXPECT_EQ(tracker.latencySum, 1200u);
+
+	FMI3_LS_BUS_TX_TRACKER_EXPIRE(&tracker, 13000, expired, 4, count);
+	EXPECT_EQ(count, 0u);
+	FMI3_LS_BUS_TX_TRACKER_EXPIRE(&tracker, 13001, expired, 4, count);
+	ASSERT_EQ(count, 1u);
+	EXPECT_EQ(expired[0], &pdus[2]);
+	EXPECT_EQ(tracker.timeouts, 1u);
+	EXPECT_EQ(tracker.size, 0u);
+}
+
+/**
+ * \brief Test for removing transmissions from a crowded tracker.
+ */
+TEST(Fmi3LsBusTxTracker, crowded) {
+
+	fmi3LsBusUtilTxTrackerEntry entries[64];
+	fmi3LsBusUtilTxTracker tracker;
+	fmi3Boolean outstanding[256] = { 0 };
+	void* expired[64];
+	void* context;
+	fmi3UInt64 latency;
+	size_t count;
+	size_t size = 0;
+	fmi3UInt32 state = 1;
+
+	FMI3_LS_BUS_TX_TRACKER_INIT(&tracker, entries, 64, 100);
+	for (fmi3UInt64 time = 0; time < 10000; time++) {
+		state = state * 1103515245U + 12345U;
+		const fmi3UInt32 id = (state >> 16) & 0xFF;
+		if (outstanding[id]) {
+			if (state & 0x100) {
+				FMI3_LS_BUS_TX_TRACKER_CONFIRM(&tracker, id, time, context, latency);
+			}
+			else {
+				FMI3_LS_BUS_TX_TRACKER_CANCEL(&tracker, id, context);
+			}
+			ASSERT_EQ(tracker.status, fmi3True);
+			EXPECT_EQ(context, &outstanding[id]);
+			outstanding[id] = fmi3False;
+			size--;
+		}
+		else {
+			FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, id, time, &outstanding[id]);
+			EXPECT_EQ(tracker.status, size + 1 < 64 ? fmi3True : fmi3False);
+			if (tracker.status) {
+				outstanding[id] = fmi3True;
+				size++;
+			}
+		}
+		ASSERT_EQ(tracker.size, size);
+	}
+
+	// All outstanding transmissions expire.
+	FMI3_LS_BUS_TX_TRACKER_EXPIRE(&tracker, 20000, expired, 64, count);
+	EXPECT_EQ(count, size);
+	EXPECT_EQ(tracker.size, 0u);
+	for (size_t i = 0; i < count; i++) {
+		EXPECT_EQ(*(fmi3Boolean*)expired[i], fmi3True);
+	}
+}
@@ -1077,4 +1077,675 @@ TEST(Fmi3LsBusFlexRayCombinationTest, resetBuffer) {
 
 	FMI3_LS_BUS_BUFFER_INFO_RESET(&secondBufferInfo);
 	EXPECT_EQ(secondBufferInfo.readPos, secondBufferInfo.writePos);
-}
\ No newline at end of file
+}
+/**
+ * \brief Test for the FlexRay analyzer with static and dynamic slots.
+ */
+TEST(Fmi3LsBusFlexRayAnalyzer, observe) {
+
+	fmi3UInt8 buffer[1024];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[16] = { 0 };
+	const fmi3UInt64 start = 1000000;
+	fmi3UInt64 times[] = { 0, start, start, start + 2300, start, start + 102500, start + 102500, start + 300000,
+		start + 5000000, start + 5002700, start + 5002700, start + 5102100, start + 5102100 };
+	fmi3LsBusUtilFlexRaySlotStatistics slots[1 + 10 + 100];
+	fmi3LsBusUtilFlexRayAnalyzer analyzer;
+	size_t i = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 2, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 20, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_START_COMMUNICATION(&bufferInfo, start);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 1, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 0, 1, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 0, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 20, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 16, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 0, 20, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 1, 1, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 1, 1, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 1, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3True, fmi3False, 0, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 1, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR(&bufferInfo, 0x05, 1, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	ASSERT_TRUE(bufferInfo.status);
+
+	FMI3_LS_BUS_FLEXRAY_ANALYZER_INIT(&analyzer, slots, sizeof(slots) / sizeof(slots[0]));
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		ASSERT_LT(i, sizeof(times) / sizeof(times[0]));
+		FMI3_LS_BUS_FLEXRAY_ANALYZER_OBSERVE(&analyzer, operation, times[i++]);
+	}
+
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(&analyzer), 2u);
+	EXPECT_EQ(analyzer.staticFrames, 3u);
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_STATIC_OCCUPANCY(&analyzer), 3.0 / 20.0);
+
+	/* 254 bits of 100 ns fit into 3 minislots of 10 us */
+	EXPECT_EQ(analyzer.minislotsUsed, 3u);
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_MINISLOT_USAGE(&analyzer), 3.0 / 200.0);
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_NULL_FRAME_RATIO(&analyzer), 1.0 / 5.0);
+
+	EXPECT_EQ(slots[1].delayCount, 2u);
+	EXPECT_EQ(slots[1].delayMin, 300u);
+	EXPECT_EQ(slots[1].delayMax, 700u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_JITTER(&slots[1]), 400u);
+	EXPECT_EQ(slots[3].delaySum, 600u);
+	EXPECT_EQ(slots[3].nullFrames, 1u);
+	EXPECT_EQ(slots[20].delayCount, 0u);
+
+	EXPECT_EQ(analyzer.busErrors[0], 1u);
+	EXPECT_EQ(analyzer.busErrors[1], 0u);
+	EXPECT_EQ(analyzer.busErrors[2], 1u);
+	EXPECT_EQ(slots[3].busErrors, 1u);
+}
+
+/**
+ * \brief Test for the FlexRay analyzer before it is configured.
+ */
+TEST(Fmi3LsBusFlexRayAnalyzer, unconfigured) {
+
+	fmi3UInt8 buffer[256];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 0 };
+	fmi3LsBusUtilFlexRaySlotStatistics slots[4];
+	fmi3LsBusUtilFlexRayAnalyzer analyzer;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 60, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 0, 60, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+
+	FMI3_LS_BUS_FLEXRAY_ANALYZER_INIT(&analyzer, slots, sizeof(slots) / sizeof(slots[0]));
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		FMI3_LS_BUS_FLEXRAY_ANALYZER_OBSERVE(&analyzer, operation, 1000);
+	}
+
+	/* Slot IDs beyond the slot statistics are only counted in total */
+	EXPECT_EQ(analyzer.transmits, 1u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_CYCLES(&analyzer), 0u);
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_STATIC_OCCUPANCY(&analyzer), 0.0);
+	EXPECT_DOUBLE_EQ(FMI3_LS_BUS_FLEXRAY_ANALYZER_MINISLOT_USAGE(&analyzer), 0.0);
+}
+
+/**
+ * \brief Test for suppressing FlexRay transmit operations with unchanged payload.
+ */
+TEST(Fmi3LsBusOnChange, flexRayTransmit) {
+
+	fmi3UInt8 buffer[512];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[16] = { 0 };
+	fmi3LsBusUtilOnChangeEntry entries[16];
+	fmi3LsBusUtilOnChange filter;
+	size_t count = 0;
+
+	FMI3_LS_BUS_ON_CHANGE_INIT(&filter, entries, 16, 0);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+
+	/* The same slot on both channels and in different cycles */
+	for (fmi3UInt8 cycle = 0; cycle < 4; cycle++) {
+		FMI3_LS_BUS_ON_CHANGE_FLEXRAY_TRANSMIT(&filter, &bufferInfo, cycle, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 16, data);
+		FMI3_LS_BUS_ON_CHANGE_FLEXRAY_TRANSMIT(&filter, &bufferInfo, cycle, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 16, data);
+		EXPECT_EQ(bufferInfo.status, fmi3True);
+	}
+
+	/* Null frames are always submitted */
+	FMI3_LS_BUS_ON_CHANGE_FLEXRAY_TRANSMIT(&filter, &bufferInfo, 4, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3True, fmi3False, 0, data);
+	FMI3_LS_BUS_ON_CHANGE_FLEXRAY_TRANSMIT(&filter, &bufferInfo, 5, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3True, fmi3False, 0, data);
+
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		EXPECT_NE(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+		count++;
+	}
+	EXPECT_EQ(count, 4u);
+	EXPECT_EQ(filter.suppressed, 6u);
+}
+
+/**
+ * \brief Test for replacing FlexRay transmit operations with bus errors.
+ */
+TEST(Fmi3LsBusInject, flexRay) {
+
+	fmi3UInt8 in[512];
+	fmi3UInt8 out[512];
+	fmi3LsBusUtilBufferInfo inInfo;
+	fmi3LsBusUtilBufferInfo outInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilInjectRule rule;
+	fmi3LsBusUtilInjector injector;
+	fmi3UInt8 data[8] = { 0 };
+	size_t busErrors = 0;
+	size_t transmits = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&outInfo, out, sizeof(out));
+	for (fmi3UInt8 cycle = 0; cycle < 4; cycle++) {
+		FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&inInfo, cycle, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+		FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&inInfo, cycle, 7, FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	}
+
+	/* Every frame in slot 7 is corrupted */
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rule, 7, FMI3_LS_BUS_INJECT_PROBABILITY(1.0), 1, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_CONTENT_ERROR);
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 1);
+	FMI3_LS_BUS_INJECT_FLEXRAY(&injector, &inInfo, &outInfo, NULL);
+	EXPECT_EQ(outInfo.status, fmi3True);
+	EXPECT_EQ(injector.injected, 4u);
+
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&outInfo, operation)) {
+		if (operation->opCode == FMI3_LS_BUS_FLEXRAY_OP_BUS_ERROR) {
+			const fmi3LsBusFlexRayOperationBusError* busError = (const fmi3LsBusFlexRayOperationBusError*)operation;
+			EXPECT_EQ(busError->errorFlags, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_CONTENT_ERROR);
+			EXPECT_EQ(busError->segmentIndicator, 7u);
+			EXPECT_EQ(busError->channel, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+			EXPECT_EQ(busError->cycleId, busErrors);
+			busErrors++;
+		}
+		else {
+			EXPECT_EQ(operation->opCode, FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT);
+			EXPECT_EQ(((fmi3LsBusFlexRayOperationTransmit*)operation)->slotId, 3u);
+			transmits++;
+		}
+	}
+	EXPECT_EQ(busErrors, 4u);
+	EXPECT_EQ(transmits, 4u);
+}
+
+/**
+ * \brief Test for injecting FlexRay errors with a full sender buffer and an invalid operation length.
+ */
+TEST(Fmi3LsBusInject, flexRayLimits) {
+
+	fmi3UInt8 in[256];
+	fmi3UInt8 out[256];
+	fmi3UInt8 sender[sizeof(fmi3LsBusFlexRayOperationBusError) - 1];
+	fmi3LsBusUtilBufferInfo inInfo;
+	fmi3LsBusUtilBufferInfo outInfo;
+	fmi3LsBusUtilBufferInfo senderInfo;
+	fmi3LsBusUtilInjectRule rule;
+	fmi3LsBusUtilInjector injector;
+	fmi3LsBusOperationHeader tooLong = { FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT, 200 };
+	fmi3UInt8 data[8] = { 0 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&inInfo, in, sizeof(in));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&outInfo, out, sizeof(out));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&senderInfo, sender, sizeof(sender));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&inInfo, 0, 7, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_INJECT_RULE_INIT(&rule, 7, FMI3_LS_BUS_INJECT_PROBABILITY(1.0), 1, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_CONTENT_ERROR);
+	FMI3_LS_BUS_INJECT_INIT(&injector, &rule, 1, 1);
+
+	/* The Bus Error operation does not fit into the sender buffer, nothing is injected */
+	FMI3_LS_BUS_INJECT_FLEXRAY(&injector, &inInfo, &outInfo, &senderInfo);
+	EXPECT_EQ(outInfo.status, fmi3True);
+	EXPECT_EQ(senderInfo.status, fmi3False);
+	EXPECT_EQ(injector.injected, 0u);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&outInfo), 0);
+	EXPECT_EQ(inInfo.readPos, inInfo.start);
+
+	/* The data following an invalid operation length is discarded */
+	memcpy(inInfo.writePos, &tooLong, sizeof(tooLong));
+	inInfo.writePos += sizeof(tooLong);
+	FMI3_LS_BUS_INJECT_FLEXRAY(&injector, &inInfo, &outInfo, NULL);
+	EXPECT_EQ(outInfo.status, fmi3False);
+	EXPECT_EQ(injector.injected, 1u);
+	EXPECT_EQ((size_t)FMI3_LS_BUS_BUFFER_LENGTH(&outInfo), sizeof(fmi3LsBusFlexRayOperationBusError));
+	EXPECT_EQ(inInfo.readPos, inInfo.writePos);
+}
+
+/**
+ * \brief Test for matching FlexRay Confirm operations to outstanding transmissions.
+ */
+TEST(Fmi3LsBusTxTracker, flexRayConfirm) {
+
+	fmi3UInt8 buffer[64];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilTxTrackerEntry entries[4];
+	fmi3LsBusUtilTxTracker tracker;
+	int pdu = 0;
+	void* context;
+	fmi3UInt64 latency;
+
+	FMI3_LS_BUS_TX_TRACKER_INIT(&tracker, entries, 4, 0);
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY(3, 12, FMI3_LS_BUS_FLEXRAY_CHANNEL_A), 100, &pdu);
+	FMI3_LS_BUS_TX_TRACKER_SUBMIT(&tracker, FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY(3, 12, FMI3_LS_BUS_FLEXRAY_CHANNEL_B), 100, &pdu);
+	EXPECT_EQ(tracker.status, fmi3True);
+
+	FMI3_LS_BUS_TX_TRACKER_CANCEL(&tracker, FMI3_LS_BUS_TX_TRACKER_FLEXRAY_KEY(3, 12, FMI3_LS_BUS_FLEXRAY_CHANNEL_A), context);
+	EXPECT_EQ(context, &pdu);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 3, 12, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_TX_TRACKER_FLEXRAY_CONFIRM(&tracker, (fmi3LsBusFlexRayOperationConfirm*)operation, 350, context, latency);
+	EXPECT_EQ(tracker.status, fmi3True);
+	EXPECT_EQ(context, &pdu);
+	EXPECT_EQ(latency, 250u);
+	EXPECT_EQ(tracker.size, 0u);
+}
+
+/**
+ * \brief Test for buffering, canceling and firing pending FlexRay Transmit operations.
+ */
+TEST(Fmi3LsBusFlexRayPending, transmitCancelFire) {
+
+	const size_t slotCount = 2047;
+	std::vector<fmi3UInt32> entries(FMI3_LS_BUS_FLEXRAY_PENDING_ENTRY_COUNT(slotCount));
+	std::vector<fmi3UInt64> occupied(FMI3_LS_BUS_FLEXRAY_PENDING_WORD_COUNT(slotCount));
+	fmi3LsBusUtilFlexRayPendingFrame frames[4];
+	fmi3LsBusUtilFlexRayPending pending;
+	fmi3UInt8 buffer[512];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusFlexRayOperationTransmit* transmit;
+	fmi3UInt8 data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	size_t slot;
+	fmi3LsBusFlexRayChannel channel;
+
+	FMI3_LS_BUS_FLEXRAY_PENDING_INIT(&pending, entries.data(), occupied.data(), slotCount, frames, 4);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 5, 2000, FMI3_LS_BUS_FLEXRAY_CHANNEL_A | FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 5, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 5, 40, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 6, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 5, 2048, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(&pending, (fmi3LsBusFlexRayOperationTransmit*)operation);
+	}
+	// The slot 2048 is out of range.
+	EXPECT_EQ(pending.status, fmi3False);
+	EXPECT_EQ(pending.size, 5u);
+
+	// All frames are used, but replacing a pending Transmit operation reuses its frame.
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	data[0] = 9;
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 6, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 6, 4, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(&pending, (fmi3LsBusFlexRayOperationTransmit*)operation);
+	EXPECT_EQ(pending.status, fmi3True);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(&pending, (fmi3LsBusFlexRayOperationTransmit*)operation);
+	EXPECT_EQ(pending.status, fmi3False);
+
+	// Replacing a single channel of a frame pending on both channels does not release a frame, so nothing is replaced.
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	data[0] = 7;
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 5, 2000, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(&pending, (fmi3LsBusFlexRayOperationTransmit*)operation);
+	EXPECT_EQ(pending.status, fmi3False);
+	EXPECT_EQ(pending.size, 5u);
+
+	FMI3_LS_BUS_FLEXRAY_PENDING_CANCEL(&pending, 5, 40, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	EXPECT_EQ(pending.status, fmi3True);
+	FMI3_LS_BUS_FLEXRAY_PENDING_CANCEL(&pending, 5, 40, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	EXPECT_EQ(pending.status, fmi3False);
+
+	// Transmit operations shorter than their data are rejected.
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 6, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	operation->length = (fmi3LsBusOperationLength)(sizeof(fmi3LsBusFlexRayOperationTransmit) + 7);
+	FMI3_LS_BUS_FLEXRAY_PENDING_TRANSMIT(&pending, (fmi3LsBusFlexRayOperationTransmit*)operation);
+	EXPECT_EQ(pending.status, fmi3False);
+	EXPECT_EQ(pending.size, 4u);
+
+	// Iterate the occupied slots of cycle 5 in ascending order.
+	size_t fired = 0;
+	const size_t expectedSlots[3] = { 3, 2000, 2000 };
+	const fmi3LsBusFlexRayChannel expectedChannels[3] = { FMI3_LS_BUS_FLEXRAY_CHANNEL_B, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, FMI3_LS_BUS_FLEXRAY_CHANNEL_B };
+	FMI3_LS_BUS_FLEXRAY_PENDING_NEXT(&pending, 5, 1, slot, channel);
+	while (slot != 0) {
+		ASSERT_LT(fired, 3u);
+		EXPECT_EQ(slot, expectedSlots[fired]);
+		EXPECT_EQ(channel, expectedChannels[fired]);
+		FMI3_LS_BUS_FLEXRAY_PENDING_FIRE(&pending, 5, slot, channel, transmit);
+		ASSERT_NE(transmit, nullptr);
+		EXPECT_EQ(transmit->slotId, slot);
+		EXPECT_EQ(transmit->data[0], 1u);
+		fired++;
+		FMI3_LS_BUS_FLEXRAY_PENDING_NEXT(&pending, 5, slot, slot, channel);
+	}
+	EXPECT_EQ(fired, 3u);
+
+	FMI3_LS_BUS_FLEXRAY_PENDING_FIRE(&pending, 6, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, transmit);
+	ASSERT_NE(transmit, nullptr);
+	EXPECT_EQ(transmit->data[0], 9u);
+	FMI3_LS_BUS_FLEXRAY_PENDING_FIRE(&pending, 6, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, transmit);
+	EXPECT_EQ(transmit, nullptr);
+	EXPECT_EQ(pending.size, 0u);
+	EXPECT_LT(pending.freeFrame, 4u);
+}
+
+/**
+ * \brief Test for collecting FlexRay operations until the next boundary.
+ */
+TEST(Fmi3LsBusFlexRayBoundary, collect) {
+
+	fmi3UInt8 buffer[512];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 rxBuffers[2][256];
+	fmi3LsBusUtilBufferInfo rxBufferInfos[2];
+	fmi3LsBusUtilFlexRayBoundary collector;
+	fmi3UInt8 data[8] = { 0 };
+	const fmi3UInt64 start = 1000000;
+	fmi3UInt64 boundary;
+	fmi3Boolean due;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfos[0], rxBuffers[0], sizeof(rxBuffers[0]));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfos[1], rxBuffers[1], sizeof(rxBuffers[1]));
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_INIT(&collector, rxBufferInfos, 2, FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT);
+
+	/* Operations are released at their own time until the communication is started */
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, 1234, boundary);
+	EXPECT_EQ(boundary, 1234u);
+
+	/* 5 ms cycles with 10 static slots of 50 us and 100 minislots of 10 us */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 2, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 20, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_START_COMMUNICATION(&bufferInfo, start);
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		FMI3_LS_BUS_FLEXRAY_BOUNDARY_CONFIGURE(&collector, operation);
+	}
+
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 5000000 + 60000, boundary);
+	EXPECT_EQ(boundary, start + 5000000 + 100000);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 100000, boundary);
+	EXPECT_EQ(boundary, start + 100000);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 502700, boundary);
+	EXPECT_EQ(boundary, start + 510000);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 1600000, boundary);
+	EXPECT_EQ(boundary, start + 5000000);
+	collector.granularity = FMI3_LS_BUS_FLEXRAY_BOUNDARY_SEGMENT;
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 60000, boundary);
+	EXPECT_EQ(boundary, start + 500000);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 502700, boundary);
+	EXPECT_EQ(boundary, start + 1500000);
+	collector.granularity = FMI3_LS_BUS_FLEXRAY_BOUNDARY_CYCLE;
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_AT(&collector, start + 60000, boundary);
+	EXPECT_EQ(boundary, start + 5000000);
+
+	/* The transmission of slot 2 and its confirmation are delivered together at the end of the slot */
+	collector.granularity = FMI3_LS_BUS_FLEXRAY_BOUNDARY_SLOT;
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 2, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIRM(&bufferInfo, 0, 2, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 0, 3, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 8, data);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(&collector, 1, start + 60000, operation);
+	EXPECT_EQ(collector.status, fmi3True);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(&collector, 0, start + 60000, operation);
+	EXPECT_EQ(collector.status, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME(&collector), start + 100000);
+
+	/* An operation of the next slot is rejected until the batch was released */
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	fmi3LsBusOperationHeader* rejected = operation;
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(&collector, 1, start + 110000, rejected);
+	EXPECT_EQ(collector.status, fmi3False);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_RELEASE(&collector, start + 99999, due);
+	EXPECT_EQ(due, fmi3False);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_RELEASE(&collector, start + 100000, due);
+	EXPECT_EQ(due, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME(&collector), FMI3_LS_BUS_FLEXRAY_BOUNDARY_TIME_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfos[1], operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_FLEXRAY_OP_TRANSMIT);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfos[0], operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_FLEXRAY_OP_CONFIRM);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&rxBufferInfos[0]);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&rxBufferInfos[1]);
+
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(&collector, 1, start + 110000, rejected);
+	EXPECT_EQ(collector.status, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME(&collector), start + 150000);
+	EXPECT_EQ(collector.operations, 3u);
+	EXPECT_EQ(collector.batches, 1u);
+
+	/* An operation with an earlier boundary does not release the collected operations early */
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_ADD(&collector, 0, start + 60000, rejected);
+	EXPECT_EQ(collector.status, fmi3False);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_BOUNDARY_NEXT_TIME(&collector), start + 150000);
+	EXPECT_EQ(rxBufferInfos[0].writePos, rxBufferInfos[0].start);
+	FMI3_LS_BUS_FLEXRAY_BOUNDARY_RELEASE(&collector, start + 100000, due);
+	EXPECT_EQ(due, fmi3False);
+	EXPECT_EQ(collector.operations, 3u);
+}
+
+/**
+ * \brief Test for resolving the arbitration of a dynamic segment.
+ */
+TEST(Fmi3LsBusFlexRayDynamic, resolve) {
+
+	fmi3UInt8 buffer[128];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilFlexRayDynamic dynamic;
+	const fmi3UInt64 segmentStart = 500000;
+
+	/* 100 minislots of 10 us, minislot action point offset of 2 us, dynamic slot idle time of 1 us */
+	FMI3_LS_BUS_FLEXRAY_DYNAMIC_INIT(&dynamic);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 2, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 20, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_DYNAMIC_CONFIGURE(&dynamic, operation);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_MINISLOTS(&dynamic, 8), 3u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_DYNAMIC_FRAME_MINISLOTS(&dynamic, 64), 8u);
+
+	fmi3LsBusUtilFlexRayDynamicFrame frames[8] = {
+		{ 5, 8, fmi3False, 0, 0 },   /* static slot */
+		{ 12, 8, fmi3False, 0, 0 },
+		{ 15, 8, fmi3False, 0, 0 },
+		{ 15, 8, fmi3False, 0, 0 },  /* second frame of the same slot */
+		{ 20, 100, fmi3False, 0, 0 }, /* exceeds the maximum dynamic payload length */
+		{ 50, 64, fmi3False, 0, 0 },
+		{ 95, 64, fmi3False, 0, 0 }, /* does not fit into the remaining minislots */
+		{ 120, 8, fmi3False, 0, 0 }, /* after the last minislot */
+	};
+	FMI3_LS_BUS_FLEXRAY_DYNAMIC_RESOLVE(&dynamic, frames, 8, segmentStart);
+
+	const fmi3Boolean transmitted[8] = { fmi3False, fmi3True, fmi3True, fmi3False, fmi3False, fmi3True, fmi3False, fmi3False };
+	for (size_t i = 0; i < 8; i++) {
+		EXPECT_EQ(frames[i].transmitted, transmitted[i]);
+	}
+	EXPECT_EQ(frames[1].startTime, segmentStart + 12000);
+	EXPECT_EQ(frames[1].endTime, segmentStart + 29400);
+	EXPECT_EQ(frames[2].startTime, segmentStart + 62000);
+	EXPECT_EQ(frames[5].startTime, segmentStart + 432000);
+	EXPECT_EQ(frames[5].endTime, segmentStart + 505400);
+	EXPECT_EQ(dynamic.transmitted, 3u);
+	EXPECT_EQ(dynamic.minislotsUsed, 100u);
+	EXPECT_EQ(dynamic.slotCounter, 100u);
+
+	/* Empty slots after the last frame advance the slot counter until the end of the segment */
+	FMI3_LS_BUS_FLEXRAY_DYNAMIC_RESOLVE(&dynamic, &frames[1], 1, segmentStart);
+	EXPECT_EQ(dynamic.transmitted, 1u);
+	EXPECT_EQ(dynamic.minislotsUsed, 4u);
+	EXPECT_EQ(dynamic.slotCounter, 109u);
+}
+
+/** \brief Test for validating a FlexRay configuration and computing its derived timing */
+TEST(Fmi3LsBusFlexRayTiming, validateCompute) {
+
+	fmi3UInt8 buffer[128];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilFlexRayTiming timing;
+	fmi3UInt32 errors;
+
+	EXPECT_EQ(alignof(fmi3LsBusUtilFlexRayTiming), 64u);
+
+	/* 10 static slots of 50 us, 100 minislots of 10 us, symbol window of 20 us and NIT of 3480 us */
+	FMI3_LS_BUS_FLEXRAY_TIMING_INIT(&timing);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 2, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 3480, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_TIMING_CONFIGURE(&timing, operation);
+	EXPECT_EQ(timing.errors, FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_NONE);
+	EXPECT_EQ(timing.cycleDuration, 5000000u);
+	EXPECT_EQ(timing.dynamicSegmentStart, 500000u);
+	EXPECT_EQ(timing.symbolWindowStart, 1500000u);
+	EXPECT_EQ(timing.symbolActionPoint, 1502000u);
+	EXPECT_EQ(timing.nitStart, 1520000u);
+	EXPECT_EQ(timing.cycleCount, 64u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_TIMING_STATIC_SLOT_START(&timing, 1), 0u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_TIMING_ACTION_POINT(&timing, 3), 102000u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_TIMING_MINISLOT_START(&timing, 4), 540000u);
+	EXPECT_EQ(FMI3_LS_BUS_FLEXRAY_TIMING_CYCLE_START(&timing, 1000, 12345678), 10001000u);
+
+	/* Segments do not add up to the cycle length */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 2, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 20, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	const fmi3LsBusFlexRayOperationConfiguration* config = (const fmi3LsBusFlexRayOperationConfiguration*)operation;
+	FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE(&config->flexRayConfig, errors);
+	EXPECT_EQ(errors, FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_SEGMENTS);
+
+	/* Action point offset at the end of the static slot leaves no room for the frame */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 63, 50, 50, 10, 8, 2, 100, 10,
+		64, 2, 20, 3480, 0, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	config = (const fmi3LsBusFlexRayOperationConfiguration*)operation;
+	FMI3_LS_BUS_FLEXRAY_TIMING_VALIDATE(&config->flexRayConfig, errors);
+	EXPECT_EQ(errors, FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_ACTION_POINT | FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_STATIC_FRAME);
+
+	/* Even cycle count max, minislot action point offset beyond the minislot and NM vector longer than the payload */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_CONFIGURATION_FLEXRAY_CONFIG(&bufferInfo, 1000, 5000, 62, 2, 50, 10, 8, 10, 100, 10,
+		64, 2, 20, 3480, 10, 1, FMI3_LS_BUS_FLEXRAY_CONFIG_PARAM_COLDSTART_NODE_TYPE_NONE);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_TIMING_CONFIGURE(&timing, operation);
+	EXPECT_EQ(timing.errors, FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_CYCLE_COUNT |
+		FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_MINISLOT_ACTION_POINT | FMI3_LS_BUS_FLEXRAY_TIMING_ERROR_PAYLOAD);
+
+	/* Other operations leave the timing unchanged */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_START_COMMUNICATION(&bufferInfo, 0);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	FMI3_LS_BUS_FLEXRAY_TIMING_CONFIGURE(&timing, operation);
+	EXPECT_EQ(timing.cycleCount, 63u);
+}
+
+/** \brief Test for merging the copies of FlexRay frames received on channel A and B */
+TEST(Fmi3LsBusFlexRayMerge, add) {
+
+	fmi3UInt8 buffer[512];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusOperationHeader* operations[12];
+	fmi3LsBusUtilFlexRayMergeFrame frames[7];
+	static fmi3LsBusUtilFlexRayMerge merge;
+	fmi3Boolean handled[12];
+	const fmi3UInt8 data[4] = { 1, 2, 3, 4 };
+	const fmi3UInt8 other[4] = { 1, 2, 3, 5 };
+	size_t count = 0;
+
+	FMI3_LS_BUS_FLEXRAY_MERGE_INIT(&merge, frames, 7);
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 6, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 6, FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 4, other);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 7, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR(&bufferInfo, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_SYNTAX_ERROR, 3, 8, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 8, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 9, FMI3_LS_BUS_FLEXRAY_CHANNEL_A | FMI3_LS_BUS_FLEXRAY_CHANNEL_B, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR(&bufferInfo, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_SYNTAX_ERROR, 3, FMI3_LS_BUS_FLEXRAY_SEGMENT_INDICATOR_SYMBOL_WINDOW, FMI3_LS_BUS_FLEXRAY_CHANNEL_A);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 4, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 4, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 4, 20, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	ASSERT_EQ(bufferInfo.status, fmi3True);
+
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		ASSERT_LT(count, 12u);
+		operations[count] = operation;
+		FMI3_LS_BUS_FLEXRAY_MERGE_ADD(&merge, operation, handled[count]);
+		count++;
+	}
+	ASSERT_EQ(count, 12u);
+
+	/* Symbol window errors and operations exceeding the capacity are left to the caller */
+	const fmi3Boolean expectedHandled[12] = { fmi3True, fmi3True, fmi3True, fmi3True, fmi3True, fmi3True,
+		fmi3True, fmi3True, fmi3False, fmi3True, fmi3True, fmi3False };
+	for (size_t i = 0; i < 12; i++) {
+		EXPECT_EQ(handled[i], expectedHandled[i]);
+	}
+	EXPECT_EQ(merge.status, fmi3False);
+	ASSERT_EQ(merge.count, 7u);
+	EXPECT_EQ(merge.merged, 3u);
+	EXPECT_EQ(merge.mismatches, 1u);
+
+	/* Identical copies refer to the first operation */
+	EXPECT_EQ(frames[0].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_REDUNDANT);
+	EXPECT_EQ((const void*)frames[0].operation, (const void*)operations[0]);
+	EXPECT_EQ(frames[0].conflicting, nullptr);
+	EXPECT_EQ(frames[1].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_MISMATCH);
+	EXPECT_EQ((const void*)frames[1].conflicting, (const void*)operations[3]);
+	EXPECT_EQ(frames[2].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE);
+	EXPECT_EQ(frames[3].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_CHANNEL_ERROR);
+	EXPECT_EQ(frames[3].errorChannels, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+	EXPECT_EQ((const void*)frames[3].operation, (const void*)operations[6]);
+	EXPECT_EQ(frames[4].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_REDUNDANT);
+
+	/* Copies of another cycle or a second copy on the same channel start a new frame */
+	EXPECT_EQ(frames[5].cycleId, 4u);
+	EXPECT_EQ(frames[5].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE);
+	EXPECT_EQ(frames[6].slotId, 5u);
+	EXPECT_EQ(frames[6].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE);
+
+	/* Frames of previous batches are not merged after a reset */
+	FMI3_LS_BUS_FLEXRAY_MERGE_RESET(&merge);
+	FMI3_LS_BUS_FLEXRAY_MERGE_ADD(&merge, operations[1], handled[0]);
+	EXPECT_EQ(handled[0], fmi3True);
+	EXPECT_EQ(merge.count, 1u);
+	EXPECT_EQ(frames[0].channels, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+	EXPECT_EQ(frames[0].state, FMI3_LS_BUS_FLEXRAY_MERGE_STATE_SINGLE);
+}
+
+/** \brief Test for leaving truncated FlexRay operations to the caller when merging */
+TEST(Fmi3LsBusFlexRayMerge, truncated) {
+
+	fmi3UInt8 buffer[128];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusUtilFlexRayMergeFrame frames[2];
+	static fmi3LsBusUtilFlexRayMerge merge;
+	fmi3Boolean handled = fmi3True;
+	const fmi3UInt8 data[4] = { 1, 2, 3, 4 };
+
+	FMI3_LS_BUS_FLEXRAY_MERGE_INIT(&merge, frames, 2);
+
+	/* Transmit operation whose length does not cover its data */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_TRANSMIT(&bufferInfo, 3, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_A, fmi3False, fmi3False, fmi3False, fmi3False, 4, data);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	operation->length = (fmi3LsBusOperationLength)(sizeof(fmi3LsBusFlexRayOperationTransmit) + 3);
+	FMI3_LS_BUS_FLEXRAY_MERGE_ADD(&merge, operation, handled);
+	EXPECT_EQ(handled, fmi3False);
+
+	/* Transmit operation shorter than its structure */
+	operation->length = (fmi3LsBusOperationLength)sizeof(fmi3LsBusOperationHeader);
+	handled = fmi3True;
+	FMI3_LS_BUS_FLEXRAY_MERGE_ADD(&merge, operation, handled);
+	EXPECT_EQ(handled, fmi3False);
+
+	/* Bus Error operation shorter than its structure */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_FLEXRAY_CREATE_OP_BUS_ERROR(&bufferInfo, FMI3_LS_BUS_FLEXRAY_BUSERROR_PARAM_SYNTAX_ERROR, 3, 5, FMI3_LS_BUS_FLEXRAY_CHANNEL_B);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)), fmi3True);
+	operation->length = (fmi3LsBusOperationLength)(sizeof(fmi3LsBusFlexRayOperationBusError) - 1);
+	handled = fmi3True;
+	FMI3_LS_BUS_FLEXRAY_MERGE_ADD(&merge, operation, handled);
+	EXPECT_EQ(handled, fmi3False);
+
+	EXPECT_EQ(merge.count, 0u);
+	EXPECT_EQ(merge.status, fmi3True);
+}
@@ -0,0 +1,1149 @@
+#include "fmi_3_ls_bus_header_test_helper_util.h"
+#include <gtest/gtest.h>
+
+/**
+ * \brief Test for parsing the example manifest file.
+ */
+TEST(Fmi3LsBusManifest, parseExample) {
+
+	fmi3LsBusUtilManifest manifest;
+
+	EXPECT_EQ(ParseManifest(ManifestExample, &manifest), fmi3True);
+	EXPECT_EQ(manifest.magic, FMI3_LS_BUS_MANIFEST_CACHE_MAGIC);
+	EXPECT_EQ(manifest.formatVersion, FMI3_LS_BUS_MANIFEST_CACHE_FORMAT_VERSION);
+	EXPECT_EQ(manifest.contentHash, 0x1234u);
+	EXPECT_EQ(manifest.isBusSimulationFMU, FMI3_LS_BUS_FALSE);
+	EXPECT_STREQ(manifest.version, "1.1.0-alpha.1");
+}
+
+/**
+ * \brief Test for parsing the valid values of the attribute 'isBusSimulationFMU'.
+ */
+TEST(Fmi3LsBusManifest, isBusSimulationFmu) {
+
+	fmi3LsBusUtilManifest manifest;
+
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("isBusSimulationFMU", "true"), &manifest), fmi3True);
+	EXPECT_EQ(manifest.isBusSimulationFMU, FMI3_LS_BUS_TRUE);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("isBusSimulationFMU", "1"), &manifest), fmi3True);
+	EXPECT_EQ(manifest.isBusSimulationFMU, FMI3_LS_BUS_TRUE);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("isBusSimulationFMU", "0"), &manifest), fmi3True);
+	EXPECT_EQ(manifest.isBusSimulationFMU, FMI3_LS_BUS_FALSE);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("isBusSimulationFMU", "yes"), &manifest), fmi3False);
+}
+
+/**
+ * \brief Test for manifest files violating the schema.
+ */
+TEST(Fmi3LsBusManifest, wrongValues) {
+
+	fmi3LsBusUtilManifest manifest;
+	std::string xml;
+
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("fmi-ls:fmi-ls-name", "org.fmi-standard.fmi-ls-xcp"), &manifest), fmi3False);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("fmi-ls:fmi-ls-description", "Bus"), &manifest), fmi3False);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("fmi-ls:fmi-ls-version", ""), &manifest), fmi3False);
+	EXPECT_EQ(ParseManifest(ReplaceManifestAttribute("fmi-ls:fmi-ls-version", std::string(FMI3_LS_BUS_MANIFEST_MAX_VERSION_LENGTH, '1')), &manifest), fmi3False);
+
+	// Missing required attribute.
+	xml = ManifestExample;
+	xml.erase(xml.find("fmi-ls:fmi-ls-version"), std::string("fmi-ls:fmi-ls-version=\"1.1.0-alpha.1\"").size());
+	EXPECT_EQ(ParseManifest(xml, &manifest), fmi3False);
+
+	// Unknown attribute.
+	xml = ManifestExample;
+	xml.insert(xml.find("isBusSimulationFMU"), "isBusSimulation=\"true\" ");
+	EXPECT_EQ(ParseManifest(xml, &manifest), fmi3False);
+
+	// Child elements are not allowed.
+	xml = ManifestExample;
+	xml.replace(xml.find("/>"), 2, "><Child/></fmiLayeredStandardManifest>");
+	EXPECT_EQ(ParseManifest(xml, &manifest), fmi3False);
+
+	// Wrong root element and malformed text.
+	EXPECT_EQ(ParseManifest("<fmiModelDescription/>", &manifest), fmi3False);
+	EXPECT_EQ(ParseManifest(ManifestExample.substr(0, ManifestExample.size() - 1), &manifest), fmi3False);
+	EXPECT_EQ(ParseManifest("", &manifest), fmi3False);
+}
+
+/**
+ * \brief Test for the manifest cache lookup.
+ */
+TEST(Fmi3LsBusManifest, cacheFind) {
+
+	fmi3LsBusUtilManifest cache[3];
+	const fmi3LsBusUtilManifest* manifest;
+	fmi3Boolean status;
+	fmi3UInt64 hash;
+
+	for (fmi3UInt64 i = 0; i < 3; i++)
+	{
+		FMI3_LS_BUS_MANIFEST_PARSE(&cache[i], ManifestExample.c_str(), ManifestExample.size(), 100 + i, status);
+		EXPECT_EQ(status, fmi3True);
+	}
+
+	// The cache is used as a binary blob.
+	FMI3_LS_BUS_MANIFEST_CACHE_FIND((const fmi3UInt8*)cache, sizeof(cache), 101, manifest);
+	EXPECT_EQ(manifest, &cache[1]);
+
+	FMI3_LS_BUS_MANIFEST_CACHE_FIND((const fmi3UInt8*)cache, sizeof(cache), 103, manifest);
+	EXPECT_EQ(manifest, nullptr);
+
+	// Entries with a different format version are ignored.
+	cache[2].formatVersion++;
+	FMI3_LS_BUS_MANIFEST_CACHE_FIND((const fmi3UInt8*)cache, sizeof(cache), 102, manifest);
+	EXPECT_EQ(manifest, nullptr);
+
+	// FNV-1a test vectors.
+	hash = FMI3_LS_BUS_MANIFEST_HASH_INIT;
+	FMI3_LS_BUS_MANIFEST_HASH(hash, "a", 1);
+	EXPECT_EQ(hash, 0xAF63DC4C8601EC8CULL);
+}
+
+/**
+ * \brief Test for reading the Bus Terminals of the example terminals and icons file.
+ */
+TEST(Fmi3LsBusTerminals, readExample) {
+
+	fmi3LsBusUtilBusTerminal terminals[2];
+	size_t count;
+
+	EXPECT_EQ(ReadTerminals(TerminalsExample, terminals, 2, &count), fmi3True);
+	EXPECT_EQ(count, 1u);
+	EXPECT_EQ(std::string(terminals[0].name, terminals[0].nameLength), "Powertrain");
+	EXPECT_EQ(std::string(terminals[0].variableName[FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA], terminals[0].variableNameLength[FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA]), "Powertrain.Tx_Data");
+	EXPECT_EQ(std::string(terminals[0].variableName[FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK], terminals[0].variableNameLength[FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK]), "Powertrain.Tx_Clock");
+	EXPECT_EQ(std::string(terminals[0].variableName[FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA], terminals[0].variableNameLength[FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA]), "Powertrain.Rx_Data");
+	EXPECT_EQ(std::string(terminals[0].variableName[FMI3_LS_BUS_TERMINAL_MEMBER_RX_CLOCK], terminals[0].variableNameLength[FMI3_LS_BUS_TERMINAL_MEMBER_RX_CLOCK]), "Powertrain.Rx_Clock");
+}
+
+/**
+ * \brief Test for terminals and icons files not containing valid Bus Terminals.
+ */
+TEST(Fmi3LsBusTerminals, readWrongValues) {
+
+	fmi3LsBusUtilBusTerminal terminals[2];
+	size_t count;
+	std::string xml;
+
+	// Capacity exceeded.
+	EXPECT_EQ(ReadTerminals(TerminalsExample, terminals, 0, &count), fmi3False);
+
+	// Missing member variable.
+	xml = TerminalsExample;
+	xml.replace(xml.find("memberName=\"Tx_Data\""), std::string("memberName=\"Tx_Data\"").size(), "memberName=\"Unknown\"");
+	EXPECT_EQ(ReadTerminals(xml, terminals, 2, &count), fmi3False);
+
+	// Terminals with other matching rules are ignored.
+	xml = TerminalsExample;
+	xml.replace(xml.find("org.fmi-ls-bus.transceiver"), std::string("org.fmi-ls-bus.transceiver").size(), "bus");
+	EXPECT_EQ(ReadTerminals(xml, terminals, 2, &count), fmi3True);
+	EXPECT_EQ(count, 0u);
+
+	// Malformed text.
+	EXPECT_EQ(ReadTerminals(TerminalsExample.substr(0, TerminalsExample.size() - 2), terminals, 2, &count), fmi3False);
+}
+
+/**
+ * \brief Test for resolving the value references using the example model description file.
+ */
+TEST(Fmi3LsBusTerminals, resolveExample) {
+
+	fmi3LsBusUtilBusTerminal terminals[1];
+	size_t count;
+	std::string xml;
+
+	ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+	EXPECT_EQ(ResolveTerminals(ModelDescriptionExample, terminals, count), fmi3True);
+	EXPECT_EQ(terminals[0].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA], 1003u);
+	EXPECT_EQ(terminals[0].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_TX_CLOCK], 1004u);
+	EXPECT_EQ(terminals[0].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA], 1001u);
+	EXPECT_EQ(terminals[0].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_RX_CLOCK], 1002u);
+	EXPECT_EQ(terminals[0].txClockType, FMI3_LS_BUS_CLOCK_TYPE_CHANGING);
+
+	// Missing variable.
+	xml = ModelDescriptionExample;
+	xml.replace(xml.find("Powertrain.Rx_Data"), std::string("Powertrain.Rx_Data").size(), "Powertrain.Rx_Frame");
+	ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+	EXPECT_EQ(ResolveTerminals(xml, terminals, count), fmi3False);
+
+	// Largest value reference.
+	xml = ModelDescriptionExample;
+	xml.replace(xml.find("\"1001\""), std::string("\"1001\"").size(), "\"4294967295\"");
+	ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+	EXPECT_EQ(ResolveTerminals(xml, terminals, count), fmi3True);
+	EXPECT_EQ(terminals[0].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_RX_DATA], 4294967295u);
+
+	// Value references exceeding 32 bits are not resolved.
+	xml = ModelDescriptionExample;
+	xml.replace(xml.find("\"1001\""), std::string("\"1001\"").size(), "\"4294967296\"");
+	ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+	EXPECT_EQ(ResolveTerminals(xml, terminals, count), fmi3False);
+	xml = ModelDescriptionExample;
+	xml.replace(xml.find("\"1001\""), std::string("\"1001\"").size(), "\"42949673001\"");
+	ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+	EXPECT_EQ(ResolveTerminals(xml, terminals, count), fmi3False);
+}
+
+/**
+ * \brief Test for building the routing table of two FMUs connected to the same bus segment.
+ */
+TEST(Fmi3LsBusTerminals, buildRoutes) {
+
+	fmi3LsBusUtilBusTerminal terminals[1];
+	fmi3LsBusUtilBusSegment segments[1];
+	fmi3LsBusUtilBusRoute routes[3];
+	size_t segmentCount = 0;
+	size_t count;
+	fmi3Boolean status;
+	std::string xml;
+
+	for (fmi3UInt32 fmu = 0; fmu < 2; fmu++)
+	{
+		ASSERT_EQ(ReadTerminals(TerminalsExample, terminals, 1, &count), fmi3True);
+		ASSERT_EQ(ResolveTerminals(ModelDescriptionExample, terminals, count), fmi3True);
+		FMI3_LS_BUS_TERMINALS_BUILD_ROUTES(terminals, count, fmu, segments, 1, segmentCount, &routes[fmu], status);
+		EXPECT_EQ(status, fmi3True);
+	}
+	EXPECT_EQ(segmentCount, 1u);
+	EXPECT_EQ(routes[0].fmuIndex, 0u);
+	EXPECT_EQ(routes[1].fmuIndex, 1u);
+	EXPECT_EQ(routes[0].busSegment, 0u);
+	EXPECT_EQ(routes[1].busSegment, 0u);
+	EXPECT_EQ(routes[1].valueReference[FMI3_LS_BUS_TERMINAL_MEMBER_TX_DATA], 1003u);
+
+	// A Bus Terminal with a different name requires a new bus segment.
+	xml = TerminalsExample;
+	xml.replace(xml.find("name=\"Powertrain\""), std::string("name=\"Powertrain\"").size(), "name=\"Chassis\"");
+	ASSERT_EQ(ReadTerminals(xml, terminals, 1, &count), fmi3True);
+	ASSERT_EQ(ResolveTerminals(ModelDescriptionExample, terminals, count), fmi3True);
+	FMI3_LS_BUS_TERMINALS_BUILD_ROUTES(terminals, count, 2, segments, 1, segmentCount, &routes[2], status);
+	EXPECT_EQ(status, fmi3False);
+}
+
+/**
+ * \brief Test for scheduling periodic Clocks and single Clock ticks.
+ */
+TEST(Fmi3LsBusScheduler, popBatches) {
+
+	fmi3LsBusUtilSchedulerEntry entries[4];
+	fmi3LsBusUtilScheduler scheduler;
+	fmi3UInt32 clocks[4];
+	size_t count;
+
+	FMI3_LS_BUS_SCHEDULER_INIT(&scheduler, entries, 4);
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler), FMI3_LS_BUS_SCHEDULER_TIME_NONE);
+
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 1, 1000000, 1000000);
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 0, 2000000, 2000000);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 2, 1500000);
+	EXPECT_EQ(scheduler.status, fmi3True);
+
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	EXPECT_EQ(scheduler.time, 1000000u);
+	ASSERT_EQ(count, 1u);
+	EXPECT_EQ(clocks[0], 1u);
+
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	EXPECT_EQ(scheduler.time, 1500000u);
+	ASSERT_EQ(count, 1u);
+	EXPECT_EQ(clocks[0], 2u);
+
+	// Simultaneous ticks are returned in one batch ordered by Clock index.
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	EXPECT_EQ(scheduler.time, 2000000u);
+	ASSERT_EQ(count, 2u);
+	EXPECT_EQ(clocks[0], 0u);
+	EXPECT_EQ(clocks[1], 1u);
+
+	// Batches exceeding the capacity are continued by the next call.
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	EXPECT_EQ(scheduler.time, 3000000u);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 1, count);
+	EXPECT_EQ(scheduler.time, 4000000u);
+	EXPECT_EQ(count, 1u);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 1, count);
+	EXPECT_EQ(scheduler.time, 4000000u);
+	EXPECT_EQ(count, 1u);
+	EXPECT_EQ(scheduler.ticks, 7u);
+	EXPECT_EQ(scheduler.batches, 5u);
+
+	// A polling importer with a step of 100 us would have issued 41 calls for each of the three Clocks.
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_SAVED_CALLS(&scheduler, 3, 100000), 3u * 41u - 7u);
+}
+
+/**
+ * \brief Test for removing Clocks and exceeding the capacity of the scheduler.
+ */
+TEST(Fmi3LsBusScheduler, removeAndCapacity) {
+
+	fmi3LsBusUtilSchedulerEntry entries[2];
+	fmi3LsBusUtilScheduler scheduler;
+	fmi3UInt32 clocks[2];
+	size_t count;
+
+	FMI3_LS_BUS_SCHEDULER_INIT(&scheduler, entries, 2);
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 0, 100, 100);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 1, 50);
+	EXPECT_EQ(scheduler.status, fmi3True);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 2, 10);
+	EXPECT_EQ(scheduler.status, fmi3False);
+
+	FMI3_LS_BUS_SCHEDULER_REMOVE(&scheduler, 1);
+	EXPECT_EQ(scheduler.size, 1u);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 2, count);
+	ASSERT_EQ(count, 1u);
+	EXPECT_EQ(clocks[0], 0u);
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler), 200u);
+
+	FMI3_LS_BUS_SCHEDULER_REMOVE(&scheduler, 0);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 2, count);
+	EXPECT_EQ(count, 0u);
+}
+
+/**
+ * \brief Test for removing a Clock with several pending ticks.
+ */
+TEST(Fmi3LsBusScheduler, removeMultipleTicks) {
+
+	fmi3LsBusUtilSchedulerEntry entries[8];
+	fmi3LsBusUtilScheduler scheduler;
+	fmi3UInt32 clocks[8];
+	size_t count;
+
+	FMI3_LS_BUS_SCHEDULER_INIT(&scheduler, entries, 8);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 0, 1);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 1, 10);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 2, 2);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 9, 11);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 3, 12);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 9, 3);
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 9, 5, 5);
+
+	FMI3_LS_BUS_SCHEDULER_REMOVE(&scheduler, 9);
+	EXPECT_EQ(scheduler.size, 4u);
+
+	const fmi3UInt32 expectedClocks[4] = { 0, 2, 1, 3 };
+	const fmi3UInt64 expectedTimes[4] = { 1, 2, 10, 12 };
+	for (size_t i = 0; i < 4; i++) {
+		FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 8, count);
+		ASSERT_EQ(count, 1u);
+		EXPECT_EQ(clocks[0], expectedClocks[i]);
+		EXPECT_EQ(scheduler.time, expectedTimes[i]);
+	}
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 8, count);
+	EXPECT_EQ(count, 0u);
+}
+
+/**
+ * \brief Test for skipping periodic Clock ticks while all buses are idle.
+ */
+TEST(Fmi3LsBusScheduler, fastForward) {
+
+	fmi3LsBusUtilSchedulerEntry entries[4];
+	fmi3LsBusUtilScheduler scheduler;
+	fmi3UInt8 buffers[2][64];
+	fmi3LsBusUtilBufferInfo bufferInfos[2];
+	fmi3UInt32 clocks[4];
+	fmi3Boolean idle;
+	size_t count;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfos[0], buffers[0], sizeof(buffers[0]));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfos[1], buffers[1], sizeof(buffers[1]));
+	FMI3_LS_BUS_CAN_CREATE_OP_WAKEUP(&bufferInfos[1]);
+	FMI3_LS_BUS_SCHEDULER_BUSES_IDLE(bufferInfos, 2, idle);
+	EXPECT_EQ(idle, fmi3False);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfos[1]);
+	FMI3_LS_BUS_SCHEDULER_BUSES_IDLE(bufferInfos, 2, idle);
+	EXPECT_EQ(idle, fmi3True);
+
+	FMI3_LS_BUS_SCHEDULER_INIT(&scheduler, entries, 4);
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 0, 1000, 1000);
+	FMI3_LS_BUS_SCHEDULER_ADD_PERIODIC(&scheduler, 1, 2500, 5000);
+	FMI3_LS_BUS_SCHEDULER_ADD_TICK(&scheduler, 2, 1000000);
+
+	// The next single Clock tick limits the fast-forward.
+	FMI3_LS_BUS_SCHEDULER_FAST_FORWARD(&scheduler, 5000000);
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler), 1000000u);
+	EXPECT_EQ(scheduler.skipped, 999u + 200u);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	ASSERT_EQ(count, 2u);
+	EXPECT_EQ(clocks[0], 0u);
+	EXPECT_EQ(clocks[1], 2u);
+
+	// Periodic Clocks stay aligned to their interval.
+	FMI3_LS_BUS_SCHEDULER_FAST_FORWARD(&scheduler, 2000000);
+	FMI3_LS_BUS_SCHEDULER_POP_BATCH(&scheduler, clocks, 4, count);
+	EXPECT_EQ(scheduler.time, 2000000u);
+	ASSERT_EQ(count, 1u);
+	EXPECT_EQ(clocks[0], 0u);
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler), 2001000u);
+	FMI3_LS_BUS_SCHEDULER_REMOVE(&scheduler, 0);
+	EXPECT_EQ(FMI3_LS_BUS_SCHEDULER_NEXT_TIME(&scheduler), 2002500u);
+	EXPECT_EQ(scheduler.ticks, 3u);
+}
+
+/**
+ * \brief Handler confirming received CAN Transmit operations.
+ */
+FMI3_LS_BUS_DISPATCH_DEFINE_HANDLER(OnCanTransmit, fmi3LsBusCanOperationCanTransmit)
+{
+	(*(int*)context)++;
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(txBufferInfo, operation->id);
+}
+
+/**
+ * \brief Test for dispatching operations to registered handlers.
+ */
+TEST(Fmi3LsBusDispatch, registeredHandler) {
+
+	fmi3UInt8 rxBuffer[64], txBuffer[64];
+	fmi3LsBusUtilBufferInfo rxBufferInfo, txBufferInfo;
+	fmi3LsBusUtilDispatcher dispatcher;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[] = { 1, 2, 3 };
+	int calls = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_DISPATCH_INIT(&dispatcher, &calls);
+	FMI3_LS_BUS_DISPATCH_REGISTER(&dispatcher, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, OnCanTransmit);
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&rxBufferInfo, 0x12, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&rxBufferInfo, 0x34, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+
+	EXPECT_EQ(calls, 2);
+	EXPECT_EQ(dispatcher.formatErrors, 0u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CONFIRM);
+	EXPECT_EQ(((fmi3LsBusCanOperationConfirm*)operation)->id, 0x12u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(((fmi3LsBusCanOperationConfirm*)operation)->id, 0x34u);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3False);
+}
+
+/**
+ * \brief Test for the Format Error operations created for unknown and truncated operations.
+ */
+TEST(Fmi3LsBusDispatch, formatError) {
+
+	fmi3UInt8 rxBuffer[64], txBuffer[64];
+	fmi3LsBusUtilBufferInfo rxBufferInfo, txBufferInfo;
+	fmi3LsBusUtilDispatcher dispatcher;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusOperationHeader unknown = { 0x1234, sizeof(fmi3LsBusOperationHeader) };
+	fmi3LsBusOperationHeader truncated = { FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, sizeof(fmi3LsBusOperationHeader) };
+	int calls = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_DISPATCH_INIT(&dispatcher, &calls);
+	FMI3_LS_BUS_DISPATCH_REGISTER(&dispatcher, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, OnCanTransmit);
+
+	memcpy(rxBufferInfo.writePos, &unknown, sizeof(unknown));
+	rxBufferInfo.writePos += sizeof(unknown);
+	memcpy(rxBufferInfo.writePos, &truncated, sizeof(truncated));
+	rxBufferInfo.writePos += sizeof(truncated);
+	FMI3_LS_BUS_CREATE_OP_FORMAT_ERROR(&rxBufferInfo, sizeof(unknown), (fmi3UInt8*)&unknown);
+	FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+
+	EXPECT_EQ(calls, 0);
+	EXPECT_EQ(dispatcher.formatErrors, 2u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+	EXPECT_EQ(((fmi3LsBusOperationFormatError*)operation)->dataLength, sizeof(unknown));
+	EXPECT_EQ(memcmp(((fmi3LsBusOperationFormatError*)operation)->data, &unknown, sizeof(unknown)), 0);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+	EXPECT_EQ(memcmp(((fmi3LsBusOperationFormatError*)operation)->data, &truncated, sizeof(truncated)), 0);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3False);
+}
+
+/**
+ * \brief Test for stopping the dispatch at an operation with an invalid length.
+ */
+TEST(Fmi3LsBusDispatch, invalidLength) {
+
+	fmi3UInt8 rxBuffer[64], txBuffer[64];
+	fmi3LsBusUtilBufferInfo rxBufferInfo, txBufferInfo;
+	fmi3LsBusUtilDispatcher dispatcher;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusOperationHeader zeroLength = { FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, 0 };
+	fmi3UInt8 data[] = { 1, 2, 3 };
+	int calls = 0;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_DISPATCH_INIT(&dispatcher, &calls);
+	FMI3_LS_BUS_DISPATCH_REGISTER(&dispatcher, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT, OnCanTransmit);
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&rxBufferInfo, 0x12, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	memcpy(rxBufferInfo.writePos, &zeroLength, sizeof(zeroLength));
+	rxBufferInfo.writePos += sizeof(zeroLength);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&rxBufferInfo, 0x34, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	const fmi3UInt32 remaining = (fmi3UInt32)(rxBufferInfo.writePos - rxBufferInfo.readPos) - (sizeof(fmi3LsBusCanOperationCanTransmit) + sizeof(data));
+	FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+
+	/* The operations following the invalid one are discarded */
+	EXPECT_EQ(calls, 1);
+	EXPECT_EQ(dispatcher.formatErrors, 1u);
+	EXPECT_EQ(rxBufferInfo.readPos, rxBufferInfo.writePos);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CONFIRM);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+	EXPECT_EQ(((fmi3LsBusOperationFormatError*)operation)->dataLength, remaining);
+	EXPECT_EQ(memcmp(((fmi3LsBusOperationFormatError*)operation)->data, &zeroLength, sizeof(zeroLength)), 0);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3False);
+}
+
+/**
+ * \brief Test for the Format Error operations created for long operations and a full Tx buffer.
+ */
+TEST(Fmi3LsBusDispatch, formatErrorLimits) {
+
+	static fmi3UInt8 rxBuffer[70000], txBuffer[70000];
+	fmi3UInt8 smallTxBuffer[16];
+	fmi3LsBusUtilBufferInfo rxBufferInfo, txBufferInfo;
+	fmi3LsBusUtilDispatcher dispatcher;
+	fmi3LsBusOperationHeader* operation;
+	fmi3LsBusOperationHeader unknown = { 0x1234, sizeof(rxBuffer) };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_DISPATCH_INIT(&dispatcher, NULL);
+
+	/* Operations longer than the data of a Format Error operation are truncated */
+	memcpy(rxBuffer, &unknown, sizeof(unknown));
+	rxBufferInfo.writePos = rxBufferInfo.end;
+	FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+	EXPECT_EQ(dispatcher.formatErrors, 1u);
+	EXPECT_EQ(dispatcher.droppedFormatErrors, 0u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&txBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+	EXPECT_EQ(((fmi3LsBusOperationFormatError*)operation)->dataLength, 0xFFFFu);
+	EXPECT_EQ(operation->length, sizeof(fmi3LsBusOperationFormatError) + 0xFFFFu);
+	EXPECT_EQ(memcmp(((fmi3LsBusOperationFormatError*)operation)->data, &unknown, sizeof(unknown)), 0);
+
+	/* Format Error operations not fitting into the Tx buffer are counted separately */
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, smallTxBuffer, sizeof(smallTxBuffer));
+	unknown.length = sizeof(unknown) + 8;
+	memcpy(rxBuffer, &unknown, sizeof(unknown));
+	rxBufferInfo.writePos += unknown.length;
+	FMI3_LS_BUS_DISPATCH(&dispatcher, &rxBufferInfo, &txBufferInfo);
+	EXPECT_EQ(dispatcher.formatErrors, 1u);
+	EXPECT_EQ(dispatcher.droppedFormatErrors, 1u);
+	EXPECT_EQ(txBufferInfo.status, fmi3False);
+	EXPECT_EQ(rxBufferInfo.readPos, rxBufferInfo.writePos);
+}
+
+/**
+ * \brief Test for the hand-off of operations using a shared channel.
+ */
+TEST(Fmi3LsBusShared, handOff) {
+
+	alignas(64) fmi3UInt8 memory[FMI3_LS_BUS_SHARED_CHANNEL_SIZE(64)];
+	fmi3LsBusUtilSharedChannel* channel = (fmi3LsBusUtilSharedChannel*)memory;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[] = { 1, 2, 3 };
+	fmi3UInt32 sequence;
+
+	FMI3_LS_BUS_SHARED_CHANNEL_INIT(channel, 64);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_IS_VALID(channel, sizeof(memory))), fmi3True);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_IS_VALID(channel, sizeof(memory) - 1)), fmi3False);
+
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(channel, &txBufferInfo);
+	EXPECT_EQ(txBufferInfo.start, FMI3_LS_BUS_SHARED_CHANNEL_DATA(channel));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x12, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x34, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(channel, &txBufferInfo);
+	EXPECT_EQ(FMI3_LS_BUS_SHARED_CHANNEL_SEQUENCE(channel), 2u);
+
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	ASSERT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(sequence, 2u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, 0x12u);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, 0x34u);
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3False);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_END_READ(channel, sequence)), fmi3True);
+}
+
+/**
+ * \brief Test for the detection of hand-offs written while reading.
+ */
+TEST(Fmi3LsBusShared, tornRead) {
+
+	alignas(64) fmi3UInt8 memory[FMI3_LS_BUS_SHARED_CHANNEL_SIZE(64)];
+	fmi3LsBusUtilSharedChannel* channel = (fmi3LsBusUtilSharedChannel*)memory;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3UInt8 data[] = { 1, 2, 3 };
+	fmi3UInt32 sequence;
+
+	FMI3_LS_BUS_SHARED_CHANNEL_INIT(channel, 64);
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(channel, &txBufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x12, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+
+	/* Hand-off in progress */
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+	FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(channel, &txBufferInfo);
+
+	/* Hand-off overwritten while reading */
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	ASSERT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), FMI3_LS_BUS_BUFFER_LENGTH(&txBufferInfo));
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(channel, &txBufferInfo);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_END_READ(channel, sequence)), fmi3False);
+	FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(channel, &txBufferInfo);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_END_READ(channel, sequence)), fmi3False);
+}
+
+/**
+ * \brief Test for rejecting torn operation lengths while reading a shared channel.
+ */
+TEST(Fmi3LsBusShared, tornLength) {
+
+	alignas(64) fmi3UInt8 memory[FMI3_LS_BUS_SHARED_CHANNEL_SIZE(64)];
+	fmi3LsBusUtilSharedChannel* channel = (fmi3LsBusUtilSharedChannel*)memory;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[] = { 1, 2, 3 };
+	fmi3UInt32 sequence;
+	fmi3Boolean available;
+
+	FMI3_LS_BUS_SHARED_CHANNEL_INIT(channel, 64);
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(channel, &txBufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x12, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x34, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(channel, &txBufferInfo);
+
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	ASSERT_EQ(rxBufferInfo.status, fmi3True);
+	FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+	ASSERT_EQ(available, fmi3True);
+	EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, 0x12u);
+
+	/* A length of 0 written concurrently ends the hand-off instead of reading the same operation forever */
+	((fmi3LsBusOperationHeader*)rxBufferInfo.readPos)->length = 0;
+	FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+	EXPECT_EQ(available, fmi3False);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+	EXPECT_EQ(rxBufferInfo.readPos, rxBufferInfo.writePos);
+
+	/* A length exceeding the hand-off is rejected as well */
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	((fmi3LsBusOperationHeader*)rxBufferInfo.readPos)->length = 64;
+	FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+	EXPECT_EQ(available, fmi3False);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+
+	/* The end of a consistent hand-off keeps the status */
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_WRITE(channel, &txBufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x56, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_SHARED_CHANNEL_END_WRITE(channel, &txBufferInfo);
+	FMI3_LS_BUS_SHARED_CHANNEL_BEGIN_READ(channel, &rxBufferInfo, sequence);
+	FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+	ASSERT_EQ(available, fmi3True);
+	FMI3_LS_BUS_SHARED_CHANNEL_READ_NEXT(&rxBufferInfo, operation, available);
+	EXPECT_EQ(available, fmi3False);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ((FMI3_LS_BUS_SHARED_CHANNEL_END_READ(channel, sequence)), fmi3True);
+}
+
+/**
+ * \brief Test for the coalescing of operations into datagrams.
+ */
+TEST(Fmi3LsBusBridge, coalesce) {
+
+	fmi3UInt8 txBuffer[256], rxBuffer[256];
+	fmi3UInt8 datagrams[4][64];
+	size_t lengths[4];
+	size_t count = 0;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3LsBusUtilBridge sender, receiver;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BRIDGE_INIT(&sender);
+	FMI3_LS_BUS_BRIDGE_INIT(&receiver);
+
+	/* Three operations of 24 bytes, two fit into a datagram of 64 bytes */
+	for (fmi3UInt32 id = 1; id <= 3; id++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, id, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	}
+	do {
+		FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagrams[count], sizeof(datagrams[count]), lengths[count]);
+	} while (lengths[count] != 0 && ++count < 4);
+
+	ASSERT_EQ(count, 2u);
+	EXPECT_EQ(txBufferInfo.status, fmi3True);
+	EXPECT_EQ(lengths[0], sizeof(fmi3LsBusUtilBridgeFrameHeader) + 48);
+	EXPECT_EQ(lengths[1], sizeof(fmi3LsBusUtilBridgeFrameHeader) + 24);
+	EXPECT_EQ(sender.txSequence, 2u);
+
+	for (size_t i = 0; i < count; i++) {
+		FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagrams[i], lengths[i], &rxBufferInfo);
+	}
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(receiver.lostFrames, 0u);
+	EXPECT_EQ(receiver.invalidFrames, 0u);
+	ASSERT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), FMI3_LS_BUS_BUFFER_LENGTH(&txBufferInfo));
+	EXPECT_EQ(memcmp(rxBuffer, txBuffer, FMI3_LS_BUS_BUFFER_LENGTH(&txBufferInfo)), 0);
+	for (fmi3UInt32 id = 1; id <= 3; id++) {
+		ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3True);
+		EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, id);
+	}
+}
+
+/**
+ * \brief Test for lost, malformed and oversized datagrams.
+ */
+TEST(Fmi3LsBusBridge, invalidFrames) {
+
+	fmi3UInt8 txBuffer[256], rxBuffer[256];
+	fmi3UInt8 datagram[64];
+	size_t length;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3LsBusUtilBridge sender, receiver;
+	fmi3UInt8 data[64] = { 0 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BRIDGE_INIT(&sender);
+	FMI3_LS_BUS_BRIDGE_INIT(&receiver);
+
+	/* Lost datagram */
+	sender.txSequence = 3;
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 1, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagram, sizeof(datagram), length);
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(receiver.lostFrames, 3u);
+	EXPECT_EQ(receiver.rxSequence, 4u);
+
+	/* Truncated and corrupted datagrams */
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length - 1, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+	datagram[sizeof(fmi3LsBusUtilBridgeFrameHeader) + sizeof(fmi3LsBusOperationCode)] = 0xFF;
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length, &rxBufferInfo);
+	EXPECT_EQ(receiver.invalidFrames, 2u);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), 24u);
+
+	/* Operation larger than a datagram */
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_FD_TRANSMIT(&txBufferInfo, 2, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 64, data);
+	FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagram, sizeof(datagram), length);
+	EXPECT_EQ(length, 0u);
+	EXPECT_EQ(txBufferInfo.status, fmi3False);
+
+	/* Operations before an invalid operation length are sent, the remaining data is discarded */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&txBufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 3, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	memset(txBufferInfo.writePos, 0, sizeof(fmi3LsBusOperationHeader));
+	txBufferInfo.writePos += sizeof(fmi3LsBusOperationHeader);
+	FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagram, sizeof(datagram), length);
+	EXPECT_EQ(length, sizeof(fmi3LsBusUtilBridgeFrameHeader) + 24);
+	EXPECT_EQ(txBufferInfo.status, fmi3False);
+	EXPECT_EQ(txBufferInfo.readPos, txBufferInfo.writePos);
+
+	/* A valid datagram resets the status of the receiving buffer */
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(receiver.invalidFrames, 2u);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), 48u);
+}
+
+/**
+ * \brief Test for discarding duplicate and reordered datagrams.
+ */
+TEST(Fmi3LsBusBridge, staleFrames) {
+
+	fmi3UInt8 txBuffer[256], rxBuffer[256];
+	fmi3UInt8 datagrams[4][64];
+	size_t lengths[4];
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo;
+	fmi3LsBusUtilBridge sender, receiver;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 0 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BRIDGE_INIT(&sender);
+	FMI3_LS_BUS_BRIDGE_INIT(&receiver);
+
+	/* One operation per datagram */
+	for (fmi3UInt32 id = 0; id < 4; id++) {
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, id, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+		FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagrams[id], sizeof(datagrams[id]), lengths[id]);
+		ASSERT_NE(lengths[id], 0u);
+	}
+
+	/* Received in the order 0, 2, 1, 3, 2 */
+	const size_t order[5] = { 0, 2, 1, 3, 2 };
+	for (size_t i = 0; i < 5; i++) {
+		FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagrams[order[i]], lengths[order[i]], &rxBufferInfo);
+	}
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(receiver.lostFrames, 1u);
+	EXPECT_EQ(receiver.staleFrames, 2u);
+	EXPECT_EQ(receiver.invalidFrames, 0u);
+	EXPECT_EQ(receiver.rxSequence, 4u);
+
+	const fmi3UInt32 expectedIds[3] = { 0, 2, 3 };
+	for (size_t i = 0; i < 3; i++) {
+		ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3True);
+		EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, expectedIds[i]);
+	}
+	EXPECT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)), fmi3False);
+
+	/* A maximum size smaller than the datagram header does not hold any operation */
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 4, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, sizeof(data), data);
+	FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagrams[0], sizeof(fmi3LsBusUtilBridgeFrameHeader) - 1, lengths[0]);
+	EXPECT_EQ(lengths[0], 0u);
+	EXPECT_EQ(txBufferInfo.status, fmi3False);
+	EXPECT_EQ(sender.txSequence, 4u);
+}
+
+/**
+ * \brief Test for encoding and decoding a cyclic CAN stream.
+ */
+TEST(Fmi3LsBusCodec, roundTrip) {
+
+	fmi3UInt8 opBuffer[2048], encodedBuffer[2048], decodedBuffer[2048];
+	fmi3LsBusUtilBufferInfo opBufferInfo, encodedBufferInfo, decodedBufferInfo;
+	fmi3LsBusUtilCodec encoder, decoder;
+	fmi3UInt8 data[8] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&opBufferInfo, opBuffer, sizeof(opBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&encodedBufferInfo, encodedBuffer, sizeof(encodedBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&decodedBufferInfo, decodedBuffer, sizeof(decodedBuffer));
+	FMI3_LS_BUS_CODEC_INIT(&encoder);
+	FMI3_LS_BUS_CODEC_INIT(&decoder);
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIGURATION_CAN_BAUDRATE(&opBufferInfo, 500000);
+	for (int cycle = 0; cycle < 10; cycle++) {
+		data[0] = (fmi3UInt8)(cycle / 5);
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&opBufferInfo, 0x100, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&opBufferInfo, 0x101, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+		FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&opBufferInfo, 0x18FEF100, FMI3_LS_BUS_TRUE, FMI3_LS_BUS_FALSE, 4, data);
+	}
+	ASSERT_EQ(opBufferInfo.status, fmi3True);
+
+	FMI3_LS_BUS_CODEC_ENCODE(&encoder, &opBufferInfo, &encodedBufferInfo);
+	ASSERT_EQ(encodedBufferInfo.status, fmi3True);
+	EXPECT_EQ(opBufferInfo.readPos, opBufferInfo.writePos);
+	EXPECT_LT(FMI3_LS_BUS_BUFFER_LENGTH(&encodedBufferInfo) * 5, FMI3_LS_BUS_BUFFER_LENGTH(&opBufferInfo));
+
+	FMI3_LS_BUS_CODEC_DECODE(&decoder, &encodedBufferInfo, &decodedBufferInfo);
+	ASSERT_EQ(decodedBufferInfo.status, fmi3True);
+	EXPECT_EQ(encodedBufferInfo.readPos, encodedBufferInfo.writePos);
+	ASSERT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&decodedBufferInfo), FMI3_LS_BUS_BUFFER_LENGTH(&opBufferInfo));
+	EXPECT_EQ(memcmp(decodedBuffer, opBuffer, FMI3_LS_BUS_BUFFER_LENGTH(&opBufferInfo)), 0);
+}
+
+/**
+ * \brief Test for decoding into a buffer that is too small and for malformed streams.
+ */
+TEST(Fmi3LsBusCodec, partialAndMalformed) {
+
+	fmi3UInt8 opBuffer[256], encodedBuffer[256], decodedBuffer[32];
+	fmi3LsBusUtilBufferInfo opBufferInfo, encodedBufferInfo, decodedBufferInfo;
+	fmi3LsBusUtilCodec encoder, decoder;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&opBufferInfo, opBuffer, sizeof(opBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&encodedBufferInfo, encodedBuffer, sizeof(encodedBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&decodedBufferInfo, decodedBuffer, sizeof(decodedBuffer));
+	FMI3_LS_BUS_CODEC_INIT(&encoder);
+	FMI3_LS_BUS_CODEC_INIT(&decoder);
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&opBufferInfo, 0x10, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&opBufferInfo, 0x10, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CODEC_ENCODE(&encoder, &opBufferInfo, &encodedBufferInfo);
+	ASSERT_EQ(encodedBufferInfo.status, fmi3True);
+
+	/* Only the first operation fits, decoding continues after reading it */
+	FMI3_LS_BUS_CODEC_DECODE(&decoder, &encodedBufferInfo, &decodedBufferInfo);
+	EXPECT_EQ(decodedBufferInfo.status, fmi3False);
+	ASSERT_EQ((FMI3_LS_BUS_READ_NEXT_OPERATION(&decodedBufferInfo, operation)), fmi3True);
+	EXPECT_EQ(((fmi3LsBusCanOperationCanTransmit*)operation)->id, 0x10u);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&decodedBufferInfo);
+	FMI3_LS_BUS_CODEC_DECODE(&decoder, &encodedBufferInfo, &decodedBufferInfo);
+	EXPECT_EQ(decodedBufferInfo.status, fmi3True);
+	EXPECT_EQ(memcmp(decodedBuffer, opBuffer + 24, 24), 0);
+
+	/* Unknown tag */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&decodedBufferInfo);
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&encodedBufferInfo);
+	*encodedBufferInfo.writePos++ = 0x7F;
+	*encodedBufferInfo.writePos++ = 0x00;
+	FMI3_LS_BUS_CODEC_DECODE(&decoder, &encodedBufferInfo, &decodedBufferInfo);
+	EXPECT_EQ(decodedBufferInfo.status, fmi3False);
+	EXPECT_EQ(encodedBufferInfo.readPos, encodedBufferInfo.start);
+}
+
+#if FMI3_LS_BUS_BUFFER_STATISTICS == 1
+/**
+ * \brief Test for the statistics of written and read operations.
+ */
+TEST(Fmi3LsBusStatistics, counters) {
+
+	fmi3UInt8 buffer[48];
+	fmi3LsBusUtilBufferInfo bufferInfo;
+	fmi3LsBusUtilBufferStatistics statistics, snapshot;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 0 };
+	char text[256];
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&bufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS(&bufferInfo, &statistics);
+
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x1, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x1);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&bufferInfo, 0x2, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	EXPECT_EQ(bufferInfo.status, fmi3False);
+	fmi3LsBusUtil::CanCreateOpCanTransmit<8>(&bufferInfo, 0x3, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, data);
+	EXPECT_EQ(bufferInfo.status, fmi3False);
+	while (FMI3_LS_BUS_READ_NEXT_OPERATION(&bufferInfo, operation)) {
+		EXPECT_NE(operation->opCode, FMI3_LS_BUS_OP_FORMAT_ERROR);
+	}
+
+	FMI3_LS_BUS_BUFFER_STATISTICS_SNAPSHOT(&bufferInfo, snapshot);
+	EXPECT_EQ(snapshot.opsWritten[FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT], 1u);
+	EXPECT_EQ(snapshot.opsWritten[FMI3_LS_BUS_CAN_OP_CONFIRM], 1u);
+	EXPECT_EQ(snapshot.opsRead[FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT], 1u);
+	EXPECT_EQ(snapshot.opsRead[FMI3_LS_BUS_CAN_OP_CONFIRM], 1u);
+	EXPECT_EQ(snapshot.bytesWritten, 24u + 12u);
+	EXPECT_EQ(snapshot.bytesRead, 24u + 12u);
+	EXPECT_EQ(snapshot.overflows, 2u);
+	EXPECT_EQ(snapshot.highWaterMark, 36u);
+
+	/* Counters keep running after the buffer was reset */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&bufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&bufferInfo, 0x2);
+	EXPECT_EQ(statistics.opsWritten[FMI3_LS_BUS_CAN_OP_CONFIRM], 2u);
+	EXPECT_EQ(statistics.highWaterMark, 36u);
+
+	FMI3_LS_BUS_BUFFER_STATISTICS_FORMAT(&statistics, text, sizeof(text));
+	EXPECT_STREQ(text, "bytesWritten=48 bytesRead=36 overflows=2 highWaterMark=36 op[0x10]=1/1 op[0x20]=2/1");
+}
+
+/**
+ * \brief Test for the statistics of buffers written by the bridge and the codec.
+ */
+TEST(Fmi3LsBusStatistics, bridgeAndCodec) {
+
+	fmi3UInt8 txBuffer[128], rxBuffer[64], encodedBuffer[24];
+	fmi3UInt8 datagram[128];
+	size_t length;
+	fmi3LsBusUtilBufferInfo txBufferInfo, rxBufferInfo, encodedBufferInfo;
+	fmi3LsBusUtilBufferStatistics rxStatistics, encodedStatistics;
+	fmi3LsBusUtilBridge sender, receiver;
+	fmi3LsBusUtilCodec encoder, decoder;
+	fmi3UInt8 data[8] = { 0 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&txBufferInfo, txBuffer, sizeof(txBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, rxBuffer, sizeof(rxBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&encodedBufferInfo, encodedBuffer, sizeof(encodedBuffer));
+	FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS(&rxBufferInfo, &rxStatistics);
+	FMI3_LS_BUS_BUFFER_INFO_SET_STATISTICS(&encodedBufferInfo, &encodedStatistics);
+	FMI3_LS_BUS_BRIDGE_INIT(&sender);
+	FMI3_LS_BUS_BRIDGE_INIT(&receiver);
+	FMI3_LS_BUS_CODEC_INIT(&encoder);
+	FMI3_LS_BUS_CODEC_INIT(&decoder);
+
+	/* Every operation of a received datagram is counted, datagrams not fitting are overflows */
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x1, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&txBufferInfo, 0x1);
+	FMI3_LS_BUS_BRIDGE_FRAME_NEXT(&sender, &txBufferInfo, datagram, sizeof(datagram), length);
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(rxStatistics.opsWritten[FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT], 1u);
+	EXPECT_EQ(rxStatistics.opsWritten[FMI3_LS_BUS_CAN_OP_CONFIRM], 1u);
+	EXPECT_EQ(rxStatistics.bytesWritten, 36u);
+	EXPECT_EQ(rxStatistics.highWaterMark, 36u);
+	EXPECT_EQ((size_t)(rxBufferInfo.writePos - rxBufferInfo.start), 36u);
+	FMI3_LS_BUS_BRIDGE_FRAME_RECEIVE(&receiver, datagram, length, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+	EXPECT_EQ(rxStatistics.overflows, 1u);
+
+	/* The encoder only counts overflows, the decoder every operation */
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&txBufferInfo);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&txBufferInfo, 0x1);
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&txBufferInfo, 0x1, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CODEC_ENCODE(&encoder, &txBufferInfo, &encodedBufferInfo);
+	EXPECT_EQ(encodedBufferInfo.status, fmi3False);
+	EXPECT_EQ(encodedStatistics.overflows, 1u);
+	EXPECT_EQ(encodedStatistics.bytesWritten, 0u);
+	EXPECT_GT(FMI3_LS_BUS_BUFFER_LENGTH(&encodedBufferInfo), 0);
+
+	FMI3_LS_BUS_BUFFER_INFO_RESET(&rxBufferInfo);
+	FMI3_LS_BUS_CODEC_DECODE(&decoder, &encodedBufferInfo, &rxBufferInfo);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(rxStatistics.opsWritten[FMI3_LS_BUS_CAN_OP_CONFIRM], 2u);
+	EXPECT_EQ(rxStatistics.bytesWritten, 48u);
+}
+#endif
+
+#define FMI3_LS_BUS_TEST_SIGNALS(X)                                              \
+	X(vCar, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 0, 16, fmi3False, 0.01, 0.0)       \
+	X(torque, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 20, 8, fmi3True, 1.0, 0.0)       \
+	X(rpm, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 39, 12, fmi3False, 1.0, 0.0)           \
+	X(temperature, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 51, 10, fmi3False, 0.5, -10.0)
+
+FMI3_LS_BUS_SIGNAL_DEFINE_PDU(Fmi3LsBusTestPdu, FMI3_LS_BUS_TEST_SIGNALS)
+
+#define FMI3_LS_BUS_TEST_WIDE_SIGNALS(X)                                         \
+	X(counter, FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, 131, 64, fmi3True, 1.0, 0.0)    \
+	X(flag, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 200, 1, fmi3False, 1.0, 0.0)          \
+	X(position, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, 259, 37, fmi3True, 0.001, 0.0)
+
+FMI3_LS_BUS_SIGNAL_DEFINE_PDU(Fmi3LsBusTestWidePdu, FMI3_LS_BUS_TEST_WIDE_SIGNALS)
+
+/**
+ * \brief Test for packing and unpacking the signals of a PDU with both byte orders.
+ */
+TEST(Fmi3LsBusSignal, packUnpack) {
+
+	Fmi3LsBusTestPdu signals = { 123.45, -2.0, 2748.0, 40.0 };
+	Fmi3LsBusTestPdu result;
+	fmi3UInt8 data[8];
+	const fmi3UInt8 expected[8] = { 0x39, 0x30, 0xE0, 0x0F, 0xAB, 0xC0, 0x01, 0x90 };
+
+	memset(data, 0, sizeof(data));
+	Fmi3LsBusTestPdu_Pack(&signals, data);
+	EXPECT_EQ(memcmp(data, expected, sizeof(data)), 0);
+
+	Fmi3LsBusTestPdu_Unpack(data, &result);
+	EXPECT_DOUBLE_EQ(result.vCar, 123.45);
+	EXPECT_DOUBLE_EQ(result.torque, -2.0);
+	EXPECT_DOUBLE_EQ(result.rpm, 2748.0);
+	EXPECT_DOUBLE_EQ(result.temperature, 40.0);
+
+	/* Bits not covered by a signal remain unchanged */
+	memset(data, 0xFF, sizeof(data));
+	Fmi3LsBusTestPdu_Pack(&signals, data);
+	EXPECT_EQ(data[2], 0xEF);
+	EXPECT_EQ(data[3], 0xFF);
+	EXPECT_EQ(data[6], 0xF1);
+	EXPECT_EQ(data[7], 0x93);
+}
+
+/**
+ * \brief Test for the generated functions against the macros with layout given at run time.
+ */
+TEST(Fmi3LsBusSignal, generatedMatchesRuntime) {
+
+	Fmi3LsBusTestWidePdu signals;
+	Fmi3LsBusTestWidePdu result;
+	fmi3UInt8 generated[64];
+	fmi3UInt8 runtime[64];
+	int byteOrders[] = { FMI3_LS_BUS_SIGNAL_LITTLE_ENDIAN, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN, FMI3_LS_BUS_SIGNAL_BIG_ENDIAN };
+	int startBits[] = { 131, 200, 259 };
+	int lengths[] = { 64, 1, 37 };
+	fmi3Float64 factors[] = { 1.0, 1.0, 0.001 };
+	fmi3Float64 values[3];
+	fmi3UInt64 seed = 0x2545F4914F6CDD1DULL;
+
+	for (int i = 0; i < 100; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		signals.counter = (fmi3Float64)(fmi3Int64)(seed >> 12) - (fmi3Float64)(1LL << 51);
+		signals.flag = (fmi3Float64)(seed & 1);
+		signals.position = (fmi3Float64)((fmi3Int64)(seed % 100000000) - 50000000) * 0.001;
+		values[0] = signals.counter;
+		values[1] = signals.flag;
+		values[2] = signals.position;
+
+		memset(generated, i, sizeof(generated));
+		memset(runtime, i, sizeof(runtime));
+		Fmi3LsBusTestWidePdu_Pack(&signals, generated);
+		for (int k = 0; k < 3; k++) {
+			FMI3_LS_BUS_SIGNAL_PACK(runtime, byteOrders[k], startBits[k], lengths[k], factors[k], 0.0, values[k]);
+		}
+		ASSERT_EQ(memcmp(generated, runtime, sizeof(generated)), 0);
+
+		Fmi3LsBusTestWidePdu_Unpack(generated, &result);
+		EXPECT_DOUBLE_EQ(result.counter, signals.counter);
+		EXPECT_DOUBLE_EQ(result.flag, signals.flag);
+		EXPECT_NEAR(result.position, signals.position, 1e-9);
+	}
+}
+
+/**
+ * \brief Test for reading operations from borrowed data in place.
+ */
+TEST(Fmi3LsBusBorrow, readInPlace) {
+
+	fmi3UInt8 source[128];
+	fmi3UInt8 buffer[64];
+	fmi3LsBusUtilBufferInfo sourceInfo;
+	fmi3LsBusUtilBufferInfo rxBufferInfo;
+	fmi3LsBusOperationHeader* operation;
+	fmi3UInt8 data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&sourceInfo, source, sizeof(source));
+	FMI3_LS_BUS_CAN_CREATE_OP_CAN_TRANSMIT(&sourceInfo, 0x1, FMI3_LS_BUS_FALSE, FMI3_LS_BUS_FALSE, 8, data);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&sourceInfo, 0x1);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&sourceInfo, 0x2);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_BUFFER_INFO_BORROW(&rxBufferInfo, FMI3_LS_BUS_BUFFER_START(&sourceInfo), FMI3_LS_BUS_BUFFER_LENGTH(&sourceInfo));
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)));
+	EXPECT_EQ((fmi3UInt8*)operation, source);
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CAN_TRANSMIT);
+
+	/* No operations can be written to borrowed data */
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&rxBufferInfo, 0x3);
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+
+	/* Only the operations not read yet are copied */
+	FMI3_LS_BUS_BUFFER_INFO_RETAIN(&rxBufferInfo, buffer, sizeof(buffer));
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_START(&rxBufferInfo), buffer);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), 24);
+	memset(source, 0, sizeof(source));
+
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)));
+	EXPECT_EQ(operation->opCode, FMI3_LS_BUS_CAN_OP_CONFIRM);
+	EXPECT_EQ(((fmi3LsBusCanOperationConfirm*)operation)->id, 0x1u);
+	ASSERT_TRUE((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)));
+	EXPECT_EQ(((fmi3LsBusCanOperationConfirm*)operation)->id, 0x2u);
+	EXPECT_FALSE((FMI3_LS_BUS_READ_NEXT_OPERATION(&rxBufferInfo, operation)));
+
+	/* Retaining an owned buffer variable keeps it unchanged */
+	FMI3_LS_BUS_BUFFER_INFO_RETAIN(&rxBufferInfo, buffer, sizeof(buffer));
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_LENGTH(&rxBufferInfo), 24);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&rxBufferInfo, 0x3);
+	EXPECT_EQ(rxBufferInfo.status, fmi3True);
+}
+
+/**
+ * \brief Test for retaining more operations than fit into the owned buffer.
+ */
+TEST(Fmi3LsBusBorrow, retainOverflow) {
+
+	fmi3UInt8 source[128];
+	fmi3UInt8 buffer[16];
+	fmi3LsBusUtilBufferInfo sourceInfo;
+	fmi3LsBusUtilBufferInfo rxBufferInfo;
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&sourceInfo, source, sizeof(source));
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&sourceInfo, 0x1);
+	FMI3_LS_BUS_CAN_CREATE_OP_CONFIRM(&sourceInfo, 0x2);
+
+	FMI3_LS_BUS_BUFFER_INFO_INIT(&rxBufferInfo, buffer, sizeof(buffer));
+	FMI3_LS_BUS_BUFFER_INFO_BORROW(&rxBufferInfo, source, FMI3_LS_BUS_BUFFER_LENGTH(&sourceInfo));
+	FMI3_LS_BUS_BUFFER_INFO_RETAIN(&rxBufferInfo, buffer, sizeof(buffer));
+	EXPECT_EQ(rxBufferInfo.status, fmi3False);
+	EXPECT_EQ(FMI3_LS_BUS_BUFFER_START(&rxBufferInfo), buffer);
+	EXPECT_TRUE(FMI3_LS_BUS_BUFFER_IS_EMPTY(&rxBufferInfo));
+}